@@ -1,11 +1,14 @@
 #include <benchmark/benchmark.h>
 #include "../include/market_data.h"
+#include "../include/straddle_strategy.h"
+#include "../include/trade_journal.h"
 #include <chrono>
 #include <vector>
 #include <thread>
 #include <atomic>
 
-using namespace hft_straddle::data;
+using namespace hft::data;
+using hft::strategy::OptionsCalculator;
 
 // Benchmark timestamp creation latency
 static void BM_TimestampLatency(benchmark::State& state) {
@@ -83,6 +86,125 @@ static void BM_OptionPricingLatency(benchmark::State& state) {
 }
 BENCHMARK(BM_OptionPricingLatency);
 
+// Synthetic chain around a 150.00 underlying for batch pricing benchmarks
+struct BenchmarkChain {
+    std::vector<double> spot, strike, expiry, rate, vol;
+    std::vector<uint8_t> is_call;
+    std::vector<double> price, delta, gamma, theta, vega, rho;
+    
+    explicit BenchmarkChain(size_t n)
+        : spot(n, 150.0), strike(n), expiry(n), rate(n, 0.02), vol(n), is_call(n),
+          price(n), delta(n), gamma(n), theta(n), vega(n), rho(n) {
+        for (size_t i = 0; i < n; ++i) {
+            strike[i] = 100.0 + 100.0 * static_cast<double>(i / 2) / static_cast<double>(n);
+            expiry[i] = (7.0 + static_cast<double>(i % 8) * 7.0) / 365.0;
+            vol[i] = 0.20 + 0.001 * static_cast<double>(i % 50);
+            is_call[i] = static_cast<uint8_t>(i % 2);
+        }
+    }
+    
+    hft::strategy::ChainPricingInput input() const {
+        return {spot.data(), strike.data(), expiry.data(), rate.data(), vol.data(),
+                is_call.data(), spot.size()};
+    }
+    
+    hft::strategy::ChainPricingOutput output() {
+        return {price.data(), delta.data(), gamma.data(), theta.data(), vega.data(), rho.data()};
+    }
+};
+
+// Baseline: reprice a chain with the per-Greek scalar functions
+static void BM_ChainPricingPerGreek(benchmark::State& state) {
+    BenchmarkChain chain(static_cast<size_t>(state.range(0)));
+    
+    for (auto _ : state) {
+        for (size_t i = 0; i < chain.spot.size(); ++i) {
+            const double S = chain.spot[i], K = chain.strike[i], T = chain.expiry[i];
+            const double r = chain.rate[i], v = chain.vol[i];
+            const bool call = chain.is_call[i] != 0;
+            chain.price[i] = call ? OptionsCalculator::black_scholes_call(S, K, T, r, v)
+                                  : OptionsCalculator::black_scholes_put(S, K, T, r, v);
+            chain.delta[i] = OptionsCalculator::calculate_delta(S, K, T, r, v, call);
+            chain.gamma[i] = OptionsCalculator::calculate_gamma(S, K, T, r, v);
+            chain.theta[i] = OptionsCalculator::calculate_theta(S, K, T, r, v, call);
+            chain.vega[i] = OptionsCalculator::calculate_vega(S, K, T, r, v);
+            chain.rho[i] = OptionsCalculator::calculate_rho(S, K, T, r, v, call);
+        }
+        benchmark::DoNotOptimize(chain.price.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChainPricingPerGreek)->Arg(hft::constants::MAX_OPTIONS_PER_SYMBOL);
+
+// Batch chain pricing at a fixed SIMD level (0 = scalar, 1 = AVX2, 2 = AVX-512)
+static void BM_ChainPricingBatch(benchmark::State& state) {
+    const auto level = static_cast<hft::strategy::SimdLevel>(state.range(1));
+    if (level > OptionsCalculator::detect_simd_level()) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return;
+    }
+    
+    BenchmarkChain chain(static_cast<size_t>(state.range(0)));
+    const auto input = chain.input();
+    const auto output = chain.output();
+    
+    for (auto _ : state) {
+        OptionsCalculator::price_chain(input, output, level);
+        benchmark::DoNotOptimize(chain.price.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChainPricingBatch)
+    ->Args({hft::constants::MAX_OPTIONS_PER_SYMBOL, 0})
+    ->Args({hft::constants::MAX_OPTIONS_PER_SYMBOL, 1})
+    ->Args({hft::constants::MAX_OPTIONS_PER_SYMBOL, 2});
+
+// Chain-level implied volatility: cold start vs warm start from previous IVs
+static void BM_ChainImpliedVolatility(benchmark::State& state) {
+    BenchmarkChain chain(static_cast<size_t>(state.range(0)));
+    OptionsCalculator::price_chain(chain.input(), chain.output());
+    
+    // Previous quote's IVs after a small vol move
+    std::vector<double> warm(chain.vol);
+    for (double& v : warm) v *= 1.01;
+    std::vector<double> iv(chain.vol.size());
+    
+    hft::strategy::ChainImpliedVolInput input{chain.price.data(), chain.spot.data(), chain.strike.data(),
+                                              chain.expiry.data(), chain.rate.data(), chain.is_call.data(),
+                                              state.range(1) ? warm.data() : nullptr, chain.spot.size()};
+    
+    for (auto _ : state) {
+        size_t converged = OptionsCalculator::solve_implied_volatility_chain(input, iv.data());
+        benchmark::DoNotOptimize(converged);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ChainImpliedVolatility)
+    ->Args({hft::constants::MAX_OPTIONS_PER_SYMBOL, 0})
+    ->Args({hft::constants::MAX_OPTIONS_PER_SYMBOL, 1});
+
+// Baseline: one Newton-Raphson solve per contract
+static void BM_PerContractImpliedVolatility(benchmark::State& state) {
+    BenchmarkChain chain(static_cast<size_t>(state.range(0)));
+    OptionsCalculator::price_chain(chain.input(), chain.output());
+    std::vector<double> iv(chain.vol.size());
+    
+    for (auto _ : state) {
+        for (size_t i = 0; i < chain.spot.size(); ++i) {
+            iv[i] = OptionsCalculator::calculate_implied_volatility(chain.price[i], chain.spot[i], chain.strike[i],
+                                                                    chain.expiry[i], chain.rate[i],
+                                                                    chain.is_call[i] != 0);
+        }
+        benchmark::DoNotOptimize(iv.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PerContractImpliedVolatility)->Arg(hft::constants::MAX_OPTIONS_PER_SYMBOL);
+
 // Benchmark memory allocation latency
 static void BM_MemoryAllocationLatency(benchmark::State& state) {
     for (auto _ : state) {
@@ -105,6 +227,73 @@ static void BM_MemoryAllocationLatency(benchmark::State& state) {
 }
 BENCHMARK(BM_MemoryAllocationLatency);
 
+// Trading-thread cost of journaling one trade (writer thread drains to /dev/null)
+static void BM_TradeJournalRecord(benchmark::State& state) {
+    hft::data::TradeJournal::Config config;
+    config.path = "/dev/null";
+    hft::data::TradeJournal journal(config);
+    if (!journal.start()) {
+        state.SkipWithError("cannot open /dev/null");
+        return;
+    }
+    
+    hft::data::JournalRecord record{};
+    record.symbol_id = 1;
+    record.event = hft::data::JournalEvent::POSITION_OPEN;
+    record.call_strike = Price(102.0);
+    record.put_strike = Price(98.0);
+    for (auto _ : state) {
+        record.timestamp_ns += 1;
+        record.position_id += 1;
+        benchmark::DoNotOptimize(journal.record(record));
+    }
+    journal.stop();
+    state.counters["dropped"] = static_cast<double>(journal.records_dropped());
+}
+BENCHMARK(BM_TradeJournalRecord);
+
+// Pre-trade check against the headroom snapshot, with symbols spread
+// over sectors and correlation groups and a partly used book
+static void BM_RiskCheck(benchmark::State& state) {
+    hft::strategy::RiskManager risk;
+    risk.set_portfolio_value(1000000.0);
+    for (uint32_t id = 0; id < 100; ++id) {
+        risk.set_sector(id, static_cast<uint8_t>(1 + id % 8));
+        risk.set_correlation_group(id, static_cast<uint8_t>(1 + id % 16));
+    }
+    hft::strategy::PortfolioExposure exposure;
+    exposure.market_value = 20.0;
+    exposure.positions = 1;
+    for (uint32_t id = 0; id < 10; ++id) {
+        risk.update_symbol_risk(id, exposure);
+    }
+    
+    uint32_t symbol_id = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(risk.can_open_position(symbol_id, 400.0));
+        symbol_id = symbol_id + 1 < 100 ? symbol_id + 1 : 0;
+    }
+}
+BENCHMARK(BM_RiskCheck);
+
+// Incremental headroom update after one symbol's marks move
+static void BM_RiskSymbolUpdate(benchmark::State& state) {
+    hft::strategy::RiskManager risk;
+    risk.set_portfolio_value(1000000.0);
+    risk.set_sector(1, 2);
+    risk.set_correlation_group(1, 3);
+    hft::strategy::PortfolioExposure exposure;
+    exposure.positions = 1;
+    double mark = 20.0;
+    for (auto _ : state) {
+        mark = mark < 30.0 ? mark + 0.01 : 20.0;
+        exposure.market_value = mark;
+        risk.update_symbol_risk(1, exposure);
+    }
+    benchmark::DoNotOptimize(risk.get_headroom());
+}
+BENCHMARK(BM_RiskSymbolUpdate);
+
 // Benchmark cache miss latency
 static void BM_CacheMissLatency(benchmark::State& state) {
     const size_t size = state.range(0);
@@ -262,7 +451,7 @@ static void BM_TradingDecisionLatency(benchmark::State& state) {
         
         // Market analysis
         double spread = tick.spread_pct();
-        double midpoint = tick.midpoint().value();
+        double midpoint = tick.midpoint().to_double();
         bool sufficient_volume = tick.volume > 1000;
         bool tight_spread = spread < 0.01;
         
@@ -1,9 +1,14 @@
 #include <benchmark/benchmark.h>
 #include "../include/market_data.h"
+#include "../include/event_dispatch.h"
+#include "../include/csv_tick_parser.h"
+#include "../include/data_ingestion.h"
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <random>
 
-using namespace hft_straddle::data;
+using namespace hft::data;
 
 // Benchmark market tick creation
 static void BM_MarketTickCreation(benchmark::State& state) {
@@ -58,25 +63,21 @@ BENCHMARK(BM_TimestampCreation);
 
 // Benchmark option tick processing
 static void BM_OptionTickProcessing(benchmark::State& state) {
-    OptionTick option_tick;
-    strcpy(option_tick.symbol, "AAPL");
+    OptionTick option_tick{};
+    option_tick.symbol_id = 1;
     option_tick.expiration_date = 20251220;
-    option_tick.strike_price = Price(150.0);
-    option_tick.option_type = OptionType::CALL;
+    option_tick.strike = Price(150.0);
+    option_tick.option_type = 0;  // Call
     option_tick.bid = Price(5.50);
     option_tick.ask = Price(5.60);
-    option_tick.last_price = Price(5.55);
+    option_tick.last = Price(155.55);
     option_tick.volume = 500;
     option_tick.implied_volatility = 0.25;
-    option_tick.delta = 0.6;
-    option_tick.gamma = 0.05;
-    option_tick.theta = -0.02;
-    option_tick.vega = 0.15;
     
     for (auto _ : state) {
         // Simulate processing option tick
-        double intrinsic_value = std::max(0.0, option_tick.last_price.value() - option_tick.strike_price.value());
-        double time_value = option_tick.last_price.value() - intrinsic_value;
+        double intrinsic_value = std::max(0.0, option_tick.last.to_double() - option_tick.strike.to_double());
+        double time_value = option_tick.last.to_double() - intrinsic_value;
         
         benchmark::DoNotOptimize(intrinsic_value);
         benchmark::DoNotOptimize(time_value);
@@ -84,31 +85,6 @@ static void BM_OptionTickProcessing(benchmark::State& state) {
 }
 BENCHMARK(BM_OptionTickProcessing);
 
-// Benchmark straddle quote construction
-static void BM_StraddleQuoteConstruction(benchmark::State& state) {
-    for (auto _ : state) {
-        StraddleQuote straddle;
-        strcpy(straddle.underlying_symbol, "AAPL");
-        straddle.underlying_price = Price(150.0);
-        straddle.expiration_date = 20251220;
-        straddle.strike_price = Price(150.0);
-        
-        straddle.call_option.bid = Price(5.50);
-        straddle.call_option.ask = Price(5.60);
-        straddle.call_option.last_price = Price(5.55);
-        
-        straddle.put_option.bid = Price(5.40);
-        straddle.put_option.ask = Price(5.50);
-        straddle.put_option.last_price = Price(5.45);
-        
-        straddle.straddle_price = Price(straddle.call_option.last_price.value() + 
-                                       straddle.put_option.last_price.value());
-        
-        benchmark::DoNotOptimize(straddle);
-    }
-}
-BENCHMARK(BM_StraddleQuoteConstruction);
-
 // Benchmark bulk market data processing
 static void BM_BulkMarketDataProcessing(benchmark::State& state) {
     const size_t num_ticks = state.range(0);
@@ -126,8 +102,8 @@ static void BM_BulkMarketDataProcessing(benchmark::State& state) {
         tick.timestamp = Timestamp::now();
         tick.symbol_id = static_cast<uint32_t>(i % 100);
         tick.bid = Price(price_dist(gen));
-        tick.ask = Price(tick.bid.value() + 0.05);
-        tick.last = Price((tick.bid.value() + tick.ask.value()) / 2.0);
+        tick.ask = Price(tick.bid.to_double() + 0.05);
+        tick.last = Price((tick.bid.to_double() + tick.ask.to_double()) / 2.0);
         tick.volume = volume_dist(gen);
         ticks.push_back(tick);
     }
@@ -135,7 +111,7 @@ static void BM_BulkMarketDataProcessing(benchmark::State& state) {
     for (auto _ : state) {
         double total_value = 0.0;
         for (const auto& tick : ticks) {
-            total_value += tick.midpoint().value() * tick.volume;
+            total_value += tick.midpoint().to_double() * tick.volume;
         }
         benchmark::DoNotOptimize(total_value);
     }
@@ -185,4 +161,169 @@ static void BM_CacheAlignedAccess(benchmark::State& state) {
 }
 BENCHMARK(BM_CacheAlignedAccess);
 
-BENCHMARK_MAIN();
\ No newline at end of file
+// Subscribers used by the dispatch benchmarks: a strategy-like consumer
+// of both tick types, a market-only risk monitor and an options recorder
+struct BenchStrategyHandler {
+    double last_mid = 0.0;
+    uint64_t options = 0;
+    void on_market_data(const MarketTick& tick) { last_mid = tick.midpoint().to_double(); }
+    void on_options_data(const OptionTick& tick) { options += tick.volume; }
+};
+
+struct BenchRiskHandler {
+    int64_t max_spread = 0;
+    void on_market_data(const MarketTick& tick) {
+        max_spread = std::max<int64_t>(max_spread, tick.ask.value - tick.bid.value);
+    }
+};
+
+struct BenchOptionsHandler {
+    double iv_sum = 0.0;
+    void on_options_data(const OptionTick& tick) { iv_sum += tick.implied_volatility; }
+};
+
+static std::vector<DataEvent> make_dispatch_events(size_t count) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> price_dist(99.0, 101.0);
+    std::vector<DataEvent> events;
+    events.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (i % 4 == 3) {
+            OptionTick option{};
+            option.symbol_id = static_cast<uint32_t>(1 + i % 10);
+            option.volume = 10;
+            option.implied_volatility = 0.3;
+            events.emplace_back(DataEventType::OPTION_TICK, option, Timestamp(i));
+        } else {
+            MarketTick tick{};
+            tick.symbol_id = static_cast<uint32_t>(1 + i % 10);
+            tick.bid = Price(price_dist(gen));
+            tick.ask = Price(tick.bid.to_double() + 0.05);
+            events.emplace_back(DataEventType::MARKET_TICK, tick, Timestamp(i));
+        }
+    }
+    return events;
+}
+
+// Current path: type-erased subscribers, each filtering by event type itself
+static void BM_DispatchStdFunction(benchmark::State& state) {
+    const auto events = make_dispatch_events(state.range(0));
+    BenchStrategyHandler strategy;
+    BenchRiskHandler risk;
+    BenchOptionsHandler recorder;
+
+    std::vector<std::function<void(const DataEvent&)>> subscribers;
+    subscribers.emplace_back([&](const DataEvent& e) {
+        if (e.is_option()) strategy.on_options_data(e.option_tick);
+        else strategy.on_market_data(e.market_tick);
+    });
+    subscribers.emplace_back([&](const DataEvent& e) {
+        if (!e.is_option()) risk.on_market_data(e.market_tick);
+    });
+    subscribers.emplace_back([&](const DataEvent& e) {
+        if (e.is_option()) recorder.on_options_data(e.option_tick);
+    });
+
+    for (auto _ : state) {
+        for (const auto& event : events) {
+            for (const auto& subscriber : subscribers) {
+                subscriber(event);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(strategy.last_mid);
+    benchmark::DoNotOptimize(risk.max_spread);
+    benchmark::DoNotOptimize(recorder.iv_sum);
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_DispatchStdFunction)->Arg(64)->Arg(4096);
+
+// Compiled pipeline, driven through the engine's batch sink
+static void BM_DispatchPipeline(benchmark::State& state) {
+    const auto events = make_dispatch_events(state.range(0));
+    BenchStrategyHandler strategy;
+    BenchRiskHandler risk;
+    BenchOptionsHandler recorder;
+
+    EventPipeline<BenchStrategyHandler, BenchRiskHandler, BenchOptionsHandler> pipeline(strategy, risk, recorder);
+    const EventSink sink = pipeline.sink();
+
+    for (auto _ : state) {
+        sink.dispatch(sink.context, events.data(), events.size());
+        benchmark::ClobberMemory();
+    }
+    benchmark::DoNotOptimize(strategy.last_mid);
+    benchmark::DoNotOptimize(risk.max_spread);
+    benchmark::DoNotOptimize(recorder.iv_sum);
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_DispatchPipeline)->Arg(64)->Arg(4096);
+
+// Bulk CSV parse throughput; argument is the worker thread count
+static void BM_CsvParse(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::string csv;
+    for (int i = 0; i < 200000; ++i) {
+        const int mid = 1500000 + static_cast<int>(rng() % 20000);
+        csv += std::to_string(1640995200000000000ull + i * 1000ull) + "," +
+               std::to_string((mid - 5) / 10000) + "." + std::to_string((mid - 5) % 10000) + "," +
+               std::to_string((mid + 5) / 10000) + "." + std::to_string((mid + 5) % 10000) + "," +
+               std::to_string(mid / 10000) + "." + std::to_string(mid % 10000) + "," +
+               std::to_string(rng() % 1000) + "," + std::to_string(rng() % 1000) + "," +
+               std::to_string(rng() % 100000) + "\n";
+    }
+
+    CsvTickParser::Config config;
+    config.num_threads = static_cast<size_t>(state.range(0));
+    config.min_chunk_bytes = 64 << 10;
+    std::vector<MarketTick> ticks;
+    ticks.reserve(200000);
+
+    for (auto _ : state) {
+        ticks.clear();
+        benchmark::DoNotOptimize(CsvTickParser::parse(csv.data(), csv.size(), 0, ticks, config));
+    }
+    state.SetBytesProcessed(state.iterations() * csv.size());
+}
+BENCHMARK(BM_CsvParse)->Arg(1)->Arg(4)->UseRealTime();
+
+// Tick validation one tick at a time vs one ring batch (64 ticks) per
+// call; argument 0 = per tick, 1 = scalar batch, 2 = vectorized batch
+static void BM_ValidateTicks(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::vector<MarketTick> ticks(DataValidator::BATCH_SIZE * 64);
+    // Symbols round-robin over a 97-name universe, so a symbol's previous
+    // quote is always from an earlier group of four
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        MarketTick& tick = ticks[i];
+        const int mid = 1500000 + static_cast<int>(rng() % 20000);
+        tick = MarketTick{};
+        tick.symbol_id = static_cast<uint32_t>(1 + i % 97);
+        tick.bid.value = mid - 5;
+        tick.ask.value = mid + 5;
+        tick.volume = 1 + rng() % 1000;
+    }
+    DataValidator validator;
+    validator.set_vectorized(state.range(0) == 2);
+    if (state.range(0) == 2 && !validator.is_vectorized()) {
+        state.SkipWithError("no AVX2");
+        return;
+    }
+
+    for (auto _ : state) {
+        uint64_t rejected = 0;
+        for (size_t i = 0; i < ticks.size(); i += DataValidator::BATCH_SIZE) {
+            if (state.range(0) == 0) {
+                for (size_t k = i; k < i + DataValidator::BATCH_SIZE; ++k) {
+                    rejected += !validator.validate_market_tick(ticks[k], k > 0 ? &ticks[k - 1] : nullptr);
+                }
+            } else {
+                rejected |= validator.validate_market_batch(ticks.data() + i, DataValidator::BATCH_SIZE);
+            }
+        }
+        benchmark::DoNotOptimize(rejected);
+    }
+    state.SetItemsProcessed(state.iterations() * ticks.size());
+}
+BENCHMARK(BM_ValidateTicks)->Arg(0)->Arg(1)->Arg(2);
@@ -1,29 +1,45 @@
 #include <benchmark/benchmark.h>
 #include "../include/straddle_strategy.h"
 #include "../include/market_data.h"
+#include <cmath>
 #include <vector>
 #include <random>
 
-using namespace hft_straddle::strategy;
-using namespace hft_straddle::data;
+using namespace hft::strategy;
+using namespace hft::data;
+
+namespace {
+
+// Both legs of one at-the-money straddle, as the entry filter sees them
+struct StraddleQuote {
+    Price underlying_price;
+    uint32_t expiration_date;
+    Price strike_price;
+    OptionTick call_option;
+    OptionTick put_option;
+    Price straddle_price;
+    uint64_t total_volume;
+    double bid_ask_spread;
+};
+
+} // namespace
 
 // Helper function to create test straddle quote
 StraddleQuote create_test_straddle(double underlying_price, double call_price, double put_price) {
-    StraddleQuote straddle;
-    strcpy(straddle.underlying_symbol, "AAPL");
+    StraddleQuote straddle{};
     straddle.underlying_price = Price(underlying_price);
     straddle.expiration_date = 20251220;
     straddle.strike_price = Price(150.0);
     
     straddle.call_option.bid = Price(call_price - 0.05);
     straddle.call_option.ask = Price(call_price + 0.05);
-    straddle.call_option.last_price = Price(call_price);
+    straddle.call_option.last = Price(call_price);
     straddle.call_option.volume = 500;
     straddle.call_option.implied_volatility = 0.25;
     
     straddle.put_option.bid = Price(put_price - 0.05);
     straddle.put_option.ask = Price(put_price + 0.05);
-    straddle.put_option.last_price = Price(put_price);
+    straddle.put_option.last = Price(put_price);
     straddle.put_option.volume = 400;
     straddle.put_option.implied_volatility = 0.24;
     
@@ -47,11 +63,11 @@ BENCHMARK(BM_StrategyInitialization);
 static void BM_ProfitLossCalculation(benchmark::State& state) {
     StraddlePosition position;
     position.position_id = 1;
-    position.underlying_symbol_id = 1;
+    position.symbol_id = 1;
     position.entry_time = Timestamp::now();
-    position.strike_price = Price(150.0);
-    position.entry_premium = Price(11.0);
-    position.quantity = 1;
+    position.call_strike = Price(150.0);
+    position.total_premium_paid = Price(11.0);
+    const int quantity = 1;
     
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -61,12 +77,12 @@ static void BM_ProfitLossCalculation(benchmark::State& state) {
         double current_underlying = price_dist(gen);
         
         // Calculate current straddle value
-        double call_intrinsic = std::max(0.0, current_underlying - position.strike_price.value());
-        double put_intrinsic = std::max(0.0, position.strike_price.value() - current_underlying);
+        double call_intrinsic = std::max(0.0, current_underlying - position.call_strike.to_double());
+        double put_intrinsic = std::max(0.0, position.call_strike.to_double() - current_underlying);
         double current_value = call_intrinsic + put_intrinsic;
         
         // Calculate P&L
-        double pnl = (current_value - position.entry_premium.value()) * position.quantity;
+        double pnl = (current_value - position.total_premium_paid.to_double()) * quantity;
         
         benchmark::DoNotOptimize(pnl);
     }
@@ -107,15 +123,15 @@ BENCHMARK(BM_VolatilityAnalysis);
 static void BM_RiskCalculations(benchmark::State& state) {
     StraddlePosition position;
     position.position_id = 1;
-    position.strike_price = Price(150.0);
-    position.entry_premium = Price(11.0);
-    position.quantity = 10;  // 10 contracts
+    position.call_strike = Price(150.0);
+    position.total_premium_paid = Price(11.0);
+    const int quantity = 10;  // 10 contracts
     
     double portfolio_value = 1000000.0;  // $1M portfolio
     
     for (auto _ : state) {
         // Calculate position value
-        double position_value = position.entry_premium.value() * position.quantity * 100;  // Options are per 100 shares
+        double position_value = position.total_premium_paid.to_double() * quantity * 100;  // Options are per 100 shares
         
         // Calculate position concentration
         double position_concentration = position_value / portfolio_value;
@@ -127,10 +143,10 @@ static void BM_RiskCalculations(benchmark::State& state) {
         double vega = 0.20;   // Volatility sensitivity
         
         // Calculate portfolio Greeks
-        double portfolio_delta = delta * position.quantity;
-        double portfolio_gamma = gamma * position.quantity;
-        double portfolio_theta = theta * position.quantity;
-        double portfolio_vega = vega * position.quantity;
+        double portfolio_delta = delta * quantity;
+        double portfolio_gamma = gamma * quantity;
+        double portfolio_theta = theta * quantity;
+        double portfolio_vega = vega * quantity;
         
         benchmark::DoNotOptimize(position_concentration);
         benchmark::DoNotOptimize(portfolio_delta);
@@ -161,8 +177,8 @@ static void BM_EntrySignalGeneration(benchmark::State& state) {
                              (straddle.put_option.implied_volatility < 0.20);
         bool sufficient_volume = straddle.total_volume > 1000;
         bool tight_spread = straddle.bid_ask_spread < 0.03;
-        bool otm_criteria = std::abs(straddle.underlying_price.value() - straddle.strike_price.value()) / 
-                           straddle.strike_price.value() < 0.02;  // Within 2% of ATM
+        bool otm_criteria = std::abs(straddle.underlying_price.to_double() - straddle.strike_price.to_double()) / 
+                           straddle.strike_price.to_double() < 0.02;  // Within 2% of ATM
         
         bool enter_trade = low_volatility && sufficient_volume && tight_spread && otm_criteria;
         
@@ -176,9 +192,8 @@ static void BM_ExitSignalGeneration(benchmark::State& state) {
     StraddlePosition position;
     position.position_id = 1;
     position.entry_time = Timestamp::now();
-    position.strike_price = Price(150.0);
-    position.entry_premium = Price(11.0);
-    position.quantity = 1;
+    position.call_strike = Price(150.0);
+    position.total_premium_paid = Price(11.0);
     position.profit_target = Price(12.65);  // 15% profit
     position.stop_loss = Price(8.25);       // 25% loss
     position.expiration_date = 20251220;
@@ -191,8 +206,8 @@ static void BM_ExitSignalGeneration(benchmark::State& state) {
         double current_straddle_price = price_dist(gen);
         
         // Exit criteria evaluation
-        bool profit_target_hit = current_straddle_price >= position.profit_target.value();
-        bool stop_loss_hit = current_straddle_price <= position.stop_loss.value();
+        bool profit_target_hit = current_straddle_price >= position.profit_target.to_double();
+        bool stop_loss_hit = current_straddle_price <= position.stop_loss.to_double();
         
         // Time-based exit (simplified - assuming we're close to expiration)
         auto current_time = Timestamp::now();
@@ -217,13 +232,12 @@ static void BM_PositionManagement(benchmark::State& state) {
     for (size_t i = 0; i < num_positions; ++i) {
         StraddlePosition pos;
         pos.position_id = static_cast<uint32_t>(i);
-        pos.underlying_symbol_id = static_cast<uint32_t>(i % 10);
+        pos.symbol_id = static_cast<uint32_t>(i % 10);
         pos.entry_time = Timestamp::now();
-        pos.strike_price = Price(150.0 + (i % 20));
-        pos.entry_premium = Price(10.0 + (i % 5));
-        pos.quantity = 1 + (i % 3);
-        pos.profit_target = Price(pos.entry_premium.value() * 1.15);
-        pos.stop_loss = Price(pos.entry_premium.value() * 0.75);
+        pos.call_strike = Price(150.0 + (i % 20));
+        pos.total_premium_paid = Price(10.0 + (i % 5));
+        pos.profit_target = Price(pos.total_premium_paid.to_double() * 1.15);
+        pos.stop_loss = Price(pos.total_premium_paid.to_double() * 0.75);
         pos.expiration_date = 20251220;
         positions.push_back(pos);
     }
@@ -233,12 +247,12 @@ static void BM_PositionManagement(benchmark::State& state) {
         double total_pnl = 0.0;
         
         for (const auto& pos : positions) {
-            double position_value = pos.entry_premium.value() * pos.quantity * 100;
+            double position_value = pos.total_premium_paid.to_double() * StraddleStrategy::CONTRACT_MULTIPLIER;
             total_exposure += position_value;
             
             // Simplified P&L calculation
-            double current_value = pos.entry_premium.value() * 1.05;  // 5% gain
-            double pnl = (current_value - pos.entry_premium.value()) * pos.quantity * 100;
+            double current_value = pos.total_premium_paid.to_double() * 1.05;  // 5% gain
+            double pnl = (current_value - pos.total_premium_paid.to_double()) * StraddleStrategy::CONTRACT_MULTIPLIER;
             total_pnl += pnl;
         }
         
@@ -286,5 +300,3 @@ static void BM_PerformanceMetrics(benchmark::State& state) {
     }
 }
 BENCHMARK(BM_PerformanceMetrics);
-
-BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,604 @@
+/*
+ * ===================================================================
+ *                  TICK-TO-TRADE REPLAY BENCHMARK
+ * ===================================================================
+ *
+ * The whole trading path under multi-feed load, end to end:
+ *
+ *   replay feeds -> DataIngestionEngine -> StraddleStrategy -> RiskManager
+ *                -> OrderRouter send thread -> wire (discarded)
+ *
+ * SESSION:
+ * - Deterministic multi-symbol session of underlying ticks and option
+ *   chain quotes, built up front so replay cost is only publication
+ * - Each symbol cycles through a choppy and a calm regime with a rally
+ *   in its calls, so every cycle opens and closes one straddle per
+ *   symbol; chain quotes are refreshed one contract per tick
+ * - Symbols are split across feed threads that publish concurrently
+ *   into the engine's ring; one worker runs the strategy
+ *
+ * MEASUREMENTS:
+ * - Throughput: the session published unpaced, events per second until
+ *   the engine has processed every one (fewer straddles: positions wait
+ *   on the send thread's reports)
+ * - Tick-to-trade: a paced replay; for each straddle on the wire, from
+ *   the receive stamp of the event that triggered it to the router's
+ *   send time
+ * - LatencyTracker stage percentiles of the paced run
+ *
+ * REGRESSION GATE:
+ *   benchmark_tick_to_trade --json out.json --baseline benchmarks/baselines/tick_to_trade.json
+ * exits 1 when throughput drops or tick-to-trade p50 grows by more than
+ * the baseline's tolerance, p99 grows by more than its (looser) tail
+ * tolerance, or the run sends a different number of straddles.
+ * --write-baseline <path> stores the run as the new baseline (record it
+ * on the machine that runs the gate). The gate assumes that machine is
+ * quiet with a core per thread; on a shared or single-core host p99
+ * varies several-fold between runs.
+ *
+ * ===================================================================
+ */
+
+#include "../include/data_ingestion.h"
+#include "../include/event_dispatch.h"
+#include "../include/json_cursor.h"
+#include "../include/latency_tracker.h"
+#include "../include/order_router.h"
+#include "../include/straddle_strategy.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+using hft::execution::OrderRouter;
+using hft::strategy::RiskManager;
+using hft::strategy::StraddleStrategy;
+
+namespace {
+
+constexpr uint64_t SESSION_START = 1640995200000000000ull;   // 2022-01-01
+constexpr uint64_t TICK_INTERVAL_NS = 100000000ull;          // Per symbol
+constexpr int CYCLE_TICKS = 240;
+constexpr int CHOPPY_TICKS = 160;
+constexpr int RALLY_TICK = 201;
+constexpr double STRIKES[] = {0.95, 0.98, 1.00, 1.02, 1.05};   // Fractions of the base price
+constexpr size_t CONTRACTS = 2 * std::size(STRIKES);
+constexpr double PORTFOLIO_VALUE = 1000000.0;
+// Run-to-run spread on a quiet machine is ~15% for throughput and p50;
+// p99 is one scheduler preemption away from doubling, so it gets 3x
+constexpr double DEFAULT_TOLERANCE = 0.25;
+constexpr double DEFAULT_TAIL_TOLERANCE = 2.0;
+constexpr size_t PUBLISH_BURST = 16;                          // Events per publication
+
+struct Options {
+    size_t symbols = 10;
+    size_t feeds = 4;
+    size_t cycles = 50;
+    double rate = 100000.0;          // Paced run, events/s across every feed
+    double tolerance = -1.0;         // < 0: the baseline's
+    double tail_tolerance = -1.0;
+    std::string json_path;
+    std::string baseline_path;
+    std::string write_baseline_path;
+};
+
+// ---- Session ----
+
+struct SymbolContracts {
+    uint32_t underlying_id;
+    double base_price;
+    uint32_t contract_ids[CONTRACTS];   // Calls then puts, by strike
+};
+
+MarketTick make_underlying(const SymbolContracts& symbol, uint64_t ts, int i) {
+    const double move = i < CHOPPY_TICKS ? (i % 2 ? 0.01 : -0.01) : (i % 2 ? 0.0001 : 0.0);
+    const int64_t price = std::llround(symbol.base_price * (1.0 + move) * Price::SCALE);
+    MarketTick tick{};
+    tick.timestamp = Timestamp(ts);
+    tick.symbol_id = symbol.underlying_id;
+    tick.bid.value = price - 100;
+    tick.ask.value = price + 100;
+    tick.last.value = price;
+    tick.volume = 100;
+    return tick;
+}
+
+OptionTick make_option(const SymbolContracts& symbol, uint64_t ts, size_t contract, int i) {
+    const bool call = contract < std::size(STRIKES);
+    const double scale = symbol.base_price / 100.0;
+    const bool rallied = call && i >= RALLY_TICK;
+    OptionTick option{};
+    option.timestamp = Timestamp(ts);
+    option.symbol_id = symbol.contract_ids[contract];
+    option.underlying_id = symbol.underlying_id;
+    option.strike.value = std::llround(symbol.base_price * STRIKES[contract % std::size(STRIKES)] * Price::SCALE);
+    option.bid.value = std::llround((rallied ? 3.0 : 1.9) * scale * Price::SCALE);
+    option.ask.value = std::llround((rallied ? 3.1 : 2.0) * scale * Price::SCALE);
+    option.expiration_date = 20220201;
+    option.days_to_expiry = 30;
+    option.option_type = call ? 0 : 1;
+    option.implied_volatility = 0.30;
+    return option;
+}
+
+// Events per feed, each feed's symbols interleaved tick by tick
+std::vector<std::vector<DataEvent>> build_session(const std::vector<SymbolContracts>& symbols,
+                                                  const Options& options) {
+    std::vector<std::vector<DataEvent>> feeds(options.feeds);
+    for (size_t f = 0; f < options.feeds; ++f) {
+        feeds[f].reserve(options.cycles * CYCLE_TICKS * (symbols.size() / options.feeds + 1) * 3);
+    }
+    for (size_t cycle = 0; cycle < options.cycles; ++cycle) {
+        for (int i = 0; i < CYCLE_TICKS; ++i) {
+            const uint64_t ts = SESSION_START + (cycle * CYCLE_TICKS + i) * TICK_INTERVAL_NS;
+            for (size_t s = 0; s < symbols.size(); ++s) {
+                auto& events = feeds[s % options.feeds];
+                const auto quote = [&](size_t contract) {
+                    events.emplace_back(DataEventType::OPTION_TICK, make_option(symbols[s], ts, contract, i),
+                                        Timestamp());
+                };
+                if (i == 0) {
+                    for (size_t c = 0; c < CONTRACTS; ++c) quote(c);
+                } else if (i == RALLY_TICK) {
+                    for (size_t c = 0; c < std::size(STRIKES); ++c) quote(c);
+                } else {
+                    quote(static_cast<size_t>(i) % CONTRACTS);
+                }
+                events.emplace_back(DataEventType::MARKET_TICK, make_underlying(symbols[s], ts, i), Timestamp());
+            }
+        }
+    }
+    return feeds;
+}
+
+// ---- Pipeline ----
+
+// The strategy keeps the risk manager's headroom current and checks it
+// before every entry; this stage watches for limits breached after each
+// underlying tick
+class RiskStage {
+public:
+    explicit RiskStage(const RiskManager& risk) : risk_(risk) {}
+
+    void on_market_data(const MarketTick&) {
+        if (risk_.is_risk_limit_breached()) {
+            ++breaches_;
+        }
+    }
+
+    uint64_t breaches() const { return breaches_; }
+
+private:
+    const RiskManager& risk_;
+    uint64_t breaches_ = 0;
+};
+
+using Pipeline = EventPipeline<StraddleStrategy, RiskStage>;
+
+// Engine sink (worker thread): each event through the pipeline, noting
+// the receive stamp of every event that sent straddles. Submissions are
+// read off the router, so no strategy hook is needed.
+class TradeProbe {
+public:
+    TradeProbe(Pipeline& pipeline, const OrderRouter& router, size_t capacity)
+        : pipeline_(pipeline), router_(router), origins_(capacity) {}
+
+    EventSink sink() { return EventSink{&TradeProbe::dispatch, this}; }
+
+    // After the engine has stopped
+    const uint64_t* origins() const { return origins_.data(); }
+    size_t count() const { return count_; }
+
+private:
+    static void dispatch(void* context, const DataEvent* events, size_t count) {
+        auto* probe = static_cast<TradeProbe*>(context);
+        for (size_t i = 0; i < count; ++i) {
+            probe->on_event(events[i]);
+        }
+    }
+
+    void on_event(const DataEvent& event) {
+        const uint64_t before = router_.submissions();
+        pipeline_.dispatch(event);
+        for (uint64_t n = router_.submissions() - before; n > 0 && count_ < origins_.size(); --n) {
+            origins_[count_++] = event.timestamp.nanoseconds_since_epoch;
+        }
+    }
+
+    Pipeline& pipeline_;
+    const OrderRouter& router_;
+    std::vector<uint64_t> origins_;
+    size_t count_ = 0;
+};
+
+// ---- Replay ----
+
+struct RunResult {
+    uint64_t events = 0;
+    uint64_t dropped = 0;
+    double seconds = 0.0;
+    uint64_t straddles = 0;          // Pairs on the wire
+    uint64_t unmatched = 0;          // Pairs without a triggering event (should be 0)
+    uint64_t risk_breaches = 0;
+    HistogramSnapshot tick_to_trade;
+    LatencyReport stages{};
+};
+
+void publish_feed(DataIngestionEngine& engine, const std::vector<DataEvent>& events, double rate,
+                  const std::atomic<bool>& go) {
+    while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    const auto interval = rate > 0.0
+        ? std::chrono::nanoseconds(static_cast<int64_t>(PUBLISH_BURST * 1e9 / rate))
+        : std::chrono::nanoseconds(0);
+    auto deadline = std::chrono::steady_clock::now();
+    for (size_t pos = 0; pos < events.size();) {
+        if (rate > 0.0) {
+            std::this_thread::sleep_until(deadline);
+            deadline += interval;
+        }
+        const size_t n = std::min(PUBLISH_BURST, events.size() - pos);
+        const Timestamp received = Timestamp::now();   // One stamp per received burst
+        engine.publish_in_place(n, [&](DataEvent& slot, size_t i) {
+            slot = events[pos + i];
+            slot.timestamp = received;
+        });
+        pos += n;
+    }
+}
+
+std::unique_ptr<RunResult> replay(const std::vector<std::string>& tickers, const Options& options, bool paced) {
+    DataIngestionEngine::Config engine_config;
+    engine_config.num_worker_threads = 1;     // The strategy is single-threaded
+    engine_config.tech_symbols = tickers;
+    DataIngestionEngine engine(engine_config);
+    engine.initialize();
+
+    std::vector<SymbolContracts> symbols(tickers.size());
+    for (size_t s = 0; s < tickers.size(); ++s) {
+        symbols[s].underlying_id = engine.get_symbol_mapper().find_id(tickers[s]);
+        symbols[s].base_price = 100.0 + 10.0 * static_cast<double>(s);
+        // Exchange-style contract ids, as a real feed sends them (options
+        // route on their underlying)
+        for (size_t c = 0; c < CONTRACTS; ++c) {
+            symbols[s].contract_ids[c] = static_cast<uint32_t>(1000000 + s * CONTRACTS + c);
+        }
+    }
+    const auto session = build_session(symbols, options);
+
+    auto result = std::make_unique<RunResult>();
+    for (const auto& events : session) {
+        result->events += events.size();
+    }
+
+    // Wire writes keep each pair's send time (send thread only)
+    std::vector<uint64_t> send_times(2 * result->events);
+    size_t sent = 0;
+    OrderRouter::Config router_config;
+    router_config.busy_poll = false;
+    OrderRouter router([&](const uint8_t* data, size_t length) {
+        hft::execution::wire::EnterOrder order;
+        if (sent < send_times.size() && hft::execution::wire::decode_enter_order(data, length, order)) {
+            send_times[sent++] = order.send_time.nanoseconds_since_epoch;
+        }
+        return true;
+    }, router_config);
+
+    RiskManager risk;
+    risk.set_portfolio_value(PORTFOLIO_VALUE);
+    router.set_kill_switch(risk.kill_switch());
+
+    StraddleStrategy strategy;
+    strategy.initialize();
+    strategy.set_order_router(&router);
+    strategy.set_risk_manager(&risk);
+    strategy.start();
+
+    RiskStage risk_stage(risk);
+    Pipeline pipeline(strategy, risk_stage);
+    TradeProbe probe(pipeline, router, send_times.size());
+    if (!engine.set_event_sink(probe.sink())) {
+        return nullptr;
+    }
+
+    LatencyTracker::reset();   // Previous run's threads have exited
+    router.start();
+    engine.start();
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> feeds;
+    for (const auto& events : session) {
+        feeds.emplace_back(publish_feed, std::ref(engine), std::cref(events),
+                           paced ? options.rate / static_cast<double>(options.feeds) : 0.0, std::cref(go));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& feed : feeds) {
+        feed.join();
+    }
+    result->dropped = engine.get_events_dropped();
+    while (engine.get_events_processed() + result->dropped < result->events) {
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    result->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    engine.stop();
+    strategy.stop();
+    router.stop();
+    LatencyTracker::report(result->stages);
+
+    // Router and probe see straddles in the same (queue) order
+    result->straddles = sent;
+    result->risk_breaches = risk_stage.breaches();
+    auto histogram = std::make_unique<LatencyHistogram>();
+    const size_t matched = std::min(sent, probe.count());
+    for (size_t i = 0; i < matched; ++i) {
+        const uint64_t origin = probe.origins()[i];
+        histogram->record(send_times[i] > origin ? send_times[i] - origin : 0);
+    }
+    result->unmatched = sent - matched;
+    result->tick_to_trade.add(*histogram);
+    return result;
+}
+
+// ---- Results ----
+
+struct Metrics {
+    double events_per_sec = 0.0;
+    double tick_to_trade_p50_ns = 0.0;
+    double tick_to_trade_p99_ns = 0.0;
+    double tick_to_trade_p999_ns = 0.0;
+    double tick_to_trade_max_ns = 0.0;
+    double straddles_sent = 0.0;
+};
+
+Metrics metrics_of(const RunResult& throughput, const RunResult& latency) {
+    Metrics m;
+    m.events_per_sec = throughput.seconds > 0.0 ? static_cast<double>(throughput.events) / throughput.seconds : 0.0;
+    m.tick_to_trade_p50_ns = static_cast<double>(latency.tick_to_trade.percentile(0.50));
+    m.tick_to_trade_p99_ns = static_cast<double>(latency.tick_to_trade.percentile(0.99));
+    m.tick_to_trade_p999_ns = static_cast<double>(latency.tick_to_trade.percentile(0.999));
+    m.tick_to_trade_max_ns = static_cast<double>(latency.tick_to_trade.max());
+    m.straddles_sent = static_cast<double>(latency.straddles);
+    return m;
+}
+
+std::string to_json(const Options& options, const Metrics& m, const RunResult& throughput,
+                    const RunResult& latency, double tolerance, double tail_tolerance) {
+    std::ostringstream out;
+    char line[256];
+    out << "{\n  \"benchmark\": \"tick_to_trade\",\n";
+    if (tolerance >= 0.0) {
+        std::snprintf(line, sizeof(line), "  \"tolerance\": %.3f,\n  \"tail_tolerance\": %.3f,\n",
+                      tolerance, tail_tolerance);
+        out << line;
+    }
+    std::snprintf(line, sizeof(line),
+                  "  \"config\": {\"symbols\": %zu, \"feeds\": %zu, \"cycles\": %zu, \"rate\": %.0f},\n",
+                  options.symbols, options.feeds, options.cycles, options.rate);
+    out << line;
+    std::snprintf(line, sizeof(line),
+                  "  \"metrics\": {\n    \"events_per_sec\": %.1f,\n    \"tick_to_trade_p50_ns\": %.0f,\n"
+                  "    \"tick_to_trade_p99_ns\": %.0f,\n    \"tick_to_trade_p999_ns\": %.0f,\n",
+                  m.events_per_sec, m.tick_to_trade_p50_ns, m.tick_to_trade_p99_ns, m.tick_to_trade_p999_ns);
+    out << line;
+    std::snprintf(line, sizeof(line), "    \"tick_to_trade_max_ns\": %.0f,\n    \"straddles_sent\": %.0f\n  },\n",
+                  m.tick_to_trade_max_ns, m.straddles_sent);
+    out << line;
+    std::snprintf(line, sizeof(line),
+                  "  \"runs\": {\"events\": %llu, \"throughput_seconds\": %.6f, \"paced_seconds\": %.6f, "
+                  "\"events_dropped\": %llu, \"unmatched_straddles\": %llu, \"risk_breaches\": %llu},\n",
+                  static_cast<unsigned long long>(throughput.events), throughput.seconds, latency.seconds,
+                  static_cast<unsigned long long>(throughput.dropped + latency.dropped),
+                  static_cast<unsigned long long>(throughput.unmatched + latency.unmatched),
+                  static_cast<unsigned long long>(latency.risk_breaches));
+    out << line;
+    out << "  \"stages\": [";
+    bool first = true;
+    for (const StageLatency& stage : latency.stages) {
+        std::snprintf(line, sizeof(line),
+                      "%s\n    {\"stage\": \"%s\", \"count\": %llu, \"p50_ns\": %llu, \"p99_ns\": %llu, "
+                      "\"p999_ns\": %llu, \"max_ns\": %llu}",
+                      first ? "" : ",", to_string(stage.stage), static_cast<unsigned long long>(stage.count),
+                      static_cast<unsigned long long>(stage.p50_ns), static_cast<unsigned long long>(stage.p99_ns),
+                      static_cast<unsigned long long>(stage.p999_ns), static_cast<unsigned long long>(stage.max_ns));
+        out << line;
+        first = false;
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+bool write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::trunc);
+    return static_cast<bool>(file << text);
+}
+
+// ---- Baseline ----
+
+struct Baseline {
+    double tolerance = DEFAULT_TOLERANCE;
+    double tail_tolerance = DEFAULT_TAIL_TOLERANCE;
+    uint64_t symbols = 0;
+    uint64_t feeds = 0;
+    uint64_t cycles = 0;
+    double rate = 0.0;
+    Metrics metrics;
+};
+
+bool load_baseline(const std::string& path, Baseline& out) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    const std::string body((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    JsonCursor json(body.data(), body.size());
+    std::string_view key;
+    if (!json.enter_object()) {
+        return false;
+    }
+    while (json.next_key(key)) {
+        if (key == "tolerance") {
+            json.read_double(out.tolerance);
+        } else if (key == "tail_tolerance") {
+            json.read_double(out.tail_tolerance);
+        } else if (key == "config" && json.enter_object()) {
+            while (json.next_key(key)) {
+                if (key == "symbols") json.read_uint(out.symbols);
+                else if (key == "feeds") json.read_uint(out.feeds);
+                else if (key == "cycles") json.read_uint(out.cycles);
+                else if (key == "rate") json.read_double(out.rate);
+                else json.skip();
+            }
+        } else if (key == "metrics" && json.enter_object()) {
+            while (json.next_key(key)) {
+                if (key == "events_per_sec") json.read_double(out.metrics.events_per_sec);
+                else if (key == "tick_to_trade_p50_ns") json.read_double(out.metrics.tick_to_trade_p50_ns);
+                else if (key == "tick_to_trade_p99_ns") json.read_double(out.metrics.tick_to_trade_p99_ns);
+                else if (key == "straddles_sent") json.read_double(out.metrics.straddles_sent);
+                else json.skip();
+            }
+        } else {
+            json.skip();
+        }
+    }
+    return json.ok();
+}
+
+// One gated metric: worse than baseline by more than tolerance fails
+bool check(const char* name, double value, double baseline, double tolerance, bool higher_is_better) {
+    const double limit = higher_is_better ? baseline * (1.0 - tolerance) : baseline * (1.0 + tolerance);
+    const bool ok = higher_is_better ? value >= limit : value <= limit;
+    const double change = baseline != 0.0 ? (value - baseline) / baseline * 100.0 : 0.0;
+    std::printf("[GATE] %-22s %14.1f  baseline %14.1f  (%+6.1f%%)  %s\n", name, value, baseline, change,
+                ok ? "ok" : "REGRESSION");
+    return ok;
+}
+
+bool gate(const Options& options, const Metrics& m, const Baseline& baseline) {
+    const double tolerance = options.tolerance >= 0.0 ? options.tolerance : baseline.tolerance;
+    const double tail_tolerance = options.tail_tolerance >= 0.0 ? options.tail_tolerance : baseline.tail_tolerance;
+    bool ok = true;
+    ok = check("events_per_sec", m.events_per_sec, baseline.metrics.events_per_sec, tolerance, true) && ok;
+    ok = check("tick_to_trade_p50_ns", m.tick_to_trade_p50_ns, baseline.metrics.tick_to_trade_p50_ns,
+               tolerance, false) && ok;
+    ok = check("tick_to_trade_p99_ns", m.tick_to_trade_p99_ns, baseline.metrics.tick_to_trade_p99_ns,
+               tail_tolerance, false) && ok;
+    // Same session, same decisions: any difference is a behaviour change
+    const bool same_trades = m.straddles_sent == baseline.metrics.straddles_sent;
+    std::printf("[GATE] %-22s %14.0f  baseline %14.0f            %s\n", "straddles_sent", m.straddles_sent,
+                baseline.metrics.straddles_sent, same_trades ? "ok" : "MISMATCH");
+    return ok && same_trades;
+}
+
+bool parse_options(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value) {
+            return false;
+        }
+        if (arg == "--symbols") options.symbols = std::strtoul(value, nullptr, 10);
+        else if (arg == "--feeds") options.feeds = std::strtoul(value, nullptr, 10);
+        else if (arg == "--cycles") options.cycles = std::strtoul(value, nullptr, 10);
+        else if (arg == "--rate") options.rate = std::strtod(value, nullptr);
+        else if (arg == "--tolerance") options.tolerance = std::strtod(value, nullptr);
+        else if (arg == "--tail-tolerance") options.tail_tolerance = std::strtod(value, nullptr);
+        else if (arg == "--json") options.json_path = value;
+        else if (arg == "--baseline") options.baseline_path = value;
+        else if (arg == "--write-baseline") options.write_baseline_path = value;
+        else return false;
+        ++i;
+    }
+    return options.feeds > 0 && options.cycles > 0 && options.rate > 0.0 && options.symbols > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "usage: %s [--symbols N] [--feeds N] [--cycles N] [--rate events/s] [--json path]\n"
+                     "          [--baseline path] [--tolerance fraction] [--tail-tolerance fraction]\n"
+                     "          [--write-baseline path]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    // The engine's default universe; the strategy holds one straddle per symbol
+    const std::vector<std::string> universe = DataIngestionEngine::Config().tech_symbols;
+    options.symbols = std::min({options.symbols, universe.size(), StraddleStrategy::Config().max_positions});
+    options.feeds = std::min(options.feeds, options.symbols);
+    const std::vector<std::string> tickers(universe.begin(), universe.begin() + options.symbols);
+
+    const auto throughput = replay(tickers, options, false);
+    const auto latency = replay(tickers, options, true);
+    if (!throughput || !latency) {
+        std::fprintf(stderr, "engine refused the strategy sink\n");
+        return 2;
+    }
+    const Metrics m = metrics_of(*throughput, *latency);
+
+    std::printf("tick-to-trade: %zu symbols, %zu feeds, %llu events\n", options.symbols, options.feeds,
+                static_cast<unsigned long long>(throughput->events));
+    std::printf("  throughput     %.0f events/s (unpaced, %.3f s)\n", m.events_per_sec, throughput->seconds);
+    std::printf("  tick-to-trade  p50=%.0fns p99=%.0fns p99.9=%.0fns max=%.0fns over %llu straddles at %.0f events/s\n",
+                m.tick_to_trade_p50_ns, m.tick_to_trade_p99_ns, m.tick_to_trade_p999_ns, m.tick_to_trade_max_ns,
+                static_cast<unsigned long long>(latency->straddles), options.rate);
+    std::fputs(LatencyTracker::format_report(latency->stages).c_str(), stdout);
+
+    // Positions settle on the router's send reports, so the unpaced run
+    // trades less than the paced one; only the paced count is gated
+    int status = 0;
+    if (throughput->dropped + latency->dropped > 0 || throughput->unmatched + latency->unmatched > 0) {
+        std::fprintf(stderr, "replay incomplete: %llu events dropped, %llu straddles unmatched\n",
+                     static_cast<unsigned long long>(throughput->dropped + latency->dropped),
+                     static_cast<unsigned long long>(throughput->unmatched + latency->unmatched));
+        status = 1;
+    }
+
+    if (!options.json_path.empty() &&
+        !write_file(options.json_path, to_json(options, m, *throughput, *latency, -1.0, -1.0))) {
+        std::fprintf(stderr, "%s: cannot write results\n", options.json_path.c_str());
+        status = 2;
+    }
+    if (!options.write_baseline_path.empty()) {
+        const double tolerance = options.tolerance >= 0.0 ? options.tolerance : DEFAULT_TOLERANCE;
+        const double tail = options.tail_tolerance >= 0.0 ? options.tail_tolerance : DEFAULT_TAIL_TOLERANCE;
+        if (!write_file(options.write_baseline_path,
+                        to_json(options, m, *throughput, *latency, tolerance, tail))) {
+            std::fprintf(stderr, "%s: cannot write baseline\n", options.write_baseline_path.c_str());
+            status = 2;
+        }
+    }
+
+    if (!options.baseline_path.empty()) {
+        Baseline baseline;
+        if (!load_baseline(options.baseline_path, baseline)) {
+            std::fprintf(stderr, "%s: missing or malformed baseline\n", options.baseline_path.c_str());
+            return 2;
+        }
+        if (baseline.symbols != options.symbols || baseline.feeds != options.feeds ||
+            baseline.cycles != options.cycles || baseline.rate != options.rate) {
+            std::fprintf(stderr, "%s: recorded with a different session (symbols/feeds/cycles/rate)\n",
+                         options.baseline_path.c_str());
+            return 2;
+        }
+        if (!gate(options, m, baseline)) {
+            status = std::max(status, 1);
+        }
+    }
+    return status;
+}
@@ -0,0 +1,42 @@
+/*
+ * ===================================================================
+ *                    BATCH CHAIN PRICING COLUMNS
+ * ===================================================================
+ *
+ * Structure-of-arrays views taken by OptionsCalculator::price_chain.
+ * Plain data only: the SIMD kernel translation units include this
+ * header and nothing heavier, so no inline function elsewhere in the
+ * tree is ever compiled with their wider instruction set.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hft::strategy {
+
+// Structure-of-arrays view over an option chain for batch pricing
+struct ChainPricingInput {
+    const double* spot;            // Underlying price
+    const double* strike;          // Strike price
+    const double* time_to_expiry;  // Years to expiration
+    const double* rate;            // Continuously compounded risk-free rate
+    const double* volatility;      // Annualized volatility
+    const uint8_t* is_call;        // 1 = call, 0 = put
+    size_t count;
+};
+
+// Output columns for batch pricing (each must hold `count` entries)
+struct ChainPricingOutput {
+    double* price;
+    double* delta;
+    double* gamma;
+    double* theta;   // Per year
+    double* vega;    // Per 1.00 change in volatility
+    double* rho;     // Per 1.00 change in rate
+};
+
+} // namespace hft::strategy
@@ -0,0 +1,90 @@
+/*
+ * ===================================================================
+ *                  CPU TOPOLOGY AND THREAD PLACEMENT
+ * ===================================================================
+ *
+ * Where hot threads run and where their memory lives
+ *
+ * FEATURES:
+ * - CPU / NUMA node map and isolated (isolcpus) cores, read once from
+ *   sysfs; machines without it look like one node holding every CPU
+ * - Thread pinning for feed, worker, strategy and execution threads
+ * - Node placement for page-backed buffers (ring storage): pages are
+ *   given a preferred node before first touch, so they fault in next
+ *   to the consumer instead of wherever the constructor ran
+ * - Idle step for polling loops: spin with pause on dedicated cores,
+ *   yield everywhere else
+ *
+ * Placement is best effort: a refused affinity or memory policy leaves
+ * the thread or buffer where it was and reports false.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace hft::data {
+
+class CpuTopology {
+public:
+    // Detected on first use
+    static const CpuTopology& instance();
+
+    size_t cpu_count() const { return node_of_cpu_.size(); }
+    size_t node_count() const { return cpus_of_node_.size(); }
+    bool is_numa() const { return cpus_of_node_.size() > 1; }
+
+    int node_of_cpu(int cpu) const;                       // -1 for unknown CPUs
+    const std::vector<int>& cpus_of_node(int node) const; // Empty for unknown nodes
+    const std::vector<int>& isolated_cpus() const { return isolated_; }
+    bool is_isolated(int cpu) const;
+
+    // count CPUs this process may run on, isolated ones first, then the
+    // rest from the highest id down (CPU 0 takes most interrupts), on
+    // node when given. Fewer when not enough are available.
+    std::vector<int> select_cpus(size_t count, int node = -1) const;
+
+    // "0-3,8,10-11" (sysfs / isolcpus syntax); empty on malformed input
+    static std::vector<int> parse_cpu_list(std::string_view list);
+
+    // Explicit layout (tests, unusual machines)
+    CpuTopology(std::vector<std::vector<int>> cpus_of_node, std::vector<int> isolated);
+
+private:
+    CpuTopology() = default;
+    static CpuTopology detect();
+
+    std::vector<int> node_of_cpu_;                 // By CPU id
+    std::vector<std::vector<int>> cpus_of_node_;   // By node id
+    std::vector<int> isolated_;
+};
+
+// Pin a thread to one CPU; false when cpu < 0 or the kernel refuses
+bool pin_thread(std::thread& thread, int cpu);
+bool pin_current_thread(int cpu);
+int current_cpu();                                 // -1 when unknown
+
+// Prefer node for the (untouched) pages of [data, data + bytes)
+bool bind_memory_to_node(void* data, size_t bytes, int node);
+
+// One idle iteration of a polling loop
+inline void idle_wait(bool busy_poll) {
+    if (busy_poll) {
+#if defined(__x86_64__) || defined(_M_X64)
+        _mm_pause();
+#endif
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+} // namespace hft::data
@@ -0,0 +1,66 @@
+/*
+ * ===================================================================
+ *                   PARALLEL CSV TICK PARSER
+ * ===================================================================
+ *
+ * Bulk parser for vendor tick dumps (historical loads, custom feeds)
+ *
+ * ROW FORMAT (header line optional):
+ *   timestamp_ns,bid,ask,last,bid_size,ask_size,volume[,sequence,exchange_id]
+ *
+ * PERFORMANCE FEATURES:
+ * - Input split on newline boundaries, one chunk per thread
+ * - Two passes: SIMD newline count sizes the output exactly, then every
+ *   thread parses straight into its slice of the caller's vector
+ * - 16-byte SIMD delimiter scan (SSE2 baseline on x86-64)
+ * - Prices parsed as fixed point into Price::value basis points,
+ *   no double round-trip
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hft::data {
+
+struct CsvParseResult {
+    size_t rows = 0;             // Ticks written
+    size_t rejected = 0;         // Non-empty lines that failed to parse
+    bool first_line_rejected = false;  // Typically a header row
+};
+
+class CsvTickParser {
+public:
+    struct Config {
+        size_t num_threads;
+        size_t min_chunk_bytes;  // Inputs smaller than this per thread use fewer threads
+
+        Config() : num_threads(0), min_chunk_bytes(1 << 20) {}  // 0 = hardware concurrency
+    };
+
+    // Parse a whole buffer, appending ticks to out in file order
+    static CsvParseResult parse(const char* data, size_t size, uint32_t symbol_id,
+                                std::vector<MarketTick>& out, const Config& config = Config{});
+
+    // Map and parse a file; false when it cannot be opened
+    static bool parse_file(const std::string& path, uint32_t symbol_id,
+                           std::vector<MarketTick>& out, CsvParseResult& result,
+                           const Config& config = Config{});
+
+    // One row without its line terminator
+    static bool parse_row(const char* begin, const char* end, uint32_t symbol_id, MarketTick& tick);
+
+    // Decimal text to basis points (4 places, half-up rounding beyond)
+    static bool parse_price(const char* begin, const char* end, int64_t& value);
+
+    // Number of '\n' in [begin, end)
+    static size_t count_lines(const char* begin, const char* end);
+};
+
+} // namespace hft::data
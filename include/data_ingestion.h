@@ -12,7 +12,7 @@
  * - Lock-free data distribution
  * - Market data normalization
  * - Feed failover and redundancy
- * - Real-time data validation
+ * - Real-time data validation (branch-free batch checks)
  * 
  * SUPPORTED FEEDS:
  * - IEX Cloud API (real-time quotes)
@@ -27,6 +27,10 @@
 
 #include "hft_straddle_system.h"
 #include "market_data.h"
+#include "tick_archive.h"
+#include "latency_tracker.h"
+#include <algorithm>
+#include <array>
 #include <string>
 #include <vector>
 #include <functional>
@@ -34,13 +38,22 @@
 #include <atomic>
 #include <queue>
 #include <memory>
+#include <mutex>
+#include <string_view>
 
 namespace hft::data {
 
+class DataIngestionEngine;
+
 // Data feed interface for different providers
 class IDataFeed {
 public:
     virtual ~IDataFeed() = default;
+    
+    // Called by DataIngestionEngine::add_feed; feeds that publish straight
+    // into the engine's ring keep the pointer
+    virtual void attach(DataIngestionEngine*) {}
+    
     virtual bool connect() = 0;
     virtual void disconnect() = 0;
     virtual bool is_connected() const = 0;
@@ -60,28 +73,162 @@ enum class DataEventType : uint8_t {
     ERROR = 5
 };
 
-// Event structure for data distribution
+// Event structure for data distribution.
+// Tagged union: OPTION_TICK events carry option_tick, every other type
+// carries market_tick. The header sits on its own cache line, so copying
+// a market event moves two lines instead of the whole slot.
 struct alignas(64) DataEvent {
     DataEventType type;
-    Timestamp timestamp;
-    uint32_t symbol_id;
+    uint32_t symbol_id;         // Mapped symbol; an option's underlying (contract id is in option_tick)
+    Timestamp timestamp;        // Receive time (zero when not stamped)
+
+    union {
+        MarketTick market_tick;
+        OptionTick option_tick;
+    };
+
+    DataEvent() : type(DataEventType::MARKET_TICK), symbol_id(0), market_tick() {}
+
+    // Live path: stamp the event with the current receive time
+    DataEvent(DataEventType t, const MarketTick& tick)
+        : DataEvent(t, tick, Timestamp::now()) {}
+
+    DataEvent(DataEventType t, const OptionTick& tick)
+        : DataEvent(t, tick, Timestamp::now()) {}
+
+    // Replay path: caller supplies the time, no clock read
+    DataEvent(DataEventType t, const MarketTick& tick, Timestamp received)
+        : type(t), symbol_id(tick.symbol_id), timestamp(received), market_tick(tick) {}
+
+    DataEvent(DataEventType t, const OptionTick& tick, Timestamp received)
+        : type(t), symbol_id(tick.underlying_id), timestamp(received), option_tick(tick) {}
+
+    DataEvent(const DataEvent& other) { copy_from(other); }
+
+    DataEvent& operator=(const DataEvent& other) {
+        copy_from(other);
+        return *this;
+    }
+
+    bool is_option() const { return type == DataEventType::OPTION_TICK; }
+    bool is_market_data() const {
+        return type == DataEventType::MARKET_TICK || type == DataEventType::TRADE;
+    }
+
+private:
+    // Copy only the active payload
+    void copy_from(const DataEvent& other) {
+        type = other.type;
+        symbol_id = other.symbol_id;
+        timestamp = other.timestamp;
+        if (other.is_option()) {
+            option_tick = other.option_tick;
+        } else {
+            market_tick = other.market_tick;
+        }
+    }
+};
+
+// Batch consumer installed on DataIngestionEngine
+struct EventSink {
+    void (*dispatch)(void* context, const DataEvent* events, size_t count) = nullptr;
+    void* context = nullptr;
+
+    explicit operator bool() const { return dispatch != nullptr; }
+};
+
+// Market data validator.
+// Thresholds are held in integer basis points and every rule is evaluated
+// on the raw fixed-point quote, with no division. Batch mode checks up to
+// BATCH_SIZE ticks at a time and returns a rejection bitmask. Price jumps are measured against a per-symbol table
+// of the last accepted quote, and option quotes against their
+// underlying's entry in the same table.
+//
+// Threading: one validator per validating thread (the engine keeps one
+// per publishing thread). Symbol state and counters are that thread's;
+// the counters are published once per call and can be read from any
+// thread.
+class DataValidator {
+public:
+    // Validation rules
+    struct ValidationRules {
+        double max_price_change_pct;
+        double min_bid_ask_ratio;
+        double max_spread_pct;
+        uint32_t min_volume;
+        uint32_t max_volume;
+        
+        ValidationRules() : max_price_change_pct(20.0),
+                           min_bid_ask_ratio(0.01),
+                           max_spread_pct(5.0),
+                           min_volume(1),
+                           max_volume(1000000000) {}
+    };
     
-    // Use variant instead of union for C++17 compatibility
-    MarketTick market_tick;
-    OptionTick option_tick;
+    static constexpr size_t BATCH_SIZE = 64;                  // Ticks per rejection mask
+    static constexpr int64_t MAX_QUOTE = int64_t(1) << 36;    // Price units (~$6.87M); higher quotes are rejected
+    static constexpr int64_t MAX_THRESHOLD_BP = 65535;        // Rule thresholds are clamped to this
+    
+    // The rules as integer basis points (what the checks compare against)
+    struct Thresholds {
+        int64_t max_jump_bp;
+        int64_t min_ratio_bp;
+        int64_t max_spread_bp;
+        int64_t min_volume;
+        int64_t max_volume;
+    };
     
-    DataEvent() : type(DataEventType::MARKET_TICK), timestamp(Timestamp::now()), symbol_id(0) {}
+    explicit DataValidator(const ValidationRules& rules = ValidationRules{});
     
-    DataEvent(DataEventType t, const MarketTick& tick) 
-        : type(t), timestamp(Timestamp::now()), symbol_id(tick.symbol_id), market_tick(tick) {}
-        
-    DataEvent(DataEventType t, const OptionTick& tick) 
-        : type(t), timestamp(Timestamp::now()), symbol_id(tick.symbol_id), option_tick(tick) {}
+    // One tick at a time. The market check measures the jump from
+    // prev_tick when given and leaves the symbol table alone; the option
+    // check bounds the quote by the given underlying.
+    bool validate_market_tick(const MarketTick& tick, const MarketTick* prev_tick = nullptr);
+    bool validate_option_tick(const OptionTick& tick, const MarketTick& underlying);
+    
+    // ---- Batch mode ----
+    // Bit i of the result is set when tick i is rejected; count <= BATCH_SIZE.
+    // Accepted market ticks become their symbol's last good quote, in order.
+    uint64_t validate_market_batch(const MarketTick* ticks, size_t count);
+    uint64_t validate_option_batch(const OptionTick* ticks, size_t count);
+    // A ring batch: MARKET_TICK and OPTION_TICK events are checked, every
+    // other type passes
+    uint64_t validate_events(const DataEvent* events, size_t count);
+    
+    // bid + ask of symbol_id's last accepted quote; 0 = none yet
+    int64_t last_good_quote(uint32_t symbol_id) const {
+        return symbol_id < last_good_.size() ? last_good_[symbol_id] : 0;
+    }
+    void reset_symbols() { last_good_.fill(0); }
+    
+    // Batch kernel: scalar by default. The AVX2 kernel (when built in and
+    // supported) gives the same results but has measured no faster, since
+    // the transpose and exact-double conversions cost what the width saves.
+    bool is_vectorized() const { return vectorized_; }
+    void set_vectorized(bool enabled);
+    
+    // Get validation statistics
+    uint64_t get_validated_count() const { return validated_count_.load(std::memory_order_relaxed); }
+    uint64_t get_rejected_count() const { return rejected_count_.load(std::memory_order_relaxed); }
+    double get_rejection_rate() const;
+    const Thresholds& get_thresholds() const { return thresholds_; }
+    
+private:
+    ValidationRules rules_;
+    Thresholds thresholds_;
+    bool vectorized_;
+    std::array<int64_t, constants::MAX_SYMBOLS> last_good_{};
+    
+    // Single writer (the owning thread): plain stores, no RMW
+    std::atomic<uint64_t> validated_count_{0};
+    std::atomic<uint64_t> rejected_count_{0};
+    
+    uint64_t count(size_t checked, uint64_t rejected);
 };
 
 // High-performance data ingestion engine
 class DataIngestionEngine {
-private:
+public:
     // Configuration
     struct Config {
         size_t num_worker_threads;
@@ -89,26 +236,70 @@ private:
         bool enable_market_data;
         bool enable_options_data;
         bool enable_level2_data;
+        bool enable_hugepages;
         std::vector<std::string> tech_symbols;
         
+        // Placement: worker i runs on worker_cpus[i % size] (empty = not
+        // pinned) and the ring lives on the first worker's NUMA node.
+        // busy_poll spins instead of yielding when the ring is empty;
+        // use it on dedicated (isolcpus) cores only.
+        std::vector<int> worker_cpus;
+        bool busy_poll;
+        
+        // Per-stage latency percentiles (LatencyTracker) written to
+        // std::clog every interval while running; 0 = no periodic dump
+        uint32_t latency_report_interval_ms;
+        
+        // Ticks are validated on the thread that publishes them, before
+        // the ring (one DataValidator per publishing thread, so each
+        // stream's symbols have a single writer and are checked in
+        // publication order); rejected ones never reach the workers
+        bool validate_data;
+        DataValidator::ValidationRules validation_rules;
+        
         Config() : num_worker_threads(4), 
                    buffer_size(1024 * 1024),
                    enable_market_data(true),
                    enable_options_data(true),
                    enable_level2_data(false),
+                   enable_hugepages(false),
                    tech_symbols{"AAPL", "GOOGL", "MSFT", "AMZN", "TSLA", 
-                               "NVDA", "META", "NFLX", "CRM", "ADBE"} {}
+                               "NVDA", "META", "NFLX", "CRM", "ADBE"},
+                   busy_poll(false),
+                   latency_report_interval_ms(0),
+                   validate_data(false) {}
     };
     
+private:
     Config config_;
     std::atomic<bool> running_{false};
     std::vector<std::unique_ptr<IDataFeed>> feeds_;
     std::vector<std::thread> worker_threads_;
     
-    // Lock-free event distribution
-    CircularBuffer<DataEvent, 1024 * 1024> event_buffer_;
+    // Lock-free event distribution (every feed produces, every worker consumes)
+    static constexpr size_t EVENT_BUFFER_SIZE = 1024 * 1024;
+    static constexpr size_t WORKER_BATCH_SIZE = 64;
+    MPMCRingBuffer<DataEvent, EVENT_BUFFER_SIZE> event_buffer_;
+    EventSink event_sink_;
     std::vector<std::function<void(const DataEvent&)>> subscribers_;
     
+    // With validate_data: one per publishing thread, claimed on its first
+    // publish (or register_publisher) and handed to a later thread when
+    // it exits. Counters are summed over all of them on read.
+    struct Publisher {
+        explicit Publisher(const DataValidator::ValidationRules& rules) : validator(rules) {}
+        std::atomic<bool> owned{true};
+        DataValidator validator;
+        std::array<DataEvent, WORKER_BATCH_SIZE> staging;   // publish_in_place decodes here
+    };
+    static_assert(WORKER_BATCH_SIZE <= DataValidator::BATCH_SIZE, "One rejection mask per staging batch");
+    static constexpr size_t MAX_PUBLISHERS = 64;
+    const uint64_t instance_id_;                             // Keys each thread's publisher cache
+    std::mutex publishers_mutex_;                            // Claiming only
+    std::vector<std::shared_ptr<Publisher>> publisher_storage_;
+    std::array<std::atomic<Publisher*>, MAX_PUBLISHERS> publishers_{};   // Lock-free reads
+    std::atomic<size_t> publisher_count_{0};
+    
     // Symbol mapping
     SymbolMapper symbol_mapper_;
     
@@ -118,13 +309,18 @@ private:
     // Performance monitoring
     std::atomic<uint64_t> events_processed_{0};
     std::atomic<uint64_t> events_dropped_{0};
+    std::atomic<uint64_t> events_rejected_{0};    // Only those no publisher could validate
+    std::atomic<size_t> pinned_workers_{0};
     Timestamp start_time_;
+    std::unique_ptr<LatencyReporter> latency_reporter_;
     
 public:
     explicit DataIngestionEngine(const Config& config = Config{});
     ~DataIngestionEngine();
     
-    // Lifecycle management
+    // Lifecycle management. initialize() is false when a feed fails to
+    // connect or a configured symbol cannot be mapped (longer than
+    // SymbolKey::MAX_LENGTH, or past MAX_SYMBOLS).
     bool initialize();
     void start();
     void stop();
@@ -133,44 +329,130 @@ public:
     void add_feed(std::unique_ptr<IDataFeed> feed);
     void subscribe_symbols(const std::vector<std::string>& symbols);
     
-    // Event subscription
+    // Event subscription (register before start()).
+    // The sink receives every worker batch; see EventPipeline for the
+    // compile-time composed handler list. Sink handlers (the strategy)
+    // are single-threaded, so the sink is refused (false) unless the
+    // engine runs exactly one worker, or while it is running.
+    // std::function subscribers are still supported for cold consumers.
+    bool set_event_sink(EventSink sink);
     void subscribe_to_events(std::function<void(const DataEvent&)> callback);
     
+    // Event publication (thread-safe, callable from any number of feed threads).
+    // Returns what entered the ring: events that do not fit are counted in
+    // events_dropped, ticks that fail validation in events_rejected (and so
+    // are events from a thread past MAX_PUBLISHERS, which cannot validate).
+    bool publish_event(const DataEvent& event);
+    size_t publish_events(const DataEvent* events, size_t count);
+    
+    // Claim the calling thread's validator now rather than on its first
+    // publish; feed threads call it when they start. True without
+    // validate_data.
+    bool register_publisher();
+    
+    // Decode-in-place publication: fill(DataEvent& slot, size_t i) writes
+    // event i directly into its ring slot (no intermediate copy). With
+    // validate_data, events are decoded into the thread's staging batch
+    // and only the accepted ones copied in.
+    template<typename Fill>
+    size_t publish_in_place(size_t count, Fill&& fill) {
+        if (config_.validate_data) {
+            return publish_staged(count, fill);
+        }
+        size_t accepted = 0;
+        while (accepted < count) {
+            const size_t n = event_buffer_.emplace_n(count - accepted, [&](DataEvent& slot, size_t i) {
+                fill(slot, accepted + i);
+            });
+            if (n == 0) {
+                break;
+            }
+            accepted += n;
+        }
+        if (accepted < count) {
+            events_dropped_.fetch_add(count - accepted, std::memory_order_relaxed);
+        }
+        return accepted;
+    }
+    
+    // Symbol ids used in published events
+    SymbolMapper& get_symbol_mapper() { return symbol_mapper_; }
+    
     // Data access
     bool get_latest_market_data(const std::string& symbol, MarketTick& tick);
     bool get_latest_option_data(const std::string& symbol, OptionTick& tick);
     std::vector<Price> get_price_history(const std::string& symbol, size_t count);
+    Span<Price> get_price_history(std::string_view symbol, size_t count, MonotonicArena& arena);
     
     // Performance metrics
     uint64_t get_events_processed() const { return events_processed_.load(); }
     uint64_t get_events_dropped() const { return events_dropped_.load(); }
+    uint64_t get_events_validated() const;   // Summed over the publishing threads
+    uint64_t get_events_rejected() const;
+    size_t get_pinned_workers() const { return pinned_workers_.load(); }
+    int get_buffer_node() const { return event_buffer_.numa_node(); }   // -1 when not placed
     double get_processing_rate() const;
+    // Feed, worker, strategy and order stages across every thread
+    void get_latency_report(LatencyReport& out) const { LatencyTracker::report(out); }
     
 private:
-    void worker_thread_main();
-    void process_event(const DataEvent& event);
+    void worker_thread_main(int cpu);
+    // Calling thread's publisher; nullptr when MAX_PUBLISHERS are held
+    Publisher* local_publisher();
+    std::shared_ptr<Publisher> claim_publisher();
+    // Validates staged[0, count) and pushes the accepted events
+    size_t commit_staged(Publisher& publisher, DataEvent* staged, size_t count);
+    size_t push_events(const DataEvent* events, size_t count);
+    
+    template<typename Fill>
+    size_t publish_staged(size_t count, Fill& fill) {
+        Publisher* publisher = local_publisher();
+        if (!publisher) {
+            events_rejected_.fetch_add(count, std::memory_order_relaxed);
+            return 0;
+        }
+        size_t published = 0;
+        for (size_t done = 0; done < count;) {
+            const size_t n = std::min(count - done, publisher->staging.size());
+            for (size_t i = 0; i < n; ++i) {
+                publisher->staging[i] = DataEvent();   // As a fresh ring slot
+                fill(publisher->staging[i], done + i);
+            }
+            published += commit_staged(*publisher, publisher->staging.data(), n);
+            done += n;
+        }
+        return published;
+    }
+    void process_batch(const DataEvent* events, size_t count);
     void distribute_event(const DataEvent& event);
 };
 
-// IEX Cloud data feed implementation
+// IEX Cloud REST feed (backup data).
+// Every poll cycle sends all subscribed symbols' requests at once over
+// persistent keep-alive connections (multiplexed on one connection when
+// the server speaks HTTP/2) and parses each response in place from its
+// reused receive buffer; the steady state does not allocate. Needs
+// libcurl (HAS_CURL); without it connect() fails.
 class IEXCloudFeed : public IDataFeed {
-private:
-    std::string api_token_;
-    std::string base_url_ = "https://cloud.iexapis.com/stable";
-    std::vector<std::string> subscribed_symbols_;
-    std::atomic<bool> connected_{false};
-    std::atomic<bool> running_{false};
-    std::thread polling_thread_;
-    
-    // Callback for data events
-    std::function<void(const MarketTick&)> market_callback_;
-    std::function<void(const OptionTick&)> option_callback_;
-    
 public:
-    explicit IEXCloudFeed(const std::string& token);
+    struct Config {
+        std::string base_url;            // http(s)://host[:port]/path prefix
+        uint32_t poll_interval_ms;
+        bool fetch_options;              // Also request each symbol's chain
+        std::string options_expiration;  // Chain endpoint suffix (YYYYMM or YYYYMMDD)
+        size_t max_connections;          // Per host; 1 = strictly one keep-alive connection
+        
+        Config() : base_url("https://cloud.iexapis.com/stable"),
+                   poll_interval_ms(1000),
+                   fetch_options(false),
+                   max_connections(1) {}
+    };
+    
+    explicit IEXCloudFeed(const std::string& token, const Config& config = Config{});
     ~IEXCloudFeed();
     
     // IDataFeed interface
+    void attach(DataIngestionEngine* engine) override;
     bool connect() override;
     void disconnect() override;
     bool is_connected() const override { return connected_.load(); }
@@ -179,7 +461,7 @@ public:
     void start_feed() override;
     void stop_feed() override;
     
-    // Callbacks
+    // Callbacks (feed thread); attached feeds also publish to the engine
     void set_market_callback(std::function<void(const MarketTick&)> callback) {
         market_callback_ = callback;
     }
@@ -188,30 +470,94 @@ public:
         option_callback_ = callback;
     }
     
+    // ---- Response parsing (in place, no allocation) ----
+    // /stock/{symbol}/quote body. Fields the body leaves null stay as they
+    // were in tick; false when malformed or without a price.
+    static bool parse_quote(std::string_view json, MarketTick& tick);
+    
+    // /stock/{symbol}/options/{expiration} body, replacing the contents of
+    // out (its capacity is reused). today is YYYYMMDD, for days_to_expiry.
+    static bool parse_options_chain(std::string_view json, uint32_t underlying_id, uint32_t today,
+                                    std::vector<OptionTick>& out);
+    
+    // ---- Statistics ----
+    uint64_t get_poll_cycles() const { return poll_cycles_.load(std::memory_order_relaxed); }
+    uint64_t get_responses() const { return responses_.load(std::memory_order_relaxed); }
+    uint64_t get_request_failures() const { return request_failures_.load(std::memory_order_relaxed); }
+    uint64_t get_parse_failures() const { return parse_failures_.load(std::memory_order_relaxed); }
+    
 private:
+    struct Transport;   // libcurl handles, one reused request per endpoint
+    
     void polling_loop();
-    std::string make_request(const std::string& endpoint);
-    MarketTick parse_quote(const std::string& json_data, const std::string& symbol);
-    std::vector<OptionTick> parse_options_chain(const std::string& json_data, const std::string& symbol);
+    void rebuild_requests();
+    void poll_once();
+    void handle_response(size_t request);
+    
+    std::string api_token_;
+    Config config_;
+    std::unique_ptr<Transport> transport_;
+    DataIngestionEngine* engine_ = nullptr;
+    SymbolMapper own_symbols_;
+    SymbolMapper* symbols_;
+    
+    std::mutex subscriptions_mutex_;
+    std::vector<std::string> subscribed_symbols_;
+    std::atomic<bool> subscriptions_changed_{false};
+    
+    std::atomic<bool> connected_{false};
+    std::atomic<bool> running_{false};
+    std::thread polling_thread_;
+    
+    // Callback for data events
+    std::function<void(const MarketTick&)> market_callback_;
+    std::function<void(const OptionTick&)> option_callback_;
+    std::vector<OptionTick> chain_;      // Reused chain storage
+    
+    std::atomic<uint64_t> poll_cycles_{0};
+    std::atomic<uint64_t> responses_{0};
+    std::atomic<uint64_t> request_failures_{0};
+    std::atomic<uint64_t> parse_failures_{0};
 };
 
-// Historical data loader for backtesting
+// Historical data loader for backtesting.
+// Binary archives (see tick_archive.h) are memory-mapped and queried in
+// place; CSV files are parsed into memory. load_symbol() prefers
+// <data_dir>/<SYMBOL>.htick and converts <SYMBOL>.csv to it on first use.
 class HistoricalDataLoader {
 private:
+    struct ArchivedSeries {
+        const TickArchive* archive;
+        const archive_format::SymbolEntry* entry;
+    };
+
     std::string data_directory_;
+    SymbolMapper own_symbols_;
+    SymbolMapper* symbols_;
     std::unordered_map<std::string, std::vector<MarketTick>> historical_data_;
+    std::vector<std::unique_ptr<TickArchive>> archives_;
+    std::unordered_map<std::string, ArchivedSeries> archived_data_;
+    
+    std::string resolve_path(const std::string& filename) const;
     
 public:
-    explicit HistoricalDataLoader(const std::string& data_dir);
+    // Tick symbol ids come from symbols when given (e.g. the engine's mapper)
+    explicit HistoricalDataLoader(const std::string& data_dir, SymbolMapper* symbols = nullptr);
+    ~HistoricalDataLoader();
     
     // Load data from various formats
     bool load_csv_data(const std::string& filename, const std::string& symbol);
     bool load_binary_data(const std::string& filename);
+    bool load_symbol(const std::string& symbol);
     
-    // Data access
-    std::vector<MarketTick> get_historical_data(const std::string& symbol, 
-                                               const Timestamp& start, 
-                                               const Timestamp& end) const;
+    // Write every CSV-loaded series to one archive (one-shot conversion)
+    bool save_binary_data(const std::string& filename) const;
+    static constexpr const char* ARCHIVE_EXTENSION = ".htick";
+    
+    // Data access: ticks with start <= timestamp <= end, viewed in place
+    TickRange get_historical_data(const std::string& symbol, 
+                                  const Timestamp& start, 
+                                  const Timestamp& end) const;
     
     // Statistics
     size_t get_data_points(const std::string& symbol) const;
@@ -219,44 +565,6 @@ public:
     Timestamp get_latest_timestamp(const std::string& symbol) const;
 };
 
-// Market data validator
-class DataValidator {
-public:
-    // Validation rules
-    struct ValidationRules {
-        double max_price_change_pct;
-        double min_bid_ask_ratio;
-        double max_spread_pct;
-        uint32_t min_volume;
-        uint32_t max_volume;
-        
-        ValidationRules() : max_price_change_pct(20.0),
-                           min_bid_ask_ratio(0.01),
-                           max_spread_pct(5.0),
-                           min_volume(1),
-                           max_volume(1000000000) {}
-    };
-    
-    explicit DataValidator(const ValidationRules& rules = ValidationRules{});
-    
-    // Validation functions
-    bool validate_market_tick(const MarketTick& tick, const MarketTick* prev_tick = nullptr);
-    bool validate_option_tick(const OptionTick& tick, const MarketTick& underlying);
-    
-    // Get validation statistics
-    uint64_t get_validated_count() const { return validated_count_.load(); }
-    uint64_t get_rejected_count() const { return rejected_count_.load(); }
-    double get_rejection_rate() const;
-    
-private:
-    ValidationRules rules_;
-    std::atomic<uint64_t> validated_count_{0};
-    std::atomic<uint64_t> rejected_count_{0};
-    
-    bool is_price_reasonable(const Price& price, const Price& prev_price) const;
-    bool is_spread_reasonable(const Price& bid, const Price& ask) const;
-};
-
 // Data feed factory
 class DataFeedFactory {
 public:
@@ -265,9 +573,13 @@ public:
         ALPHA_VANTAGE,
         YAHOO_FINANCE,
         CUSTOM_CSV,
-        SIMULATION
+        SIMULATION,
+        MULTICAST
     };
     
+    // nullptr for feed types not built into this binary or bad parameters.
+    // MULTICAST params: "a=<group>:<port>[;b=<group>:<port>][;iface=<addr>][;rcvbuf=<bytes>]"
+    // IEX_CLOUD params: "token=<token>[;url=<base url>][;interval_ms=<ms>][;options=<expiration>]"
     static std::unique_ptr<IDataFeed> create_feed(FeedType type, 
                                                  const std::string& config_params);
     
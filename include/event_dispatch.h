@@ -0,0 +1,165 @@
+/*
+ * ===================================================================
+ *                   COMPILE-TIME EVENT DISPATCH
+ * ===================================================================
+ *
+ * Routes DataEvents straight to handler member functions
+ *
+ * A handler is any type with on_market_data(const data::MarketTick&)
+ * and/or on_options_data(const data::OptionTick&) - StraddleStrategy
+ * qualifies as-is. EventPipeline<A, B, C> unrolls delivery over its
+ * handlers at compile time, so each call is direct and inlinable:
+ *
+ *     EventPipeline<StraddleStrategy, RiskMonitor> pipeline(strategy, risk);
+ *     pipeline.route_only<1>({aapl_id, msft_id});
+ *     engine.set_event_sink(pipeline.sink());   // Engine with one worker
+ *
+ * Handlers run on the engine's worker thread and are not synchronized,
+ * so the engine only takes a sink when it runs a single worker.
+ *
+ * ROUTING:
+ * - By type: handlers without a method for an event type never see it
+ * - By symbol: one bitmask per symbol id, bit i set when handler i
+ *   wants that symbol (every symbol by default). Option events carry
+ *   their underlying's id in DataEvent::symbol_id: contract ids are
+ *   exchange ids or hashes, not mapped symbols.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "data_ingestion.h"
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hft::data {
+
+namespace detail {
+
+template<typename H, typename = void>
+struct handles_market_data : std::false_type {};
+
+template<typename H>
+struct handles_market_data<H, std::void_t<decltype(
+    std::declval<H&>().on_market_data(std::declval<const MarketTick&>()))>> : std::true_type {};
+
+template<typename H, typename = void>
+struct handles_options_data : std::false_type {};
+
+template<typename H>
+struct handles_options_data<H, std::void_t<decltype(
+    std::declval<H&>().on_options_data(std::declval<const OptionTick&>()))>> : std::true_type {};
+
+} // namespace detail
+
+template<typename... Handlers>
+class EventPipeline {
+    static_assert(sizeof...(Handlers) > 0, "EventPipeline needs at least one handler");
+    static_assert(sizeof...(Handlers) <= 32, "routing masks hold at most 32 handlers");
+    static_assert(((detail::handles_market_data<Handlers>::value ||
+                    detail::handles_options_data<Handlers>::value) && ...),
+                  "every handler needs on_market_data and/or on_options_data");
+
+public:
+    using RouteMask = uint32_t;
+    static constexpr size_t HANDLER_COUNT = sizeof...(Handlers);
+    static constexpr RouteMask ALL_HANDLERS =
+        HANDLER_COUNT == 32 ? ~RouteMask(0) : (RouteMask(1) << HANDLER_COUNT) - 1;
+
+    explicit EventPipeline(Handlers&... handlers) : handlers_(handlers...) {
+        symbol_routes_.fill(ALL_HANDLERS);
+    }
+
+    // Deliver symbol_id to handler I or not
+    template<size_t I>
+    void route(uint32_t symbol_id, bool enabled) {
+        static_assert(I < HANDLER_COUNT, "handler index out of range");
+        if (symbol_id >= symbol_routes_.size()) return;
+        if (enabled) {
+            symbol_routes_[symbol_id] |= RouteMask(1) << I;
+        } else {
+            symbol_routes_[symbol_id] &= ~(RouteMask(1) << I);
+        }
+    }
+
+    // Restrict handler I to exactly these symbols
+    template<size_t I>
+    void route_only(const std::vector<uint32_t>& symbol_ids) {
+        static_assert(I < HANDLER_COUNT, "handler index out of range");
+        for (auto& mask : symbol_routes_) {
+            mask &= ~(RouteMask(1) << I);
+        }
+        for (uint32_t id : symbol_ids) {
+            route<I>(id, true);
+        }
+    }
+
+    void dispatch(const DataEvent& event) {
+        const uint32_t symbol_id = event.symbol_id;
+        const RouteMask mask = symbol_id < symbol_routes_.size() ? symbol_routes_[symbol_id] : 0;
+        if (mask == 0) {
+            return;
+        }
+        if (event.is_option()) {
+            deliver_options(event.option_tick, mask, std::index_sequence_for<Handlers...>{});
+        } else if (event.is_market_data()) {
+            deliver_market(event.market_tick, mask, std::index_sequence_for<Handlers...>{});
+        }
+    }
+
+    void dispatch(const DataEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            dispatch(events[i]);
+        }
+    }
+
+    // Batch sink for DataIngestionEngine::set_event_sink (pipeline must outlive the engine run)
+    EventSink sink() {
+        return EventSink{&EventPipeline::dispatch_batch, this};
+    }
+
+private:
+    using HandlerTypes = std::tuple<Handlers...>;
+
+    static void dispatch_batch(void* context, const DataEvent* events, size_t count) {
+        static_cast<EventPipeline*>(context)->dispatch(events, count);
+    }
+
+    template<size_t... I>
+    void deliver_market(const MarketTick& tick, RouteMask mask, std::index_sequence<I...>) {
+        (deliver_market_to<I>(tick, mask), ...);
+    }
+
+    template<size_t I>
+    void deliver_market_to(const MarketTick& tick, RouteMask mask) {
+        if constexpr (detail::handles_market_data<std::tuple_element_t<I, HandlerTypes>>::value) {
+            if (mask & (RouteMask(1) << I)) {
+                std::get<I>(handlers_).on_market_data(tick);
+            }
+        }
+    }
+
+    template<size_t... I>
+    void deliver_options(const OptionTick& tick, RouteMask mask, std::index_sequence<I...>) {
+        (deliver_options_to<I>(tick, mask), ...);
+    }
+
+    template<size_t I>
+    void deliver_options_to(const OptionTick& tick, RouteMask mask) {
+        if constexpr (detail::handles_options_data<std::tuple_element_t<I, HandlerTypes>>::value) {
+            if (mask & (RouteMask(1) << I)) {
+                std::get<I>(handlers_).on_options_data(tick);
+            }
+        }
+    }
+
+    std::tuple<Handlers&...> handlers_;
+    std::array<RouteMask, constants::MAX_SYMBOLS> symbol_routes_;
+};
+
+} // namespace hft::data
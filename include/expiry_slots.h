@@ -0,0 +1,53 @@
+/*
+ * ===================================================================
+ *                    BOUNDED EXPIRY SLOTS
+ * ===================================================================
+ *
+ * Date-ordered per-expiry slots with a fixed cap, as kept by
+ * OptionsChain and VolatilitySurface
+ *
+ * EVICTION:
+ * - Full: the earliest expiry goes first, unless the new one is
+ *   earlier still, in which case it is refused
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hft::data {
+
+// Slot for expiration_date (Slot needs an expiration_date member),
+// inserted when new; on_evict(slot) runs before the earliest is dropped.
+// nullptr when the expiry does not fit.
+template<typename Slot, typename OnEvict>
+Slot* expiry_slot(std::vector<Slot>& slots, uint32_t expiration_date, size_t max_slots, OnEvict&& on_evict) {
+    auto it = std::lower_bound(slots.begin(), slots.end(), expiration_date,
+                               [](const Slot& s, uint32_t date) { return s.expiration_date < date; });
+    if (it != slots.end() && it->expiration_date == expiration_date) {
+        return &*it;
+    }
+    if (slots.size() >= max_slots) {
+        if (it == slots.begin()) {
+            return nullptr;
+        }
+        on_evict(slots.front());
+        slots.erase(slots.begin());
+        --it;
+    }
+    it = slots.insert(it, Slot{});
+    it->expiration_date = expiration_date;
+    return &*it;
+}
+
+template<typename Slot>
+Slot* expiry_slot(std::vector<Slot>& slots, uint32_t expiration_date, size_t max_slots) {
+    return expiry_slot(slots, expiration_date, max_slots, [](const Slot&) {});
+}
+
+} // namespace hft::data
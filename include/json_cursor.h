@@ -0,0 +1,82 @@
+/*
+ * ===================================================================
+ *                    ON-DEMAND JSON CURSOR
+ * ===================================================================
+ *
+ * Forward-only reader over a JSON response buffer (REST backup feeds)
+ *
+ * PERFORMANCE FEATURES:
+ * - Never allocates and never builds a DOM: the caller walks the
+ *   document and reads only the fields it wants, skipping the rest
+ * - Strings come back as views into the buffer (escape sequences are
+ *   left in place; field names and tickers never carry any)
+ * - 16-byte SIMD scan for the end of strings (SSE2 baseline on x86-64)
+ * - Prices read as fixed point into Price basis points, no double
+ *   round-trip
+ *
+ * USAGE:
+ *   JsonCursor json(body.data(), body.size());
+ *   std::string_view key;
+ *   if (json.enter_object()) {
+ *       while (json.next_key(key)) {
+ *           if (key == "bid") json.read_price(bid); else json.skip();
+ *       }
+ *   }
+ *   if (!json.ok()) ...   // Malformed input
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace hft::data {
+
+class JsonCursor {
+public:
+    JsonCursor(const char* data, size_t length) : p_(data), end_(data + length) {}
+
+    // False once anything malformed was seen; every later call fails
+    bool ok() const { return ok_; }
+    bool at_end();                              // Only whitespace left
+    char peek();                                // Next value's first character, '\0' at the end
+
+    // ---- Structure ----
+    bool enter_object();                        // Consumes '{'
+    bool enter_array();                         // Consumes '['
+    // Next member of the current object; consumes through the ':'.
+    // False (consuming '}') when the object ends.
+    bool next_key(std::string_view& key);
+    // True when another element of the current array follows (positioned
+    // at its value); false (consuming ']') when the array ends.
+    bool next_element();
+
+    // ---- Values ----
+    // Each read consumes one value. A JSON null, or a value of another
+    // type, is consumed and reported as false without making the cursor
+    // malformed; out is left untouched.
+    bool read_string(std::string_view& out);    // Raw contents between the quotes
+    bool read_price(Price& out);
+    bool read_double(double& out);
+    bool read_uint(uint64_t& out);              // Fractional part truncated
+    bool read_bool(bool& out);
+    bool skip();                                // Any value, nested or not
+
+private:
+    void skip_whitespace();
+    bool fail() { ok_ = false; p_ = end_; return false; }
+    bool consume_literal(const char* literal, size_t length);
+    bool scan_string(const char*& begin, const char*& end);   // At '"'
+    bool scan_number(const char*& begin, const char*& end);
+    bool skip_null_or_other();                  // Type mismatch: skip without failing
+
+    const char* p_;
+    const char* end_;
+    bool ok_ = true;
+};
+
+} // namespace hft::data
@@ -0,0 +1,267 @@
+/*
+ * ===================================================================
+ *                  HOT-PATH LATENCY TRACEPOINTS
+ * ===================================================================
+ *
+ * Per-stage latency distributions from ingest to decision, always on
+ *
+ * FEATURES:
+ * - Stages are timed with the TSC (rdtsc), converted to nanoseconds
+ *   with a ratio calibrated once against Timestamp::now(), during
+ *   static initialization so no tracepoint ever waits for it
+ * - HDR-style log-linear histograms: exact below 128 ns, then 64
+ *   linear sub-buckets per power of two (< 1.6% relative error) up to
+ *   about 68 s; larger values land in the top bucket
+ * - One set of histograms per recording thread. Each thread is the
+ *   only writer of its own counts (plain relaxed stores, no RMW), and
+ *   readers merge every thread's counts lock-free at any time
+ * - Engine workers, feed threads and the order send thread take their
+ *   slot with register_thread() when they start, so their first
+ *   tracepoint does not allocate
+ * - ScopedLatency: RAII tracepoint, ~two TSC reads plus one bucket
+ *   update; set_enabled(false) turns every tracepoint into one load
+ * - report() / format_report() give count, p50, p99, p99.9 and max per
+ *   stage; LatencyReporter dumps that periodically from its own thread
+ *
+ * USAGE:
+ *   void StraddleStrategy::on_market_data(const MarketTick& tick) {
+ *       data::ScopedLatency trace(data::LatencyStage::STRATEGY_TICK);
+ *       ...
+ *   }
+ *   LatencyTracker::report(stats);   // Any thread
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#define HFT_HAS_RDTSC 1
+#endif
+
+namespace hft::data {
+
+enum class LatencyStage : uint8_t {
+    FEED_RECEIVE,       // One received datagram batch decoded and published
+    PROCESS_BATCH,      // Worker: aggregator update and sink for one ring batch
+    DISTRIBUTE_EVENT,   // Worker: std::function subscribers for one event
+    STRATEGY_TICK,      // StraddleStrategy::on_market_data
+    ENTRY_ANALYSIS,     // StraddleStrategy::analyze_entry_opportunity
+    ORDER_SUBMIT,       // OrderRouter submission (producer side)
+    COUNT
+};
+constexpr size_t LATENCY_STAGE_COUNT = static_cast<size_t>(LatencyStage::COUNT);
+
+const char* to_string(LatencyStage stage);
+
+// TSC reads and their calibration against Timestamp (nanoseconds since
+// the epoch). Without a TSC, ticks are steady_clock nanoseconds.
+class TscClock {
+public:
+    static uint64_t now() {
+#ifdef HFT_HAS_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Calibrated at static initialization (blocks for about CALIBRATION_MS)
+    static double ns_per_tick() { return calibration().ns_per_tick; }
+    static uint64_t to_nanoseconds(uint64_t ticks) {
+        return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick());
+    }
+    // TSC reading -> Timestamp::now() scale
+    static uint64_t to_epoch_ns(uint64_t tsc);
+
+    static constexpr uint32_t CALIBRATION_MS = 10;
+
+private:
+    struct Calibration {
+        double ns_per_tick;
+        uint64_t base_tsc;
+        uint64_t base_ns;
+    };
+    static const Calibration& calibration();
+};
+
+// Single-writer histogram of nanosecond values
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BITS = 6;
+    static constexpr uint64_t SUB_COUNT = 1ull << SUB_BITS;
+    static constexpr unsigned MAX_BITS = 36;                      // ~68.7 s
+    static constexpr size_t BUCKETS = (MAX_BITS - SUB_BITS + 1) * SUB_COUNT;
+
+    static size_t bucket_of(uint64_t value) {
+        if (value < 2 * SUB_COUNT) {
+            return static_cast<size_t>(value);
+        }
+        const unsigned exponent = 63u - static_cast<unsigned>(__builtin_clzll(value));
+        if (exponent >= MAX_BITS) {
+            return BUCKETS - 1;
+        }
+        const unsigned shift = exponent - SUB_BITS;
+        return static_cast<size_t>((shift + 1) * SUB_COUNT + ((value >> shift) - SUB_COUNT));
+    }
+    // Smallest and largest value counted in bucket
+    static uint64_t lowest_in(size_t bucket) {
+        if (bucket < 2 * SUB_COUNT) {
+            return bucket;
+        }
+        const unsigned shift = static_cast<unsigned>(bucket / SUB_COUNT) - 1;
+        return (SUB_COUNT + bucket % SUB_COUNT) << shift;
+    }
+    static uint64_t highest_in(size_t bucket) {
+        return bucket + 1 < BUCKETS ? lowest_in(bucket + 1) - 1 : UINT64_MAX;
+    }
+
+    // Owning thread only
+    void record(uint64_t value) {
+        bump(counts_[bucket_of(value)]);
+        bump(total_);
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // Any thread; counts written concurrently may be missed until the next read
+    uint64_t count(size_t bucket) const { return counts_[bucket].load(std::memory_order_relaxed); }
+    uint64_t total() const { return total_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    // Races with the owner's increments; use between measurement runs
+    void reset();
+
+private:
+    static void bump(std::atomic<uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKETS> counts_{};
+    std::atomic<uint64_t> total_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+// Every thread's histogram for one stage, merged
+class HistogramSnapshot {
+public:
+    void add(const LatencyHistogram& histogram);
+
+    uint64_t total() const { return total_; }
+    uint64_t max() const { return max_; }
+    // Value at quantile q in [0, 1] (highest value of its bucket, capped
+    // at the observed max); 0 when empty
+    uint64_t percentile(double q) const;
+
+private:
+    std::array<uint64_t, LatencyHistogram::BUCKETS> counts_{};
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+struct StageLatency {
+    LatencyStage stage;
+    uint64_t count;
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t p999_ns;
+    uint64_t max_ns;
+};
+using LatencyReport = std::array<StageLatency, LATENCY_STAGE_COUNT>;
+
+class LatencyTracker {
+public:
+    static constexpr size_t MAX_THREADS = 64;   // Recording threads alive at once
+
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+    static void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+
+    // Calling thread's histogram for stage; the thread's slot is taken on
+    // first use and handed to a later thread (counts kept) when it exits.
+    // nullptr when MAX_THREADS threads already hold one.
+    static LatencyHistogram* local(LatencyStage stage);
+    // Take the calling thread's slot now rather than at its first
+    // tracepoint; false when every slot is held
+    static bool register_thread();
+
+    static void record(LatencyStage stage, uint64_t nanoseconds) {
+        if (LatencyHistogram* histogram = local(stage)) {
+            histogram->record(nanoseconds);
+        }
+    }
+
+    // Any thread, lock-free
+    static HistogramSnapshot snapshot(LatencyStage stage);
+    static void report(LatencyReport& out);
+    // One line per stage that has samples
+    static std::string format_report(const LatencyReport& report);
+
+    // Zero every stage (see LatencyHistogram::reset)
+    static void reset();
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+// Times the enclosing scope into stage
+class ScopedLatency {
+public:
+    explicit ScopedLatency(LatencyStage stage)
+        : stage_(stage), start_(LatencyTracker::enabled() ? TscClock::now() : 0) {}
+    ~ScopedLatency() {
+        if (start_ != 0) {
+            LatencyTracker::record(stage_, TscClock::to_nanoseconds(TscClock::now() - start_));
+        }
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    LatencyStage stage_;
+    uint64_t start_;
+};
+
+// Periodic dump of LatencyTracker::format_report from its own thread
+class LatencyReporter {
+public:
+    using Sink = std::function<void(const std::string& report)>;
+
+    // Without a sink, reports go to std::clog
+    explicit LatencyReporter(uint32_t interval_ms, Sink sink = nullptr);
+    ~LatencyReporter();
+
+    LatencyReporter(const LatencyReporter&) = delete;
+    LatencyReporter& operator=(const LatencyReporter&) = delete;
+
+    bool start();
+    void stop();              // No final report
+    uint64_t reports_written() const { return reports_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    uint32_t interval_ms_;
+    Sink sink_;
+    std::thread thread_;
+    std::mutex mutex_;                 // Only for waking the sleeping thread
+    std::condition_variable wake_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> reports_{0};
+};
+
+} // namespace hft::data
@@ -19,8 +19,13 @@
 #pragma once
 
 #include "hft_straddle_system.h"
+#include "ring_buffer.h"
+#include "memory_arena.h"
+#include "symbol_mapper.h"
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <cmath>
 #include <array>
 
 namespace hft::data {
@@ -44,27 +49,148 @@ struct alignas(8) Timestamp {
     }
 };
 
+// Wide intermediate for price products / sums that may exceed int64
+__extension__ typedef __int128 int128_t;
+
+// Rounding for integer price arithmetic
+enum class Rounding : uint8_t {
+    TOWARD_ZERO,
+    NEAREST,        // Half away from zero
+    DOWN,           // Toward negative infinity
+    UP              // Toward positive infinity
+};
+
 // Optimized price structure for financial data
+//
+// Integral end to end: arithmetic, scaling and midpoints stay in int64
+// basis points with an explicit rounding rule, and never round-trip
+// through double. to_double() / Price(double) are for the edges only.
 struct alignas(8) Price {
     int64_t value;  // Price in basis points (avoid floating point errors)
     
-    Price() : value(0) {}
-    Price(double price) : value(static_cast<int64_t>(price * 10000)) {}
+    static constexpr int64_t SCALE = 10000;
+    
+    constexpr Price() : value(0) {}
+    Price(double price) : value(static_cast<int64_t>(price * SCALE)) {}  // Truncates
+    
+    static constexpr Price from_basis_points(int64_t bp) { Price p; p.value = bp; return p; }
+    static constexpr Price from_units(int64_t units) { return from_basis_points(units * SCALE); }
+    static Price from_double(double price, Rounding rounding) {
+        const double scaled = price * SCALE;
+        switch (rounding) {
+            case Rounding::TOWARD_ZERO: return from_basis_points(static_cast<int64_t>(scaled));
+            case Rounding::DOWN: return from_basis_points(static_cast<int64_t>(std::floor(scaled)));
+            case Rounding::UP: return from_basis_points(static_cast<int64_t>(std::ceil(scaled)));
+            case Rounding::NEAREST: break;
+        }
+        return from_basis_points(std::llround(scaled));
+    }
+    
+    // Decimal text ("-12.3456"); digits past the fourth decimal are
+    // rounded half-up. False on anything else, leaving out untouched.
+    static constexpr bool parse(const char* begin, const char* end, Price& out) {
+        const char* p = begin;
+        const bool negative = p < end && *p == '-';
+        if (negative) ++p;
+        
+        int64_t whole = 0;
+        const char* digits_start = p;
+        while (p < end && static_cast<unsigned>(*p - '0') <= 9) {
+            if (p - digits_start >= 14) return false;  // Keeps whole * SCALE in range
+            whole = whole * 10 + (*p++ - '0');
+        }
+        bool any_digits = p > digits_start;
+        
+        int64_t fraction = 0;
+        int64_t scale = SCALE;
+        if (p < end && *p == '.') {
+            ++p;
+            const char* fraction_start = p;
+            while (p < end && static_cast<unsigned>(*p - '0') <= 9) {
+                const int digit = *p - '0';
+                if (scale > 1) {
+                    scale /= 10;
+                    fraction += digit * scale;
+                } else if (p - fraction_start == 4 && digit >= 5) {
+                    fraction += 1;  // Half-up on the fifth decimal
+                }
+                ++p;
+            }
+            any_digits |= p > fraction_start;
+        }
+        
+        if (p != end || !any_digits) return false;
+        const int64_t magnitude = whole * SCALE + fraction;
+        out.value = negative ? -magnitude : magnitude;
+        return true;
+    }
+    
+    static constexpr bool parse(std::string_view text, Price& out) {
+        return parse(text.data(), text.data() + text.size(), out);
+    }
+    
+    // num / den with the given rounding; den must be non-zero
+    static constexpr int64_t divide(int128_t num, int64_t den, Rounding rounding) {
+        if (den < 0) { num = -num; den = -den; }
+        const int128_t q = num / den;
+        const int128_t r = num % den;
+        if (r == 0) return static_cast<int64_t>(q);
+        switch (rounding) {
+            case Rounding::TOWARD_ZERO: return static_cast<int64_t>(q);
+            case Rounding::DOWN: return static_cast<int64_t>(r < 0 ? q - 1 : q);
+            case Rounding::UP: return static_cast<int64_t>(r > 0 ? q + 1 : q);
+            case Rounding::NEAREST: break;
+        }
+        const int128_t twice = r < 0 ? -2 * r : 2 * r;
+        return static_cast<int64_t>(twice >= den ? (r < 0 ? q - 1 : q + 1) : q);
+    }
+    
+    constexpr double to_double() const { return static_cast<double>(value) / SCALE; }
+    
+    constexpr Price operator+(const Price& other) const { return from_basis_points(value + other.value); }
+    constexpr Price operator-(const Price& other) const { return from_basis_points(value - other.value); }
+    constexpr Price operator-() const { return from_basis_points(-value); }
+    constexpr Price operator*(int64_t n) const { return from_basis_points(value * n); }
+    constexpr Price& operator+=(const Price& other) { value += other.value; return *this; }
+    constexpr Price& operator-=(const Price& other) { value -= other.value; return *this; }
+    
+    // value * num / den without intermediate overflow
+    constexpr Price scaled(int64_t num, int64_t den, Rounding rounding = Rounding::NEAREST) const {
+        return from_basis_points(divide(static_cast<int128_t>(value) * num, den, rounding));
+    }
+    
+    static constexpr Price midpoint(Price a, Price b, Rounding rounding = Rounding::NEAREST) {
+        return from_basis_points(divide(static_cast<int128_t>(a.value) + b.value, 2, rounding));
+    }
     
-    double to_double() const { return value / 10000.0; }
-    Price operator+(const Price& other) const { return {(value + other.value) / 10000.0}; }
-    Price operator-(const Price& other) const { return {(value - other.value) / 10000.0}; }
-    bool operator>(const Price& other) const { return value > other.value; }
-    bool operator<(const Price& other) const { return value < other.value; }
+    constexpr bool operator>(const Price& other) const { return value > other.value; }
+    constexpr bool operator<(const Price& other) const { return value < other.value; }
+    constexpr bool operator>=(const Price& other) const { return value >= other.value; }
+    constexpr bool operator<=(const Price& other) const { return value <= other.value; }
+    constexpr bool operator==(const Price& other) const { return value == other.value; }
+    constexpr bool operator!=(const Price& other) const { return value != other.value; }
 };
 
+namespace literals {
+
+// 101.25_px; an invalid literal yields Price()
+template<char... Chars>
+constexpr Price operator""_px() {
+    constexpr char text[] = {Chars...};
+    Price price;
+    Price::parse(text, text + sizeof...(Chars), price);
+    return price;
+}
+
+} // namespace literals
+
 // Cache-aligned market data tick - exactly 64 bytes
 struct alignas(64) MarketTick {
     Timestamp timestamp;        // 8 bytes
-    uint32_t symbol_id;        // 4 bytes - mapped from symbol string
     Price bid;                 // 8 bytes
     Price ask;                 // 8 bytes
     Price last;                // 8 bytes
+    uint32_t symbol_id;        // 4 bytes - mapped from symbol string
     uint32_t bid_size;         // 4 bytes
     uint32_t ask_size;         // 4 bytes
     uint32_t volume;           // 4 bytes
@@ -74,14 +200,18 @@ struct alignas(64) MarketTick {
     
     MarketTick() = default;
     
-    // Fast midpoint calculation
+    // Fast midpoint calculation (truncated, as the double path always did)
     Price midpoint() const {
-        return Price((bid.to_double() + ask.to_double()) / 2.0);
+        return Price::midpoint(bid, ask, Rounding::TOWARD_ZERO);
     }
     
     // Bid-ask spread calculation
     double spread() const {
-        return ask.to_double() - bid.to_double();
+        return spread_price().to_double();
+    }
+    
+    Price spread_price() const {
+        return ask - bid;
     }
     
     // Spread as percentage
@@ -91,6 +221,17 @@ struct alignas(64) MarketTick {
     }
 };
 
+static_assert(sizeof(MarketTick) == 64, "MarketTick must fill exactly one cache line");
+
+// Batch mid / spread in basis points, matching MarketTick::midpoint() and
+// spread_price(). Plain integer loops the compiler vectorizes; the
+// columnar overloads take bid / ask columns (e.g. from a decoded archive
+// block) and vectorize with unit-stride loads.
+void compute_midpoints(const MarketTick* ticks, size_t count, int64_t* out);
+void compute_spreads(const MarketTick* ticks, size_t count, int64_t* out);
+void compute_midpoints(const int64_t* bid, const int64_t* ask, size_t count, int64_t* out);
+void compute_spreads(const int64_t* bid, const int64_t* ask, size_t count, int64_t* out);
+
 // Options-specific data structure
 struct alignas(64) OptionTick {
     Timestamp timestamp;        // 8 bytes
@@ -145,109 +286,81 @@ struct VolatilityPoint {
     Timestamp last_update;
 };
 
-// High-performance circular buffer for market data
+// High-performance circular buffer for market data (single producer / single consumer)
 template<typename T, size_t Size>
-class alignas(64) CircularBuffer {
-private:
-    std::array<T, Size> buffer_;
-    std::atomic<size_t> head_{0};
-    std::atomic<size_t> tail_{0};
-    
-public:
-    // Lock-free push operation
-    bool push(const T& item) {
-        size_t current_tail = tail_.load(std::memory_order_relaxed);
-        size_t next_tail = (current_tail + 1) % Size;
-        
-        if (next_tail == head_.load(std::memory_order_acquire)) {
-            return false; // Buffer full
-        }
-        
-        buffer_[current_tail] = item;
-        tail_.store(next_tail, std::memory_order_release);
-        return true;
-    }
-    
-    // Lock-free pop operation
-    bool pop(T& item) {
-        size_t current_head = head_.load(std::memory_order_relaxed);
-        
-        if (current_head == tail_.load(std::memory_order_acquire)) {
-            return false; // Buffer empty
-        }
-        
-        item = buffer_[current_head];
-        head_.store((current_head + 1) % Size, std::memory_order_release);
-        return true;
-    }
-    
-    size_t size() const {
-        size_t h = head_.load(std::memory_order_acquire);
-        size_t t = tail_.load(std::memory_order_acquire);
-        return (t >= h) ? (t - h) : (Size - h + t);
-    }
-    
-    bool empty() const {
-        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
-    }
-    
-    bool full() const {
-        size_t current_tail = tail_.load(std::memory_order_acquire);
-        size_t next_tail = (current_tail + 1) % Size;
-        return next_tail == head_.load(std::memory_order_acquire);
-    }
-};
+using CircularBuffer = SPSCRingBuffer<T, Size>;
 
-// Symbol ID mapping for fast lookups
-class SymbolMapper {
-private:
-    std::unordered_map<std::string, uint32_t> symbol_to_id_;
-    std::vector<std::string> id_to_symbol_;
-    std::atomic<uint32_t> next_id_{1};
-    
-public:
-    uint32_t get_id(const std::string& symbol) {
-        auto it = symbol_to_id_.find(symbol);
-        if (it != symbol_to_id_.end()) {
-            return it->second;
-        }
-        
-        uint32_t id = next_id_.fetch_add(1);
-        symbol_to_id_[symbol] = id;
-        if (id >= id_to_symbol_.size()) {
-            id_to_symbol_.resize(id + 1);
-        }
-        id_to_symbol_[id] = symbol;
-        return id;
-    }
-    
-    const std::string& get_symbol(uint32_t id) const {
-        static const std::string empty_string = "";
-        return id < id_to_symbol_.size() ? id_to_symbol_[id] : empty_string;
-    }
+// Per-symbol columnar tick history with running totals.
+// Columns are rings of HISTORY_SIZE; the running sums are also recorded
+// as they stood *before* each tick, so the sum over any window of up to
+// HISTORY_SIZE ticks is one subtraction.
+struct SymbolTickSeries {
+    static constexpr size_t HISTORY_SIZE = 4096;
+    static constexpr size_t MASK = HISTORY_SIZE - 1;
+
+    // Seqlock version: odd while a writer is updating
+    alignas(64) std::atomic<uint64_t> version{0};
+
+    // Latest state (hot for queries)
+    alignas(64) MarketTick latest;
+    uint64_t count = 0;
+    double mark = 0.0;              // Reference price of the latest tick
+    double total_notional = 0.0;    // sum(last * volume)
+    double total_volume = 0.0;
+    double total_return = 0.0;      // sum(log return)
+    double total_return_sq = 0.0;   // sum(log return^2)
+
+    // Tick columns
+    alignas(64) std::array<uint64_t, HISTORY_SIZE> timestamps;
+    alignas(64) std::array<double, HISTORY_SIZE> mids;
+    alignas(64) std::array<int64_t, HISTORY_SIZE> lasts;      // Price::value
+    alignas(64) std::array<uint32_t, HISTORY_SIZE> volumes;
+
+    // Running totals before each tick
+    alignas(64) std::array<double, HISTORY_SIZE> notional_before;
+    alignas(64) std::array<double, HISTORY_SIZE> volume_before;
+    alignas(64) std::array<double, HISTORY_SIZE> return_before;
+    alignas(64) std::array<double, HISTORY_SIZE> return_sq_before;
 };
 
-// Market data aggregator with SIMD optimizations
+// Market data aggregator with O(1) rolling statistics.
+// Series are indexed directly by SymbolMapper id and allocated on the
+// first tick for that symbol. add_tick may be called from several worker
+// threads; queries never block writers and retry on a torn read.
 class MarketDataAggregator {
 private:
-    static constexpr size_t BUFFER_SIZE = 1024 * 1024; // 1M entries
-    CircularBuffer<MarketTick, BUFFER_SIZE> tick_buffer_;
-    std::vector<MarketTick> price_history_;
-    
+    std::array<std::atomic<SymbolTickSeries*>, constants::MAX_SYMBOLS> series_{};
+
+    SymbolTickSeries* series_for(uint32_t symbol_id) const;
+    SymbolTickSeries* get_or_create_series(uint32_t symbol_id);
+
 public:
+    MarketDataAggregator() = default;
+    ~MarketDataAggregator();
+
+    MarketDataAggregator(const MarketDataAggregator&) = delete;
+    MarketDataAggregator& operator=(const MarketDataAggregator&) = delete;
+
     void add_tick(const MarketTick& tick);
     
-    // Calculate VWAP using SIMD
+    // Volume-weighted last price over the latest window ticks
     double calculate_vwap(uint32_t symbol_id, size_t window) const;
     
-    // Calculate volatility using SIMD
+    // Sample standard deviation of log mid returns over the latest window returns
     double calculate_volatility(uint32_t symbol_id, size_t window) const;
     
     // Get latest tick for symbol
     bool get_latest_tick(uint32_t symbol_id, MarketTick& tick) const;
     
-    // Get price history for analysis
+    // Get price history for analysis (oldest first)
     std::vector<Price> get_price_history(uint32_t symbol_id, size_t count) const;
+    // Same without touching the heap: into arena storage (empty when the
+    // symbol is unknown or the arena is full), or into out[0, max)
+    Span<Price> get_price_history(uint32_t symbol_id, size_t count, MonotonicArena& arena) const;
+    size_t copy_price_history(uint32_t symbol_id, Price* out, size_t max) const;
+
+    // Number of ticks seen for symbol (including ones rolled out of history)
+    uint64_t get_tick_count(uint32_t symbol_id) const;
 };
 
 } // namespace hft::data
\ No newline at end of file
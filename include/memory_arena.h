@@ -0,0 +1,187 @@
+/*
+ * ===================================================================
+ *                  ARENA AND POOL ALLOCATORS
+ * ===================================================================
+ *
+ * Scratch and object storage for the per-tick and per-trade paths, so
+ * a steady-state tick never reaches the heap
+ *
+ * FEATURES:
+ * - MonotonicArena: bump allocation out of one page-backed block,
+ *   released all at once (reset per cycle, or rewound to a mark by an
+ *   ArenaScope); nothing is freed individually
+ * - ObjectPool: fixed number of same-sized objects on a free stack,
+ *   O(1) acquire / release, no growth
+ * - Both sit on a PageBuffer, so they take 2 MB hugepages and a NUMA
+ *   node the same way the rings do
+ * - Span: non-owning view handed out by arena-backed APIs
+ *
+ * Neither type is thread safe: use one per thread (or per cycle owner).
+ * Exhaustion is reported as an empty span / nullptr, never by falling
+ * back to the heap.
+ *
+ * USAGE:
+ *   MonotonicArena arena(1 << 20, config.use_hugepages);
+ *   for (;;) {
+ *       ArenaScope cycle(arena);
+ *       Span<Price> history = aggregator.get_price_history(id, 64, arena);
+ *       ...
+ *   }   // Everything from this cycle is released here
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "page_buffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hft::data {
+
+template <typename T>
+class Span {
+public:
+    constexpr Span() = default;
+    constexpr Span(T* data, size_t size) : data_(data), size_(size) {}
+
+    constexpr T* data() const { return data_; }
+    constexpr size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr T& operator[](size_t i) const { return data_[i]; }
+    constexpr T* begin() const { return data_; }
+    constexpr T* end() const { return data_ + size_; }
+
+    // The first count elements (all of them when count >= size)
+    constexpr Span first(size_t count) const { return Span(data_, count < size_ ? count : size_); }
+
+private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+class MonotonicArena {
+public:
+    MonotonicArena(size_t bytes, bool use_hugepages = false, int numa_node = -1);
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    // nullptr when the request does not fit (counted in failed_allocations)
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    // Uninitialized storage for count objects; empty when they do not fit.
+    // Only trivially destructible types: the arena never runs destructors.
+    template <typename T>
+    Span<T> allocate_array(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena objects are never destroyed");
+        if (count == 0 || count > capacity() / sizeof(T)) {
+            if (count != 0) ++failed_allocations_;
+            return {};
+        }
+        void* p = allocate(count * sizeof(T), alignof(T));
+        return p ? Span<T>(static_cast<T*>(p), count) : Span<T>{};
+    }
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena objects are never destroyed");
+        void* p = allocate(sizeof(T), alignof(T));
+        return p ? new (p) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    // Release everything allocated after mark() returned m
+    size_t mark() const { return offset_; }
+    void rewind(size_t mark) { if (mark < offset_) offset_ = mark; }
+    void reset() { offset_ = 0; }
+
+    size_t used() const { return offset_; }
+    size_t capacity() const { return buffer_.size(); }
+    size_t high_water() const { return high_water_; }
+    uint64_t failed_allocations() const { return failed_allocations_; }
+    bool on_hugepages() const { return buffer_.on_hugepages(); }
+
+private:
+    PageBuffer buffer_;
+    size_t offset_ = 0;
+    size_t high_water_ = 0;
+    uint64_t failed_allocations_ = 0;
+};
+
+// Rewinds the arena to where it was on construction
+class ArenaScope {
+public:
+    explicit ArenaScope(MonotonicArena& arena) : arena_(arena), mark_(arena.mark()) {}
+    ~ArenaScope() { arena_.rewind(mark_); }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+
+private:
+    MonotonicArena& arena_;
+    size_t mark_;
+};
+
+template <typename T>
+class ObjectPool {
+public:
+    ObjectPool(size_t capacity, bool use_hugepages = false, int numa_node = -1)
+        : storage_(capacity * sizeof(Slot), use_hugepages, numa_node),
+          free_(capacity != 0 ? std::make_unique<uint32_t[]>(capacity) : nullptr),
+          capacity_(storage_.data() ? capacity : 0) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            free_[i] = static_cast<uint32_t>(capacity_ - 1 - i);   // Lowest slots first
+        }
+        free_count_ = capacity_;
+    }
+
+    // Objects still acquired are not destroyed
+    ~ObjectPool() = default;
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // nullptr when every object is in use
+    template <typename... Args>
+    T* acquire(Args&&... args) {
+        if (free_count_ == 0) {
+            return nullptr;
+        }
+        return new (&slots()[free_[--free_count_]]) T(std::forward<Args>(args)...);
+    }
+
+    // object must have come from this pool's acquire
+    void release(T* object) {
+        if (!object) {
+            return;
+        }
+        object->~T();
+        free_[free_count_++] = static_cast<uint32_t>(reinterpret_cast<Slot*>(object) - slots());
+    }
+
+    bool owns(const T* object) const {
+        const auto* slot = reinterpret_cast<const Slot*>(object);
+        return slot >= slots() && slot < slots() + capacity_;
+    }
+
+    size_t capacity() const { return capacity_; }
+    size_t available() const { return free_count_; }
+    size_t in_use() const { return capacity_ - free_count_; }
+    bool on_hugepages() const { return storage_.on_hugepages(); }
+
+private:
+    using Slot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+    Slot* slots() const { return static_cast<Slot*>(storage_.data()); }
+
+    PageBuffer storage_;
+    std::unique_ptr<uint32_t[]> free_;   // Free stack of slot indices
+    size_t capacity_;
+    size_t free_count_ = 0;
+};
+
+} // namespace hft::data
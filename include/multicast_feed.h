@@ -0,0 +1,290 @@
+/*
+ * ===================================================================
+ *                    MULTICAST MARKET DATA FEED
+ * ===================================================================
+ *
+ * Binary exchange-style feed over UDP multicast, published straight
+ * into the DataIngestionEngine ring
+ *
+ * PERFORMANCE FEATURES:
+ * - recvmmsg: up to RECV_BATCH datagrams per system call into
+ *   preallocated buffers, non-blocking, busy-polled
+ * - Fixed-layout little-endian messages, decoded field by field
+ *   directly into the ring's DataEvent slots (one claim per batch)
+ * - A/B line arbitration on per-message sequence numbers: the first
+ *   copy of each sequence wins, later copies are dropped
+ * - Gap detection over a sliding window of sequence numbers; a gap on
+ *   one line is filled by the other line if it arrives in time
+ * - PacketSource is the backend seam: kernel-bypass receivers (AF_XDP,
+ *   ef_vi) plug in as other sources with the same batch interface
+ *
+ * THREADING:
+ * - One feed thread reads both lines (optionally pinned, see
+ *   Config::feed_cpu); arbitration state is owned by it
+ * - Statistics readable from any thread
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "data_ingestion.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct mmsghdr;
+struct iovec;
+
+namespace hft::data {
+
+// Wire layout (host is little-endian): a PacketHeader, then
+// message_count messages, each starting with its own length and type.
+// Message i carries sequence number PacketHeader::sequence + i; a
+// packet with no messages is a heartbeat announcing the next sequence.
+namespace feed_format {
+
+constexpr uint8_t QUOTE = 'Q';
+constexpr uint8_t TRADE = 'T';
+constexpr uint8_t OPTION_QUOTE = 'O';
+
+struct PacketHeader {
+    uint64_t sequence;           // Of the first message (next expected, for heartbeats)
+    uint16_t message_count;
+    uint16_t reserved;
+    uint32_t session;
+};
+
+struct QuoteMessage {            // QUOTE or TRADE
+    uint16_t length;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t exchange_id;
+    uint64_t symbol;             // SymbolKey::value (ASCII, zero padded)
+    uint64_t timestamp;          // Exchange time, ns since epoch
+    int64_t bid;                 // Basis points
+    int64_t ask;
+    int64_t last;
+    uint32_t bid_size;
+    uint32_t ask_size;
+    uint32_t volume;
+    uint32_t padding;
+};
+
+struct OptionQuoteMessage {
+    uint16_t length;
+    uint8_t type;
+    uint8_t option_type;         // 0 = call, 1 = put
+    uint8_t exercise_style;
+    uint8_t reserved;
+    uint16_t days_to_expiry;
+    uint64_t underlying;         // SymbolKey::value of the underlying
+    uint32_t contract_id;        // Exchange contract id, becomes OptionTick::symbol_id
+    uint32_t expiration_date;    // YYYYMMDD
+    uint64_t timestamp;
+    int64_t strike;              // Basis points
+    int64_t bid;
+    int64_t ask;
+    int64_t last;
+    uint32_t volume;
+    uint32_t open_interest;
+    double implied_volatility;
+};
+
+static_assert(sizeof(PacketHeader) == 16, "feed packet header layout");
+static_assert(sizeof(QuoteMessage) == 64, "feed quote layout");
+static_assert(sizeof(OptionQuoteMessage) == 80, "feed option quote layout");
+
+} // namespace feed_format
+
+// One received datagram; data stays valid until the source's next receive
+struct Datagram {
+    const uint8_t* data;
+    size_t length;
+    Timestamp received;
+};
+
+// Batch datagram receiver: one line of the feed
+class PacketSource {
+public:
+    virtual ~PacketSource() = default;
+    virtual bool open() = 0;                                  // Idempotent
+    virtual void close() = 0;
+    virtual size_t receive(Datagram* out, size_t max) = 0;    // Non-blocking; 0 when idle
+};
+
+// UDP socket joined to a multicast group (or bound to a unicast address)
+// and drained with recvmmsg
+class UdpMulticastSource : public PacketSource {
+public:
+    static constexpr size_t BATCH = 64;
+    static constexpr size_t MAX_DATAGRAM = 2048;
+
+    // endpoint "group:port"; interface_address selects the local interface
+    // for the join (empty = any)
+    UdpMulticastSource(const std::string& endpoint, const std::string& interface_address = "",
+                       size_t socket_buffer_bytes = 8u << 20);
+    ~UdpMulticastSource() override;
+
+    bool open() override;
+    void close() override;
+    size_t receive(Datagram* out, size_t max) override;
+
+    uint16_t bound_port() const { return bound_port_; }   // After open()
+
+private:
+    std::string endpoint_;
+    std::string interface_address_;
+    size_t socket_buffer_bytes_;
+    int fd_ = -1;
+    uint16_t bound_port_ = 0;
+
+    std::unique_ptr<uint8_t[]> buffers_;         // BATCH * MAX_DATAGRAM
+    std::unique_ptr<mmsghdr[]> messages_;
+    std::unique_ptr<iovec[]> iovecs_;
+};
+
+// Sequence arbitration across redundant lines with gap tracking.
+// Sequences in [next_expected() - WINDOW, next_expected()) are tracked
+// in a bitmap; anything still missing when it slides out is lost.
+class SequenceArbiter {
+public:
+    static constexpr uint64_t WINDOW = 1u << 16;
+
+    enum class Verdict : uint8_t {
+        NEW,          // First copy, in order or ahead (possibly opening a gap)
+        RECOVERED,    // First copy of a sequence inside an open gap
+        DUPLICATE     // Already seen, or older than the window
+    };
+
+    // When a new gap opens, gap_first / gap_count describe it (count 0 otherwise)
+    Verdict accept(uint64_t sequence, uint64_t& gap_first, uint64_t& gap_count);
+
+    // Heartbeat: the line's next sequence; opens a gap if we are behind
+    void observe_next(uint64_t next_sequence, uint64_t& gap_first, uint64_t& gap_count);
+
+    uint64_t next_expected() const { return next_; }
+    uint64_t gaps() const { return gaps_; }              // Gap events
+    uint64_t outstanding() const { return outstanding_; } // Missing, still recoverable
+    uint64_t recovered() const { return recovered_; }
+    uint64_t lost() const { return lost_; }
+
+private:
+    bool test(uint64_t sequence) const { return (bits_[(sequence % WINDOW) / 64] >> (sequence % 64)) & 1; }
+    void set(uint64_t sequence) { bits_[(sequence % WINDOW) / 64] |= uint64_t(1) << (sequence % 64); }
+    void clear(uint64_t sequence) { bits_[(sequence % WINDOW) / 64] &= ~(uint64_t(1) << (sequence % 64)); }
+    void open_gap(uint64_t to, uint64_t& gap_first, uint64_t& gap_count);
+    void advance(uint64_t new_next);
+
+    bool started_ = false;
+    uint64_t start_ = 0;         // First sequence seen; older ones are ignored
+    uint64_t next_ = 0;
+    uint64_t gaps_ = 0;
+    uint64_t outstanding_ = 0;
+    uint64_t recovered_ = 0;
+    uint64_t lost_ = 0;
+    std::array<uint64_t, WINDOW / 64> bits_{};
+};
+
+class MulticastFeed : public IDataFeed {
+public:
+    static constexpr size_t MAX_LINES = 2;
+    static constexpr size_t RECV_BATCH = UdpMulticastSource::BATCH;
+    static constexpr size_t MAX_PENDING = 2048;   // Decoded messages per publish
+
+    struct Config {
+        std::string line_a;           // "group:port"
+        std::string line_b;           // Optional redundant line (same sequence space)
+        std::string interface_address;
+        size_t socket_buffer_bytes;
+        bool busy_poll;               // Spin (pause) when idle instead of yielding
+        int feed_cpu;                 // Core for the feed thread; -1 = not pinned
+
+        Config() : socket_buffer_bytes(8u << 20), busy_poll(true), feed_cpu(-1) {}
+    };
+
+    using GapCallback = std::function<void(uint64_t first_sequence, uint64_t count)>;
+
+    explicit MulticastFeed(const Config& config);
+
+    // Custom line backends (kernel bypass, replay, tests); line_b may be null
+    MulticastFeed(std::unique_ptr<PacketSource> line_a, std::unique_ptr<PacketSource> line_b,
+                  int feed_cpu = -1);
+    ~MulticastFeed() override;
+
+    // IDataFeed interface
+    void attach(DataIngestionEngine* engine) override { engine_ = engine; }
+    bool connect() override;
+    void disconnect() override;
+    bool is_connected() const override { return connected_.load(); }
+    bool is_pinned() const { return pinned_.load(); }
+    void subscribe_symbol(const std::string& symbol) override;
+    void unsubscribe_symbol(const std::string& symbol) override;
+    void start_feed() override;
+    void stop_feed() override;
+
+    // Called on the feed thread when a new gap opens (e.g. to request a
+    // retransmission); must be set before start_feed
+    void set_gap_callback(GapCallback callback) { gap_callback_ = std::move(callback); }
+
+    // Arbitrate, decode and publish one batch from a line (the feed
+    // thread's inner step; exposed for replay and tests). Returns the
+    // events published.
+    size_t process(const Datagram* datagrams, size_t count, size_t line);
+
+    // ---- Statistics ----
+    uint64_t packets_received(size_t line) const { return packets_[line].load(std::memory_order_relaxed); }
+    uint64_t messages_published() const { return published_.load(std::memory_order_relaxed); }
+    uint64_t duplicates() const { return duplicates_.load(std::memory_order_relaxed); }
+    uint64_t malformed() const { return malformed_.load(std::memory_order_relaxed); }
+    uint64_t gaps() const { return gaps_.load(std::memory_order_relaxed); }
+    uint64_t recovered() const { return recovered_.load(std::memory_order_relaxed); }
+    uint64_t lost() const { return lost_.load(std::memory_order_relaxed); }
+
+private:
+    struct Pending {
+        const uint8_t* message;
+        uint64_t sequence;
+        uint32_t id;              // Engine symbol id (underlying, for options)
+        uint8_t type;
+        Timestamp received;
+    };
+
+    void feed_loop();
+    void report_gap(uint64_t first, uint64_t count);
+    size_t flush();
+    void update_stats();
+    uint32_t subscribed_id(uint64_t symbol_key) const;
+
+    std::unique_ptr<PacketSource> lines_[MAX_LINES];
+    bool busy_poll_ = true;
+    int feed_cpu_ = -1;
+    DataIngestionEngine* engine_ = nullptr;
+    std::vector<uint8_t> subscribed_;           // By engine symbol id
+    GapCallback gap_callback_;
+
+    SequenceArbiter arbiter_;
+    std::unique_ptr<Pending[]> pending_;
+    size_t pending_count_ = 0;
+
+    std::atomic<bool> connected_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<bool> pinned_{false};
+    std::thread feed_thread_;
+
+    std::atomic<uint64_t> packets_[MAX_LINES] = {};
+    std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> duplicates_{0};
+    std::atomic<uint64_t> malformed_{0};
+    std::atomic<uint64_t> gaps_{0};
+    std::atomic<uint64_t> recovered_{0};
+    std::atomic<uint64_t> lost_{0};
+};
+
+} // namespace hft::data
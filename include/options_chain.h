@@ -0,0 +1,95 @@
+/*
+ * ===================================================================
+ *                      INDEXED OPTIONS CHAIN
+ * ===================================================================
+ *
+ * Latest quote of every contract on one underlying, keyed by
+ * (expiry, strike, type) and updated in place from the options feed
+ *
+ * PERFORMANCE FEATURES:
+ * - Expiries in date order, each with a sorted strike column and call
+ *   / put quote columns at the same index
+ * - A quote for a known contract is written straight into its slot;
+ *   only a new strike or expiry inserts (and can allocate)
+ * - Strike lookups are a branchless binary search over the contiguous
+ *   strike column; nearest-strike and ATM lookups are one search plus
+ *   a neighbour compare
+ *
+ * THREADING:
+ * - Single thread (the strategy thread)
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hft::data {
+
+class OptionsChain {
+public:
+    static constexpr size_t MAX_EXPIRIES = 16;
+    static constexpr size_t NONE = SIZE_MAX;
+    static constexpr uint8_t CALL = 0;
+    static constexpr uint8_t PUT = 1;
+
+    explicit OptionsChain(uint32_t underlying_id);
+
+    // Store the quote in its contract's slot; false when it is for another
+    // underlying or its expiry does not fit (all MAX_EXPIRIES slots hold
+    // later expiries; otherwise the earliest expiry is dropped)
+    bool update(const OptionTick& tick);
+
+    // ---- Expiries (ordered by expiration date) ----
+    size_t expiry_count() const { return expiries_.size(); }
+    uint32_t expiration_date(size_t expiry) const { return expiries_[expiry].expiration_date; }
+    uint16_t days_to_expiry(size_t expiry) const { return expiries_[expiry].days_to_expiry; }
+    size_t find_expiry(uint32_t expiration_date) const;
+    size_t nearest_expiry(double min_days, double max_days) const;   // NONE if no expiry in band
+
+    // ---- Strikes on one expiry ----
+    size_t strike_count(size_t expiry) const { return expiries_[expiry].strikes.size(); }
+    Price strike(size_t expiry, size_t index) const {
+        return Price::from_basis_points(expiries_[expiry].strikes[index]);
+    }
+    size_t find_strike(size_t expiry, Price strike) const;          // Exact; NONE if absent
+    size_t nearest_strike(size_t expiry, Price price) const;        // Ties go to the lower strike
+    size_t atm_strike(size_t expiry, Price spot) const { return nearest_strike(expiry, spot); }
+
+    // Latest quote; nullptr if that side of the strike was never quoted
+    const OptionTick* quote(size_t expiry, size_t strike_index, uint8_t option_type) const;
+    const OptionTick* find(uint32_t expiration_date, Price strike, uint8_t option_type) const;
+
+    // Lowest quoted call strike at or above floor / highest quoted put
+    // strike at or below ceiling; nullptr when none
+    const OptionTick* call_at_or_above(size_t expiry, Price floor) const;
+    const OptionTick* put_at_or_below(size_t expiry, Price ceiling) const;
+
+    uint32_t underlying_id() const { return underlying_id_; }
+    size_t contract_count() const { return contracts_; }
+    uint64_t revision() const { return revision_; }   // Bumped by every accepted update
+
+    // First index with strikes[index] >= key (n if none), without branches
+    // on the comparison results
+    static size_t lower_bound(const int64_t* strikes, size_t n, int64_t key);
+
+private:
+    struct Expiry {
+        uint32_t expiration_date = 0;
+        uint16_t days_to_expiry = 0;
+        std::vector<int64_t> strikes;        // Sorted, basis points
+        std::vector<OptionTick> quotes;      // 2 per strike: call, put
+        std::vector<uint8_t> quoted;         // 1 where the quotes slot is filled
+    };
+
+    uint32_t underlying_id_;
+    std::vector<Expiry> expiries_;
+    size_t contracts_ = 0;
+    uint64_t revision_ = 0;
+};
+
+} // namespace hft::data
@@ -0,0 +1,243 @@
+/*
+ * ===================================================================
+ *                      LOW-LATENCY ORDER ROUTER
+ * ===================================================================
+ *
+ * Order path from the strategy thread to the wire
+ *
+ * PERFORMANCE FEATURES:
+ * - Orders come from a fixed pool allocated up front; sent orders flow
+ *   back to the pool through a completion ring, so the steady state
+ *   never allocates
+ * - The strategy thread only fills an order and pushes its pool index
+ *   onto an SPSC ring; encoding and the write happen on the send thread
+ * - Fixed-layout binary messages (OUCH-style, big-endian): the constant
+ *   fields are encoded once into a template at construction and each
+ *   order is a copy of the template patched at fixed offsets
+ * - A straddle's two legs travel as one queue entry and are written
+ *   back to back in one write call, so either both reach the wire or
+ *   neither does
+ * - Send thread optionally pinned to a core and busy-polling; the
+ *   submission queue is placed on that core's NUMA node
+ * - Optional kill switch (RiskManager::kill_switch): while engaged,
+ *   submissions are refused and orders already queued are dropped by
+ *   the send thread instead of written
+ * - Every accepted submission is reported back once the send thread is
+ *   done with it (sent, blocked or write failed), riding the same
+ *   completion ring that recycles its orders
+ *
+ * THREADING:
+ * - allocate / release / submit*: one producer thread (the strategy)
+ * - The send thread is internal; without start(), poll() drains the
+ *   queue on the calling thread instead
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include "ring_buffer.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace hft::execution {
+
+enum class Side : uint8_t {
+    BUY = 'B',
+    SELL = 'S'
+};
+
+// What the send thread did with a submission
+enum class SendResult : uint8_t {
+    PENDING = 0,                 // Not handled yet
+    SENT = 1,                    // Written to the wire
+    BLOCKED = 2,                 // Dropped at the wire by the kill switch
+    WRITE_FAILED = 3             // The writer refused it
+};
+
+// Outcome of one accepted submission
+struct SendReport {
+    uint64_t submission_id;      // Pair id for pairs, order id for singles
+    SendResult result;
+};
+
+// One order; owned by the router between submit and its completion
+struct alignas(64) Order {
+    uint64_t order_id;           // Wire token, assigned by submit
+    uint64_t pair_id;            // First leg's order_id on both legs of a pair; 0 for singles
+    uint32_t instrument_id;      // Contract symbol_id
+    uint32_t quantity;
+    data::Price price;           // Limit
+    Side side;
+    SendResult result;           // Set by the send thread
+};
+
+static_assert(sizeof(Order) == 64, "Order fills one cache line");
+
+// Wire format of an enter-order message (all integers big-endian)
+namespace wire {
+
+constexpr size_t ENTER_ORDER_SIZE = 48;
+constexpr uint8_t ENTER_ORDER_TYPE = 'O';
+
+constexpr size_t TYPE_OFFSET = 0;           // u8  'O'
+constexpr size_t SIDE_OFFSET = 1;           // u8  'B' / 'S'
+constexpr size_t TIF_OFFSET = 2;            // u8  time in force
+constexpr size_t CAPACITY_OFFSET = 3;       // u8  order capacity
+constexpr size_t INSTRUMENT_OFFSET = 4;     // u32
+constexpr size_t TOKEN_OFFSET = 8;          // u64 order id
+constexpr size_t PAIR_TOKEN_OFFSET = 16;    // u64 pair id (0 = none)
+constexpr size_t QUANTITY_OFFSET = 24;      // u32
+constexpr size_t FIRM_OFFSET = 28;          // u32
+constexpr size_t PRICE_OFFSET = 32;         // i64 basis points
+constexpr size_t SEND_TIME_OFFSET = 40;     // u64 ns since epoch, stamped at send
+
+constexpr uint8_t TIF_DAY = '0';
+constexpr uint8_t TIF_IOC = '3';
+constexpr uint8_t CAPACITY_AGENCY = 'A';
+constexpr uint8_t CAPACITY_PRINCIPAL = 'P';
+
+// Decoded view, for tools and tests
+struct EnterOrder {
+    Side side;
+    uint8_t time_in_force;
+    uint8_t capacity;
+    uint32_t instrument_id;
+    uint64_t order_id;
+    uint64_t pair_id;
+    uint32_t quantity;
+    uint32_t firm_id;
+    data::Price price;
+    data::Timestamp send_time;
+};
+
+// false unless data holds a complete enter-order message
+bool decode_enter_order(const uint8_t* data, size_t length, EnterOrder& out);
+
+} // namespace wire
+
+class OrderRouter {
+public:
+    static constexpr size_t MAX_ORDERS = 1024;       // Pool size = most orders in flight
+    static constexpr size_t QUEUE_CAPACITY = 1024;   // Submissions (a pair is one entry)
+    static constexpr size_t SEND_BATCH = 32;
+
+    struct Config {
+        int send_cpu;                // Core for the send thread; -1 = not pinned
+        bool busy_poll;              // Spin (pause) when idle instead of yielding
+        uint32_t firm_id;
+        uint8_t time_in_force;
+        uint8_t capacity;
+
+        Config() : send_cpu(-1),
+                   busy_poll(true),
+                   firm_id(0),
+                   time_in_force(wire::TIF_DAY),
+                   capacity(wire::CAPACITY_PRINCIPAL) {}
+    };
+
+    // Writes one or more encoded messages; false if nothing was written
+    using WireWriter = std::function<bool(const uint8_t* data, size_t length)>;
+
+    explicit OrderRouter(WireWriter writer, const Config& config = Config{});
+    ~OrderRouter();
+
+    OrderRouter(const OrderRouter&) = delete;
+    OrderRouter& operator=(const OrderRouter&) = delete;
+
+    // ---- Send thread ----
+    bool start();
+    void stop();                 // Drains the queue before returning
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+    bool is_pinned() const { return pinned_.load(std::memory_order_acquire); }
+
+    // Flag that halts order flow while true; set before start(), nullptr = none
+    void set_kill_switch(const std::atomic<bool>* engaged) { kill_switch_ = engaged; }
+
+    // Encode and write queued submissions on the calling thread (when the
+    // send thread is not running); returns the submissions handled
+    size_t poll();
+
+    // ---- Producer thread ----
+    Order* allocate();           // nullptr when every order is in flight
+    void release(Order* order);  // Return an order that was never submitted
+
+    // Hand an order to the router; it returns to the pool once written.
+    // On false (queue full, kill switch engaged) the order is released.
+    bool submit(Order* order);
+    bool submit_pair(Order* first, Order* second);
+
+    // Both legs of a straddle at their own limits; returns the pair id,
+    // 0 when the pool or queue is exhausted or the kill switch is
+    // engaged (nothing is sent)
+    uint64_t submit_straddle(Side side, uint32_t call_instrument, data::Price call_price,
+                             uint32_t put_instrument, data::Price put_price, uint32_t quantity);
+
+    // Outcomes of accepted submissions the send thread has finished with,
+    // oldest first; returns the number written. Up to MAX_ORDERS are held
+    // between calls, after which the oldest are dropped (reports_dropped).
+    size_t take_reports(SendReport* out, size_t max);
+
+    // ---- Statistics (any thread) ----
+    uint64_t orders_sent() const { return orders_sent_.load(std::memory_order_relaxed); }
+    uint64_t write_failures() const { return write_failures_.load(std::memory_order_relaxed); }
+    uint64_t orders_blocked() const { return orders_blocked_.load(std::memory_order_relaxed); }   // Kill switch
+    size_t orders_available() const { return free_count_; }   // Producer thread
+    uint64_t reports_dropped() const { return reports_dropped_; }   // Producer thread
+    uint64_t submissions() const { return submissions_; }           // Accepted; producer thread
+
+    const Config& get_config() const { return config_; }
+
+private:
+    static constexpr uint32_t NO_ORDER = UINT32_MAX;
+
+    struct SendRequest {
+        uint32_t first;
+        uint32_t second;             // NO_ORDER for a single order
+    };
+
+    uint32_t index_of(const Order* order) const { return static_cast<uint32_t>(order - orders_.get()); }
+    bool halted() const { return kill_switch_ && kill_switch_->load(std::memory_order_acquire); }
+    void reclaim();
+    size_t drain();
+    void send(const SendRequest& request);
+    void encode(const Order& order, uint64_t send_time, uint8_t* out) const;
+    void send_loop();
+
+    Config config_;
+    WireWriter writer_;
+    const std::atomic<bool>* kill_switch_ = nullptr;
+    std::array<uint8_t, wire::ENTER_ORDER_SIZE> template_{};
+
+    // Pool: free stack owned by the producer, refilled from completions
+    std::unique_ptr<Order[]> orders_;
+    std::array<uint32_t, MAX_ORDERS> free_{};
+    size_t free_count_ = 0;
+    uint64_t next_order_id_ = 1;
+    uint64_t submissions_ = 0;
+
+    // Reports of reclaimed submissions not yet taken (producer owned)
+    std::array<SendReport, MAX_ORDERS> reports_{};
+    size_t report_head_ = 0;
+    size_t report_count_ = 0;
+    uint64_t reports_dropped_ = 0;
+
+    data::SPSCRingBuffer<SendRequest, QUEUE_CAPACITY> queue_;       // Producer -> sender
+    data::SPSCRingBuffer<uint32_t, MAX_ORDERS> completions_;        // Sender -> producer
+
+    std::thread send_thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> pinned_{false};
+    std::atomic<uint64_t> orders_sent_{0};
+    std::atomic<uint64_t> write_failures_{0};
+    std::atomic<uint64_t> orders_blocked_{0};
+};
+
+} // namespace hft::execution
@@ -0,0 +1,55 @@
+/*
+ * ===================================================================
+ *                    PAGE-BACKED BUFFER STORAGE
+ * ===================================================================
+ *
+ * Large zero-initialized allocations taken straight from the OS
+ * (mmap on Linux), optionally on 2 MB hugepages.
+ *
+ * PERFORMANCE FEATURES:
+ * - Pages are only materialized on first touch, so reserving a large
+ *   ring costs almost nothing until it is used
+ * - MAP_HUGETLB when requested, falling back to transparent hugepages
+ *   and then to regular pages if the kernel has none reserved
+ * - Optional NUMA node: the untouched pages get that node as their
+ *   preferred placement, so they fault in on the consumer's node
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace hft::data {
+
+class PageBuffer {
+public:
+    static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    PageBuffer() = default;
+    PageBuffer(size_t bytes, bool use_hugepages, int numa_node = -1);   // -1 = first-touch default
+    ~PageBuffer();
+
+    PageBuffer(PageBuffer&& other) noexcept;
+    PageBuffer& operator=(PageBuffer&& other) noexcept;
+    PageBuffer(const PageBuffer&) = delete;
+    PageBuffer& operator=(const PageBuffer&) = delete;
+
+    void* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool on_hugepages() const { return on_hugepages_; }
+    int numa_node() const { return numa_node_; }   // -1 unless placement succeeded
+
+private:
+    void map(size_t bytes, bool use_hugepages);
+    void release();
+
+    void* data_ = nullptr;
+    size_t size_ = 0;          // Mapped length (rounded up to the page size used)
+    bool on_hugepages_ = false;
+    bool mapped_ = false;      // false when taken from the aligned heap fallback
+    int numa_node_ = -1;
+};
+
+} // namespace hft::data
@@ -0,0 +1,106 @@
+/*
+ * ===================================================================
+ *                    PARALLEL PARAMETER SWEEP
+ * ===================================================================
+ *
+ * Replays one shared history through many StraddleStrategy::Config
+ * variants in parallel and collects a results table
+ *
+ * PERFORMANCE FEATURES:
+ * - History is loaded once into SweepData and shared read-only by every
+ *   worker (market ticks as contiguous arrays, option quotes by pointer)
+ * - One BacktestEngine per worker, reused across all of its runs
+ * - Work stealing over index ranges: each worker drains its own range
+ *   with fetch_add and then steals from the others the same way, so
+ *   there is no shared queue and no lock
+ * - Results are written to pre-sized slots, one writer per slot
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "backtest_engine.h"
+#include <atomic>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace hft::analytics {
+
+// Read-only replay inputs, shared by every worker of a sweep
+class SweepData {
+public:
+    // Ticks sorted by timestamp (sorted here if needed)
+    void add_market_data(std::vector<data::MarketTick> ticks);
+
+    // Materializes [start, end] once; false when the symbol has no data
+    bool add_market_data(const data::HistoricalDataLoader& loader, const std::string& symbol,
+                         const data::Timestamp& start = data::Timestamp(),
+                         const data::Timestamp& end = data::Timestamp(UINT64_MAX));
+
+    void add_options_data(std::vector<data::OptionTick> ticks);
+
+    // Register every source with an engine (no tick data is copied)
+    bool load(BacktestEngine& engine) const;
+
+    size_t market_ticks() const;
+
+private:
+    std::vector<std::vector<data::MarketTick>> market_;
+    std::vector<std::shared_ptr<const std::vector<data::OptionTick>>> options_;
+};
+
+// Cartesian product of parameter values over a base config (an empty
+// axis keeps the base value)
+struct SweepGrid {
+    strategy::StraddleStrategy::Config base;
+    std::vector<double> otm_offset_pct;
+    std::vector<double> profit_target_pct;
+    std::vector<double> stop_loss_pct;
+    std::vector<uint16_t> max_hold_days;
+    std::vector<std::pair<double, double>> implied_vol_band;   // (min, max)
+    std::vector<std::pair<double, double>> expiry_band;        // (min, max) days
+
+    size_t size() const;
+    std::vector<strategy::StraddleStrategy::Config> expand() const;
+};
+
+// One row of the results table
+struct SweepResult {
+    strategy::StraddleStrategy::Config config;
+    uint64_t trades = 0;
+    double win_rate = 0.0;
+    double sharpe_ratio = 0.0;
+    double max_drawdown = 0.0;
+    double total_pnl = 0.0;
+    double average_trade_pnl = 0.0;
+    BacktestStats stats;
+};
+
+class ParameterSweep {
+public:
+    struct Config {
+        size_t num_threads;   // 0 = hardware concurrency
+
+        Config() : num_threads(0) {}
+    };
+
+    explicit ParameterSweep(const SweepData& data, const Config& config = Config{});
+
+    // Results in the order of configs
+    std::vector<SweepResult> run(const std::vector<strategy::StraddleStrategy::Config>& configs);
+    std::vector<SweepResult> run(const SweepGrid& grid) { return run(grid.expand()); }
+
+    // Jobs taken from another worker's range during the last run
+    uint64_t get_steals() const { return steals_.load(std::memory_order_relaxed); }
+
+    static void write_csv(std::ostream& out, const std::vector<SweepResult>& results);
+
+private:
+    const SweepData& data_;
+    Config config_;
+    std::atomic<uint64_t> steals_{0};
+};
+
+} // namespace hft::analytics
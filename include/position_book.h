@@ -0,0 +1,273 @@
+/*
+ * ===================================================================
+ *                      STRADDLE POSITION BOOK
+ * ===================================================================
+ *
+ * Fixed-capacity storage for open straddles plus a journal of closed
+ * ones, written by the strategy thread and read by monitoring threads
+ *
+ * PERFORMANCE FEATURES:
+ * - No allocation after construction: slots sized from max_positions,
+ *   journal sized up front (a ring of the most recent closes)
+ * - StraddlePosition holds no heap members; hot per-tick fields fill
+ *   the first cache lines, cold entry metadata sits on its own line
+ * - Dense symbol_id column so per-tick position scans touch one line
+ *   per 16 slots instead of whole positions
+ * - Readers never lock: each slot and each journal entry is guarded by
+ *   a seqlock and readers retry on a concurrent write
+ * - Portfolio and per-symbol greeks / P&L are maintained incrementally:
+ *   every open, modify and close applies only that position's change,
+ *   so exposure queries are O(1) regardless of the number of positions
+ *
+ * THREADING:
+ * - open / modify / close / for_each_* : single writer thread only
+ * - snapshot_* / read_* / size         : any thread
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace hft::strategy {
+
+// Position status enumeration
+enum class PositionStatus : uint8_t {
+    NONE = 0,
+    ANALYZING = 1,
+    ENTRY_PENDING = 2,
+    ACTIVE = 3,
+    EXIT_PENDING = 4,
+    CLOSED = 5,
+    ERROR = 6
+};
+
+// Trade direction for straddle components
+enum class TradeDirection : uint8_t {
+    LONG = 0,
+    SHORT = 1
+};
+
+// Straddle position structure
+struct alignas(64) StraddlePosition {
+    // ---- Hot: read and written on every tick of the underlying ----
+    uint32_t symbol_id;
+    PositionStatus status;
+    uint16_t days_held;
+    uint16_t max_hold_days;
+    uint16_t days_to_expiry;          // From the most recent leg quotes
+    uint32_t expiration_date;
+    data::Price call_strike;
+    data::Price put_strike;
+    data::Price current_call_price;
+    data::Price current_put_price;
+    data::Price current_underlying_price;
+    data::Price total_premium_paid;
+
+    data::Price profit_target;
+    data::Price stop_loss;
+    data::Price unrealized_pnl;
+    data::Price max_profit;
+    data::Price max_loss;
+    double implied_volatility;
+    data::Timestamp entry_time;
+    data::Timestamp last_update;
+
+    // Greeks
+    double delta;
+    double gamma;
+    double theta;
+    double vega;
+
+    // ---- Cold: entry metadata, touched on open, close and by monitoring ----
+    alignas(64) uint32_t position_id;
+    uint32_t call_symbol_id;          // Leg contracts, for routing the exit
+    uint32_t put_symbol_id;
+    uint64_t order_pair_id;           // Entry or exit pair awaiting its send report; 0 = none
+    data::SymbolKey symbol;
+    data::Price underlying_entry_price;
+    data::Price call_entry_price;
+    data::Price put_entry_price;
+    data::Price realized_pnl;
+
+    StraddlePosition() = default;
+
+    // Calculate current position value
+    data::Price calculate_position_value() const {
+        return current_call_price + current_put_price;
+    }
+
+    // Calculate current P&L
+    data::Price calculate_pnl() const {
+        return calculate_position_value() - total_premium_paid;
+    }
+
+    // Calculate return percentage
+    double calculate_return_pct() const {
+        if (total_premium_paid.to_double() == 0) return 0.0;
+        return (calculate_pnl().to_double() / total_premium_paid.to_double()) * 100.0;
+    }
+
+    // Check if position should be closed
+    bool should_close() const;
+};
+
+static_assert(std::is_trivially_copyable_v<StraddlePosition>, "positions are copied under seqlocks");
+static_assert(offsetof(StraddlePosition, position_id) == 192, "hot fields fill the first three cache lines");
+
+// Summed greeks and marks of a set of open straddles, per share of one
+// contract per leg (scale by the contract multiplier for dollars)
+struct PortfolioExposure {
+    double delta = 0.0;
+    double gamma = 0.0;
+    double theta = 0.0;
+    double vega = 0.0;
+    double unrealized_pnl = 0.0;
+    double market_value = 0.0;    // Current call + put marks
+    uint32_t positions = 0;
+
+    void add(const StraddlePosition& position, double sign) {
+        delta += sign * position.delta;
+        gamma += sign * position.gamma;
+        theta += sign * position.theta;
+        vega += sign * position.vega;
+        unrealized_pnl += sign * position.unrealized_pnl.to_double();
+        market_value += sign * position.calculate_position_value().to_double();
+    }
+};
+
+class PositionBook {
+public:
+    PositionBook(size_t capacity, size_t journal_capacity);
+
+    PositionBook(const PositionBook&) = delete;
+    PositionBook& operator=(const PositionBook&) = delete;
+
+    size_t capacity() const { return capacity_; }
+    size_t journal_capacity() const { return journal_capacity_; }
+    size_t size() const { return active_.load(std::memory_order_acquire); }
+    bool full() const { return size() >= capacity_; }
+
+    // ---- Writer ----
+
+    // Copy into a free slot, ACTIVE unless it is ENTRY_PENDING; nullptr
+    // when the book is full
+    StraddlePosition* open(const StraddlePosition& position);
+
+    // Apply f to an open position as one atomic update for readers; the
+    // position's change is carried into the exposure totals
+    template<typename F>
+    void modify(StraddlePosition& position, F&& f) {
+        Slot& slot = slot_of(position);
+        begin_write(exposure_version_);
+        begin_write(slot.version);
+        apply_exposure(slot.position, -1.0);
+        f(slot.position);
+        apply_exposure(slot.position, 1.0);
+        end_write(slot.version);
+        end_write(exposure_version_);
+    }
+
+    // Record the position in the journal and free its slot
+    void close(StraddlePosition& position);
+
+    // Free the slot of a position that never reached the market (no journal entry)
+    void discard(StraddlePosition& position);
+
+    // Visit open positions on one underlying (positions may be closed from f)
+    template<typename F>
+    void for_each_on_symbol(uint32_t symbol_id, F&& f) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (symbols_[i] == symbol_id) {
+                f(slots_[i].position);
+            }
+        }
+    }
+
+    template<typename F>
+    void for_each_active(F&& f) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (symbols_[i] != FREE) {
+                f(slots_[i].position);
+            }
+        }
+    }
+
+    bool has_position(uint32_t symbol_id) const;
+
+    // ---- Readers ----
+
+    // Consistent copies of the open positions; returns the number written
+    size_t snapshot_active(StraddlePosition* out, size_t max) const;
+
+    // Closes recorded so far (the journal keeps the last journal_capacity)
+    uint64_t closed_count() const { return journal_published_.load(std::memory_order_acquire); }
+
+    // Copy journal entries [first, first + max); stops at the first entry
+    // not yet written or already overwritten
+    size_t read_closed(uint64_t first, StraddlePosition* out, size_t max) const;
+
+    // Consistent totals over all open positions / those on one underlying
+    PortfolioExposure portfolio_exposure() const;
+    PortfolioExposure symbol_exposure(uint32_t symbol_id) const;
+
+private:
+    static constexpr uint32_t FREE = UINT32_MAX;
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> version{0};
+        StraddlePosition position{};
+    };
+
+    static void begin_write(std::atomic<uint64_t>& version) {
+        version.store(version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    static void end_write(std::atomic<uint64_t>& version) {
+        version.store(version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    size_t index_of(const StraddlePosition& position) const {
+        const char* first = reinterpret_cast<const char*>(&slots_[0].position);
+        return static_cast<size_t>(reinterpret_cast<const char*>(&position) - first) / sizeof(Slot);
+    }
+
+    Slot& slot_of(StraddlePosition& position) { return slots_[index_of(position)]; }
+
+    // Caller holds exposure_version_ for writing
+    void apply_exposure(const StraddlePosition& position, double sign) {
+        portfolio_.add(position, sign);
+        if (position.symbol_id < by_symbol_size_) {
+            by_symbol_[position.symbol_id].add(position, sign);
+        }
+    }
+
+    void count_position(uint32_t symbol_id, int delta);
+    PortfolioExposure read_exposure(const PortfolioExposure& source) const;
+
+    size_t capacity_;
+    size_t journal_capacity_;
+    std::unique_ptr<Slot[]> slots_;
+    std::unique_ptr<uint32_t[]> symbols_;        // Writer-side index, FREE when empty
+    std::unique_ptr<StraddlePosition[]> journal_;
+    std::atomic<size_t> active_{0};
+
+    // Journal seqlock: reserved before an entry is overwritten, published after
+    std::atomic<uint64_t> journal_reserved_{0};
+    std::atomic<uint64_t> journal_published_{0};
+
+    // Exposure totals, indexed by symbol_id below constants::MAX_SYMBOLS
+    alignas(64) std::atomic<uint64_t> exposure_version_{0};
+    PortfolioExposure portfolio_;
+    size_t by_symbol_size_;
+    std::unique_ptr<PortfolioExposure[]> by_symbol_;
+};
+
+} // namespace hft::strategy
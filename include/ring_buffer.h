@@ -0,0 +1,360 @@
+/*
+ * ===================================================================
+ *                     LOCK-FREE RING BUFFERS
+ * ===================================================================
+ *
+ * Bounded lock-free queues for moving market data between threads
+ *
+ * VARIANTS:
+ * - SPSCRingBuffer: one producer, one consumer (feed -> worker)
+ * - MPMCRingBuffer: many producers, many consumers (feed fan-in)
+ *
+ * PERFORMANCE FEATURES:
+ * - Power-of-two capacity, mask-based wrap (no division)
+ * - Producer and consumer indices on separate cache lines
+ * - SPSC caches the opposite index to avoid cross-core reads
+ * - MPMC uses per-slot sequence numbers (Vyukov bounded queue)
+ * - Batch push_n/pop_n amortize atomics across many events
+ * - Slot storage is a separate zero-filled mapping (optionally on
+ *   hugepages), so constructing a ring does not touch its pages
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "page_buffer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace hft::data {
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+constexpr bool is_power_of_two(size_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+// Single-producer / single-consumer ring buffer
+template<typename T, size_t Capacity>
+class alignas(CACHE_LINE_SIZE) SPSCRingBuffer {
+    static_assert(is_power_of_two(Capacity), "SPSCRingBuffer capacity must be a power of two");
+    static_assert(std::is_trivially_destructible<T>::value, "ring slots are never destroyed");
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    // Producer-owned line: write index plus its cached view of the read index
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+    size_t cached_head_{0};
+
+    // Consumer-owned line: read index plus its cached view of the write index
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+    size_t cached_tail_{0};
+
+    // Read-only after construction, kept off both index lines
+    alignas(CACHE_LINE_SIZE) PageBuffer storage_;
+    T* buffer_;
+
+public:
+    // numa_node: the consumer's node (-1 = wherever the pages are first touched)
+    explicit SPSCRingBuffer(bool use_hugepages = false, int numa_node = -1)
+        : storage_(Capacity * sizeof(T), use_hugepages, numa_node),
+          buffer_(static_cast<T*>(storage_.data())) {}
+
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+    bool on_hugepages() const { return storage_.on_hugepages(); }
+    int numa_node() const { return storage_.numa_node(); }
+
+    // Lock-free push operation (producer thread only)
+    bool push(const T& item) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == Capacity) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity) {
+                return false; // Buffer full
+            }
+        }
+
+        new (&buffer_[tail & MASK]) T(item);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Push up to count items, returns how many were accepted
+    size_t push_n(const T* items, size_t count) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t free_slots = Capacity - (tail - cached_head_);
+        if (free_slots < count) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free_slots = Capacity - (tail - cached_head_);
+        }
+
+        const size_t n = count < free_slots ? count : free_slots;
+        for (size_t i = 0; i < n; ++i) {
+            new (&buffer_[(tail + i) & MASK]) T(items[i]);
+        }
+        if (n > 0) {
+            tail_.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // Lock-free pop operation (consumer thread only)
+    bool pop(T& item) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false; // Buffer empty
+            }
+        }
+
+        item = buffer_[head & MASK];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pop up to max_count items, returns how many were written to items
+    size_t pop_n(T* items, size_t max_count) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t available = cached_tail_ - head;
+        if (available < max_count) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = cached_tail_ - head;
+        }
+
+        const size_t n = max_count < available ? max_count : available;
+        for (size_t i = 0; i < n; ++i) {
+            items[i] = buffer_[(head + i) & MASK];
+        }
+        if (n > 0) {
+            head_.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    size_t size() const {
+        const size_t h = head_.load(std::memory_order_acquire);
+        const size_t t = tail_.load(std::memory_order_acquire);
+        return t - h;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    bool full() const {
+        return size() == Capacity;
+    }
+};
+
+// Bounded multi-producer / multi-consumer ring buffer.
+// Each slot carries a sequence number: seq == pos means free for the
+// producer claiming pos, seq == pos + 1 means filled for the consumer
+// claiming pos. Claims are a single CAS on the shared position counter.
+// Slots store the sequence relative to their own index (the lap base
+// pos & ~MASK), so the zero-filled mapping is already a valid empty ring
+// and pages are only faulted in as the ring wraps into them.
+template<typename T, size_t Capacity>
+class alignas(CACHE_LINE_SIZE) MPMCRingBuffer {
+    static_assert(is_power_of_two(Capacity), "MPMCRingBuffer capacity must be a power of two");
+    static_assert(std::is_trivially_destructible<T>::value, "ring slots are never destroyed");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "slot sequences must be plain words");
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+    alignas(CACHE_LINE_SIZE) PageBuffer storage_;
+    Cell* cells_;
+
+    static constexpr size_t lap(size_t pos) { return pos & ~MASK; }
+
+    Cell& cell_at(size_t pos) { return cells_[pos & MASK]; }
+
+    static T* slot(Cell& cell) { return std::launder(reinterpret_cast<T*>(cell.data)); }
+
+public:
+    explicit MPMCRingBuffer(bool use_hugepages = false, int numa_node = -1)
+        : storage_(Capacity * sizeof(Cell), use_hugepages, numa_node),
+          cells_(static_cast<Cell*>(storage_.data())) {}
+
+    MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+    bool on_hugepages() const { return storage_.on_hugepages(); }
+    int numa_node() const { return storage_.numa_node(); }
+
+    // Lock-free push, safe from any number of producer threads
+    bool push(const T& item) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cell_at(pos);
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(lap(pos));
+
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    new (cell.data) T(item);
+                    cell.sequence.store(lap(pos) + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Buffer full
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claim a contiguous run of free slots with one CAS and fill it.
+    // Returns how many items were accepted (0 when full).
+    size_t push_n(const T* items, size_t count) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t n = 0;
+            while (n < count) {
+                const size_t seq = cell_at(pos + n).sequence.load(std::memory_order_acquire);
+                if (seq != lap(pos + n)) break;
+                ++n;
+            }
+
+            if (n == 0) {
+                const size_t seq = cell_at(pos).sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(lap(pos)) < 0) {
+                    return 0; // Buffer full
+                }
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                for (size_t i = 0; i < n; ++i) {
+                    Cell& cell = cell_at(pos + i);
+                    new (cell.data) T(items[i]);
+                    cell.sequence.store(lap(pos + i) + 1, std::memory_order_release);
+                }
+                return n;
+            }
+        }
+    }
+
+    // push_n without a source array: claim a run of up to count slots with
+    // one CAS, default-construct each and let fill(T& slot, size_t i)
+    // write item i straight into the ring. Returns how many were filled.
+    template<typename Fill>
+    size_t emplace_n(size_t count, Fill&& fill) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t n = 0;
+            while (n < count) {
+                const size_t seq = cell_at(pos + n).sequence.load(std::memory_order_acquire);
+                if (seq != lap(pos + n)) break;
+                ++n;
+            }
+
+            if (n == 0) {
+                const size_t seq = cell_at(pos).sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(lap(pos)) < 0) {
+                    return 0; // Buffer full
+                }
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                for (size_t i = 0; i < n; ++i) {
+                    Cell& cell = cell_at(pos + i);
+                    fill(*new (cell.data) T(), i);
+                    cell.sequence.store(lap(pos + i) + 1, std::memory_order_release);
+                }
+                return n;
+            }
+        }
+    }
+
+    // Lock-free pop, safe from any number of consumer threads
+    bool pop(T& item) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cell_at(pos);
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(lap(pos) + 1);
+
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    item = *slot(cell);
+                    cell.sequence.store(lap(pos) + Capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Buffer empty
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Claim a contiguous run of filled slots with one CAS and drain it.
+    // Returns how many items were written to items (0 when empty).
+    size_t pop_n(T* items, size_t max_count) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t n = 0;
+            while (n < max_count) {
+                const size_t seq = cell_at(pos + n).sequence.load(std::memory_order_acquire);
+                if (seq != lap(pos + n) + 1) break;
+                ++n;
+            }
+
+            if (n == 0) {
+                const size_t seq = cell_at(pos).sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(lap(pos) + 1) < 0) {
+                    return 0; // Buffer empty
+                }
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                for (size_t i = 0; i < n; ++i) {
+                    Cell& cell = cell_at(pos + i);
+                    items[i] = *slot(cell);
+                    cell.sequence.store(lap(pos + i) + Capacity, std::memory_order_release);
+                }
+                return n;
+            }
+        }
+    }
+
+    // Approximate under concurrency
+    size_t size() const {
+        const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    bool full() const {
+        return size() >= Capacity;
+    }
+};
+
+} // namespace hft::data
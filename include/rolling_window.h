@@ -0,0 +1,106 @@
+/*
+ * ===================================================================
+ *                    SORTED ROLLING WINDOW
+ * ===================================================================
+ *
+ * The last N samples of a series, kept both in arrival order and
+ * sorted, for O(1) min / max and O(log N) rank queries
+ *
+ * PERFORMANCE FEATURES:
+ * - Fixed inline storage: no allocation, memory bounded by N
+ * - push is one binary search plus a contiguous shift of the sorted
+ *   copy (memmove-friendly, at most N doubles)
+ * - Rank queries are two binary searches
+ *
+ * Running sums kept alongside a window (add the new sample, subtract
+ * the evicted one) drift in floating point; ResyncCounter says when to
+ * recompute them exactly from the window instead.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hft::data {
+
+template<size_t N>
+class SortedWindow {
+    static_assert(N > 0, "SortedWindow needs room for a sample");
+
+public:
+    static constexpr size_t CAPACITY = N;
+
+    // Append, evicting the oldest sample once full
+    void push(double value) {
+        double* sorted = sorted_.data();
+        if (count_ == N) {
+            const double old = ring_[head_];
+            ring_[head_] = value;
+            head_ = (head_ + 1) % N;
+            double* pos = std::lower_bound(sorted, sorted + count_, old);
+            std::copy(pos + 1, sorted + count_, pos);
+            --count_;
+        } else {
+            ring_[count_] = value;
+        }
+        double* pos = std::upper_bound(sorted, sorted + count_, value);
+        std::copy_backward(pos, sorted + count_, sorted + count_ + 1);
+        *pos = value;
+        ++count_;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    bool full() const { return count_ == N; }
+
+    // age 0 is the newest sample; requires age < size()
+    double recent(size_t age) const { return ring_[(head_ + count_ - 1 - age) % N]; }
+    double newest() const { return recent(0); }
+    double oldest() const { return ring_[head_]; }   // Next to be evicted once full
+
+    double min() const { return sorted_[0]; }
+    double max() const { return sorted_[count_ - 1]; }
+
+    // Mid-rank of value among the samples, in [0, 1]: ties count half, so
+    // a flat window ranks its own value at 0.5
+    double rank_of(double value) const {
+        const double* sorted = sorted_.data();
+        const double* first = std::lower_bound(sorted, sorted + count_, value);
+        const double* last = std::upper_bound(first, sorted + count_, value);
+        return count_ ? ((first - sorted) + 0.5 * (last - first)) / count_ : 0.5;
+    }
+
+    // Sorted samples, [0, size())
+    const double* sorted() const { return sorted_.data(); }
+
+private:
+    std::array<double, N> ring_{};
+    std::array<double, N> sorted_{};
+    size_t count_ = 0;
+    size_t head_ = 0;   // Oldest sample once full
+};
+
+// Exact recompute schedule for incrementally updated window sums
+class ResyncCounter {
+public:
+    static constexpr uint32_t INTERVAL = 4096;   // Updates between exact recomputes (bounds FP drift)
+
+    // Count one incremental update; true when the sums are due a recompute
+    bool due() {
+        if (++updates_ < INTERVAL) {
+            return false;
+        }
+        updates_ = 0;
+        return true;
+    }
+
+private:
+    uint32_t updates_ = 0;
+};
+
+} // namespace hft::data
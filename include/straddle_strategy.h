@@ -26,102 +26,66 @@
 
 #include "hft_straddle_system.h"
 #include "market_data.h"
+#include "chain_pricing.h"
+#include "position_book.h"
+#include "pnl_counter.h"
+#include "volatility_surface.h"
+#include "options_chain.h"
+#include "rolling_window.h"
+#include "trade_journal.h"
 #include <vector>
 #include <memory>
+#include <cassert>
+#include <thread>
+#include <array>
 #include <atomic>
-#include <unordered_map>
+#include <string>
 
 namespace hft::strategy {
 
-// Position status enumeration
-enum class PositionStatus : uint8_t {
-    NONE = 0,
-    ANALYZING = 1,
-    ENTRY_PENDING = 2,
-    ACTIVE = 3,
-    EXIT_PENDING = 4,
-    CLOSED = 5,
-    ERROR = 6
-};
-
-// Trade direction for straddle components
-enum class TradeDirection : uint8_t {
-    LONG = 0,
-    SHORT = 1
-};
-
-// Straddle position structure
-struct alignas(64) StraddlePosition {
-    uint32_t position_id;
-    uint32_t symbol_id;
-    std::string symbol;
-    
-    // Entry details
-    data::Timestamp entry_time;
-    data::Price underlying_entry_price;
-    data::Price call_strike;
-    data::Price put_strike;
-    data::Price call_entry_price;
-    data::Price put_entry_price;
-    data::Price total_premium_paid;
-    
-    // Current status
-    PositionStatus status;
-    data::Timestamp last_update;
-    data::Price current_call_price;
-    data::Price current_put_price;
-    data::Price current_underlying_price;
-    
-    // P&L tracking
-    data::Price unrealized_pnl;
-    data::Price realized_pnl;
-    data::Price max_profit;
-    data::Price max_loss;
-    
-    // Greeks
-    double delta;
-    double gamma;
-    double theta;
-    double vega;
-    
-    // Risk management
-    data::Price profit_target;
-    data::Price stop_loss;
-    uint16_t days_held;
-    uint16_t max_hold_days;
-    
-    StraddlePosition() = default;
-    
-    // Calculate current position value
-    data::Price calculate_position_value() const {
-        return data::Price(current_call_price.to_double() + current_put_price.to_double());
-    }
-    
-    // Calculate current P&L
-    data::Price calculate_pnl() const {
-        return calculate_position_value() - total_premium_paid;
-    }
-    
-    // Calculate return percentage
-    double calculate_return_pct() const {
-        if (total_premium_paid.to_double() == 0) return 0.0;
-        return (calculate_pnl().to_double() / total_premium_paid.to_double()) * 100.0;
-    }
-    
-    // Check if position should be closed
-    bool should_close() const;
-};
-
 // Volatility analysis for entry timing
+//
+// Per tick and per symbol, all O(1) apart from one binary search and a
+// contiguous shift of at most MAX_HISTORY doubles:
+// - Rolling variance of the last VOLATILITY_WINDOW log returns by a
+//   sliding-window Welford update over a return ring
+// - Volatility history kept both in time order (ring) and sorted, so the
+//   percentile of each new sample is found by binary search when it is
+//   added and the regime test just reads it back
+// - Running sum of squared history for the long-run variance forecast
+// State lives in a dense array indexed by symbol_id, allocated per symbol
+// on its first price.
 class VolatilityAnalyzer {
-private:
+public:
     static constexpr size_t VOLATILITY_WINDOW = 20;
     static constexpr double LOW_VOL_PERCENTILE = 0.30;  // Bottom 30% volatility
+    static constexpr size_t MAX_HISTORY = 1000;         // Volatility samples kept per symbol
+    
+private:
+    struct SymbolState {
+        double last_price = 0.0;
+        
+        // Log-return ring and its running mean / sum of squared deviations
+        std::array<double, VOLATILITY_WINDOW> returns{};
+        size_t return_count = 0;
+        size_t return_head = 0;         // Oldest return once full
+        double mean = 0.0;
+        double m2 = 0.0;
+        data::ResyncCounter return_resync;
+        double current_volatility = 0.0;
+        
+        // Volatility samples
+        data::SortedWindow<MAX_HISTORY> history;
+        double history_sq_sum = 0.0;
+        data::ResyncCounter history_resync;
+        double percentile = 0.5;        // Of the newest sample
+    };
     
-    std::unordered_map<uint32_t, std::vector<double>> volatility_history_;
-    std::unordered_map<uint32_t, double> current_volatility_;
+    std::vector<std::unique_ptr<SymbolState>> symbols_;
     
 public:
+    VolatilityAnalyzer();
+    
     // Add price for volatility calculation
     void add_price(uint32_t symbol_id, const data::Price& price, const data::Timestamp& timestamp);
     
@@ -138,7 +102,43 @@ public:
     double predict_volatility(uint32_t symbol_id, int days_ahead) const;
     
 private:
-    double calculate_rolling_volatility(const std::vector<double>& prices) const;
+    const SymbolState* state(uint32_t symbol_id) const {
+        return symbol_id < symbols_.size() ? symbols_[symbol_id].get() : nullptr;
+    }
+    static void add_return(SymbolState& s, double r);
+    static void add_volatility(SymbolState& s, double volatility);
+};
+
+// Structure-of-arrays inputs for chain-level implied volatility
+struct ChainImpliedVolInput {
+    const double* market_price;
+    const double* spot;
+    const double* strike;
+    const double* time_to_expiry;
+    const double* rate;
+    const uint8_t* is_call;
+    const double* initial_guess;   // Optional warm start (may be null, <= 0 ignored)
+    size_t count;
+};
+
+// Bounded-iteration settings for the chain implied volatility solver
+struct ImpliedVolSolverConfig {
+    int max_iterations;            // Hard cap on Halley steps per contract
+    double price_tolerance;        // Absolute price error accepted as converged
+    double min_volatility;
+    double max_volatility;
+    
+    ImpliedVolSolverConfig() : max_iterations(8),
+                               price_tolerance(1e-8),
+                               min_volatility(1e-4),
+                               max_volatility(5.0) {}
+};
+
+// Instruction set used by the batch pricing kernels
+enum class SimdLevel : uint8_t {
+    SCALAR = 0,
+    AVX2 = 1,
+    AVX512 = 2
 };
 
 // Options pricing and Greeks calculator
@@ -164,6 +164,30 @@ public:
     static double straddle_breakeven_lower(double put_strike, double total_premium);
     static double straddle_max_profit_probability(double S, double K, double T, double sigma);
     
+    // Batch pricing: price and all five Greeks for a whole chain in one pass.
+    // d1/d2, N(d1), N(d2) and the pdf are computed once per contract and the
+    // widest kernel supported by the running CPU is selected at runtime.
+    static void price_chain(const ChainPricingInput& input, const ChainPricingOutput& output);
+    static void price_chain(const ChainPricingInput& input, const ChainPricingOutput& output,
+                            SimdLevel level);
+    
+    // Chain-level implied volatility: rational (Corrado-Miller) or warm-start
+    // initial guess, then Halley steps evaluated with price_chain across all
+    // unconverged strikes at once. Contracts priced outside no-arbitrage bounds
+    // get 0.0. Returns the number of contracts that converged.
+    static size_t solve_implied_volatility_chain(const ChainImpliedVolInput& input, double* implied_vol,
+                                                 const ImpliedVolSolverConfig& config = ImpliedVolSolverConfig{});
+    
+    // Refresh OptionTick::implied_volatility for a whole chain from its mid
+    // quotes, warm-started from the IV already stored on each tick
+    static size_t update_chain_implied_volatility(std::vector<data::OptionTick>& chain,
+                                                  const data::Price& underlying_price,
+                                                  double risk_free_rate = 0.02,
+                                                  const ImpliedVolSolverConfig& config = ImpliedVolSolverConfig{});
+    
+    // Widest SIMD level available on this CPU (and compiled into this build)
+    static SimdLevel detect_simd_level();
+    
 private:
     static double cumulative_normal_distribution(double x);
     static double normal_pdf(double x);
@@ -171,8 +195,8 @@ private:
 
 // Core straddle strategy engine
 class StraddleStrategy {
-private:
-    // Configuration parameters
+public:
+    // Configuration parameters (expiry bounds in days)
     struct Config {
         double otm_offset_pct;
         double max_premium_pct;
@@ -185,6 +209,8 @@ private:
         double max_time_to_expiry;
         size_t max_positions;
         double position_size_pct;
+        size_t max_closed_positions;   // Journal capacity (most recent closes kept)
+        bool enable_trade_logging;
         
         Config() : otm_offset_pct(0.02),
                    max_premium_pct(0.05),
@@ -196,9 +222,15 @@ private:
                    min_time_to_expiry(7.0),
                    max_time_to_expiry(60.0),
                    max_positions(10),
-                   position_size_pct(0.02) {}
+                   position_size_pct(0.02),
+                   max_closed_positions(4096),
+                   enable_trade_logging(false) {}
     };
     
+    // Dollar P&L per point of premium (one contract per leg)
+    static constexpr double CONTRACT_MULTIPLIER = 100.0;
+    
+private:
     Config config_;
     std::atomic<bool> running_{false};
     
@@ -206,21 +238,54 @@ private:
     std::unique_ptr<VolatilityAnalyzer> volatility_analyzer_;
     std::unique_ptr<OptionsCalculator> options_calculator_;
     
-    // Position management
-    std::vector<StraddlePosition> active_positions_;
-    std::vector<StraddlePosition> closed_positions_;
+    // Position management (fixed capacity, lock-free for readers)
+    PositionBook positions_;
     std::atomic<uint32_t> next_position_id_{1};
-    mutable std::mutex positions_mutex_;
     
     // Performance tracking
     std::atomic<uint64_t> total_trades_{0};
     std::atomic<uint64_t> winning_trades_{0};
-    std::atomic<double> total_pnl_{0.0};
-    std::atomic<double> max_drawdown_{0.0};
+    data::PnlCounter total_pnl_;                  // Dollars, fixed point
+    std::atomic<int64_t> max_drawdown_{0};        // Fixed point; strategy thread writes
+    int64_t peak_pnl_ = 0;
+    std::atomic<double> trade_return_sum_{0.0};     // Over every closed trade,
+    std::atomic<double> trade_return_sq_sum_{0.0};  // not just the journal
+    
+    // Event time: every decision is stamped with the time of the tick that
+    // triggered it, so live trading and replay follow the same clock
+    data::Timestamp current_time_;
+    std::vector<data::MarketTick> latest_ticks_;  // By symbol_id
+    
+    // Latest quotes and fitted IV surfaces by underlying_id, both
+    // maintained from on_options_data
+    std::vector<std::unique_ptr<data::VolatilitySurface>> surfaces_;
+    std::vector<std::unique_ptr<data::OptionsChain>> chains_;
+    
+    // Order path; without one, entries and exits are assumed filled at
+    // their quoted prices (backtests). With one, a position is booked
+    // ENTRY_PENDING / EXIT_PENDING until the router reports its pair sent,
+    // and rolled back if the pair never reaches the wire.
+    execution::OrderRouter* order_router_ = nullptr;
+    
+    // Pre-trade limits; kept current with each symbol's exposure when set
+    RiskManager* risk_manager_ = nullptr;
+    
+    // The thread delivering events, bound by the first one (checked in
+    // debug builds only)
+    std::atomic<std::thread::id> event_thread_{};
+    void check_event_thread() {
+#ifndef NDEBUG
+        std::thread::id expected{};
+        const std::thread::id self = std::this_thread::get_id();
+        if (!event_thread_.compare_exchange_strong(expected, self, std::memory_order_relaxed)) {
+            assert(expected == self && "StraddleStrategy events must come from a single thread");
+        }
+#endif
+    }
     
-    // Market data access
-    std::function<bool(uint32_t, data::MarketTick&)> market_data_callback_;
-    std::function<bool(uint32_t, std::vector<data::OptionTick>&)> options_data_callback_;
+    // Trade records go here when set; otherwise enable_trade_logging
+    // writes the same lines synchronously to std::clog
+    data::TradeJournal* trade_journal_ = nullptr;
     
 public:
     explicit StraddleStrategy(const Config& config = Config{});
@@ -231,11 +296,25 @@ public:
     void start();
     void stop();
     
-    // Data callbacks
-    void set_market_data_callback(std::function<bool(uint32_t, data::MarketTick&)> callback);
-    void set_options_data_callback(std::function<bool(uint32_t, std::vector<data::OptionTick>&)> callback);
-    
-    // Main strategy execution
+    // Entry / exit orders for both legs go out as one pair through the
+    // router (not owned; must outlive the strategy or be reset to nullptr).
+    // The strategy thread is its producer: it takes the send reports, and
+    // polls the router itself when no send thread is running.
+    void set_order_router(execution::OrderRouter* router) { order_router_ = router; }
+    
+    // Entries must pass risk->can_open_position, and every change to a
+    // symbol's positions is reported through update_symbol_risk (not
+    // owned; same lifetime rule as the router). Set its portfolio value
+    // first: without one, every entry is refused.
+    void set_risk_manager(RiskManager* risk) { risk_manager_ = risk; }
+    
+    // Opens and closes are journaled as binary records (not owned; same
+    // lifetime rule as the router). The strategy thread is the producer.
+    void set_trade_journal(data::TradeJournal* journal) { trade_journal_ = journal; }
+    
+    // Main strategy execution. Not synchronized: every event must come
+    // from one thread (debug builds assert it); stop() releases that
+    // thread so a later run may use another.
     void on_market_data(const data::MarketTick& tick);
     void on_options_data(const data::OptionTick& tick);
     
@@ -248,32 +327,66 @@ public:
     
     // Strategy logic
     bool is_good_entry_opportunity(uint32_t symbol_id, const data::MarketTick& tick);
-    std::pair<data::Price, data::Price> select_optimal_strikes(const data::MarketTick& underlying,
-                                                               const std::vector<data::OptionTick>& options_chain);
+    // Call and put legs on the nearest in-band expiry; nullptr when missing
+    std::pair<const data::OptionTick*, const data::OptionTick*> select_optimal_strikes(
+        const data::MarketTick& underlying, const data::OptionsChain& chain) const;
     double calculate_expected_profit(const StraddlePosition& position) const;
     
     // Performance analytics
     double get_win_rate() const;
-    double get_total_pnl() const { return total_pnl_.load(); }
+    double get_total_pnl() const { return total_pnl_.to_double(); }
     double get_average_trade_pnl() const;
-    double get_max_drawdown() const { return max_drawdown_.load(); }
+    double get_max_drawdown() const { return data::PnlCounter::to_double(max_drawdown_.load(std::memory_order_relaxed)); }
     double get_sharpe_ratio() const;
     size_t get_active_positions_count() const;
     size_t get_total_trades_count() const { return total_trades_.load(); }
+    const Config& get_config() const { return config_; }
+    data::Timestamp current_time() const { return current_time_; }
+    const data::VolatilitySurface* get_volatility_surface(uint32_t underlying_id) const;
+    const data::OptionsChain* get_options_chain(uint32_t underlying_id) const;
     
-    // Position access
+    // Position access (copies; never blocks the strategy thread)
     std::vector<StraddlePosition> get_active_positions() const;
     std::vector<StraddlePosition> get_closed_positions() const;
+    size_t snapshot_active_positions(StraddlePosition* out, size_t max) const;
+    const PositionBook& get_position_book() const { return positions_; }
+    
+    // Running greeks / P&L totals (O(1), any thread)
+    PortfolioExposure get_portfolio_exposure() const { return positions_.portfolio_exposure(); }
+    PortfolioExposure get_symbol_exposure(uint32_t symbol_id) const { return positions_.symbol_exposure(symbol_id); }
     
 private:
     void update_performance_metrics();
     bool validate_position_parameters(const StraddlePosition& position) const;
-    void log_trade_execution(const StraddlePosition& position, const std::string& action);
+    void log_trade_execution(const StraddlePosition& position, data::JournalEvent event);
+    void report_symbol_risk(uint32_t symbol_id);
+    void realize_close(StraddlePosition& position);
+    void process_order_reports();
+    void apply_order_report(uint64_t pair_id, bool sent);
 };
 
-// Risk manager for the strategy
+// Risk manager for the strategy; limits are fractions of portfolio value.
+//
+// Pre-trade checks read a precomputed Headroom snapshot: what is left
+// under every limit, in dollars of capital at risk, kept current
+// incrementally as exposure and P&L change. can_open_position is a
+// handful of compares over a few cache lines with no early-out branches.
+//
+// Symbols map to a sector and a correlation group, both indexed by
+// symbol_id (UNASSIGNED = never limited). A sector's capital is capped at
+// max_sector_exposure; symbols whose returns correlate above
+// max_correlation share a group, and a group is sized as one position
+// (max_position_size).
+//
+// The kill switch halts all order flow: engaged by hand or when a loss
+// limit is breached, cleared only by release_kill_switch(). Hand it to
+// OrderRouter::set_kill_switch so the send thread honours it too.
+//
+// Threading: limits, buckets, exposure and P&L updates and
+// can_open_position on one thread (the strategy); getters and the kill
+// switch from any thread.
 class RiskManager {
-private:
+public:
     struct RiskLimits {
         double max_portfolio_risk;
         double max_position_size;
@@ -291,32 +404,128 @@ private:
                        max_daily_loss(0.02),
                        max_monthly_loss(0.05) {}
     };
+
+    // One breached limit, as numbers; describe() renders it for logs
+    struct Alert {
+        enum class Kind : uint8_t {
+            PORTFOLIO_RISK, POSITION_COUNT, DAILY_LOSS, MONTHLY_LOSS,
+            SECTOR_EXPOSURE, CORRELATED_EXPOSURE, KILL_SWITCH
+        };
+        Kind kind;
+        double value;    // Current level (risk fraction, positions, dollars;
+                         // buckets over their limit for the bucket kinds)
+        double limit;    // Level it crossed
+    };
+    static constexpr size_t MAX_ALERTS = 7;     // One per kind
+    
+    static constexpr size_t MAX_BUCKETS = 32;   // Sectors and correlation groups, each
+    static constexpr uint8_t UNASSIGNED = 0;
+    
+    // Capital (dollars) that can still be added under each limit
+    struct alignas(64) Headroom {
+        double portfolio;
+        double position;
+        uint32_t positions;          // Left under max_positions
+        bool trading;                // No loss limit breached
+        std::array<double, MAX_BUCKETS> sector;
+        std::array<double, MAX_BUCKETS> correlation;
+    };
+    
+private:
+    struct Buckets {
+        uint8_t sector = UNASSIGNED;
+        uint8_t correlation = UNASSIGNED;
+    };
     
     RiskLimits limits_;
-    std::atomic<double> current_portfolio_risk_{0.0};
-    std::atomic<double> daily_pnl_{0.0};
-    std::atomic<double> monthly_pnl_{0.0};
+    Headroom headroom_{};
+    std::array<Buckets, constants::MAX_SYMBOLS> buckets_{};
+    
+    // Exposure as last reported (strategy thread)
+    std::array<double, constants::MAX_SYMBOLS> symbol_capital_{};
+    std::array<uint32_t, constants::MAX_SYMBOLS> symbol_positions_{};
+    std::array<double, MAX_BUCKETS> sector_capital_{};
+    std::array<double, MAX_BUCKETS> correlation_capital_{};
+    double capital_ = 0.0;
+    uint32_t positions_ = 0;
+    
+    // Published for readers on other threads
+    std::atomic<double> current_portfolio_risk_{0.0};   // Stored, never read-modify-written
+    data::PnlCounter daily_pnl_;
+    data::PnlCounter monthly_pnl_;
+    std::atomic<double> portfolio_value_{0.0};
+    std::atomic<uint32_t> open_positions_{0};
+    std::atomic<uint32_t> sector_breaches_{0};          // Bit per bucket over its limit
+    std::atomic<uint32_t> correlation_breaches_{0};
+    
+    alignas(64) std::atomic<bool> kill_switch_{false};  // Own line: polled by the send thread
     
 public:
     explicit RiskManager(const RiskLimits& limits = RiskLimits{});
     
-    // Risk checks
+    // ---- Pre-trade (hot path) ----
+    // A straddle putting capital dollars at risk on symbol_id. Bitwise &
+    // keeps every compare branch-free; only the bucket lookup is bounded.
+    bool can_open_position(uint32_t symbol_id, double capital) const {
+        const Buckets b = symbol_id < buckets_.size() ? buckets_[symbol_id] : Buckets{};
+        const Headroom& h = headroom_;
+        return !kill_switch_.load(std::memory_order_relaxed) & h.trading & (h.positions > 0) &
+               (capital <= h.position) & (capital <= h.portfolio) &
+               (capital <= h.sector[b.sector]) & (capital <= h.correlation[b.correlation]);
+    }
+    // Same limits for a position priced at its premium; against another
+    // portfolio_value than the one risk was updated with, the limits are
+    // evaluated from the running totals instead of the snapshot
     bool can_open_position(const StraddlePosition& position, double portfolio_value) const;
     bool should_reduce_exposure() const;
     bool should_stop_trading() const;
-    
-    // Risk monitoring
-    void update_position_risk(const StraddlePosition& position);
+    const Headroom& get_headroom() const { return headroom_; }
+    
+    // ---- Buckets (cold) ----
+    // False for an unknown symbol_id or a bucket >= MAX_BUCKETS
+    bool set_sector(uint32_t symbol_id, uint8_t sector);
+    bool set_correlation_group(uint32_t symbol_id, uint8_t group);
+    
+    // ---- Risk monitoring ----
+    // Every limit scales with the portfolio value: until it is set, all
+    // headroom is zero and no position passes the pre-trade check
+    void set_portfolio_value(double portfolio_value);
+    // One symbol's exposure whenever it changes (O(1), updates the
+    // portfolio, sector and correlation headroom it affects). The totals
+    // are the sum of these reports; there is no whole-book setter to
+    // bypass the per-symbol state.
+    void update_symbol_risk(uint32_t symbol_id, const PortfolioExposure& exposure);
     void update_daily_pnl(double pnl);
+    void reset_daily_pnl();
+    void reset_monthly_pnl();
+    
+    // ---- Kill switch (any thread) ----
+    void engage_kill_switch() { kill_switch_.store(true, std::memory_order_release); }
+    void release_kill_switch() { kill_switch_.store(false, std::memory_order_release); }
+    bool is_kill_switch_engaged() const { return kill_switch_.load(std::memory_order_acquire); }
+    const std::atomic<bool>* kill_switch() const { return &kill_switch_; }
     
     // Risk metrics
     double get_portfolio_risk() const { return current_portfolio_risk_.load(); }
-    double get_daily_pnl() const { return daily_pnl_.load(); }
-    double get_monthly_pnl() const { return monthly_pnl_.load(); }
+    double get_daily_pnl() const { return daily_pnl_.to_double(); }
+    double get_monthly_pnl() const { return monthly_pnl_.to_double(); }
+    double get_portfolio_value() const { return portfolio_value_.load(std::memory_order_relaxed); }
+    const RiskLimits& get_limits() const { return limits_; }
     
     // Risk alerts
     bool is_risk_limit_breached() const;
+    // Hot path: into out[0, max) or arena storage, no strings built
+    size_t get_risk_alerts(Alert* out, size_t max) const;
+    data::Span<Alert> get_risk_alerts(data::MonotonicArena& arena) const;
     std::vector<std::string> get_risk_alerts() const;
+    static std::string describe(const Alert& alert);
+    
+private:
+    bool loss_limit_breached(double portfolio_value) const;
+    void refresh_headroom();
+    void refresh_trading();
+    void publish_totals();
+    void publish_breach(std::atomic<uint32_t>& breaches, size_t bucket, double headroom);
 };
 
 } // namespace hft::strategy
\ No newline at end of file
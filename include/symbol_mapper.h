@@ -0,0 +1,158 @@
+/*
+ * ===================================================================
+ *                        SYMBOL ID MAPPING
+ * ===================================================================
+ *
+ * Dense uint32_t ids for ticker symbols, shared by every feed thread
+ *
+ * PERFORMANCE FEATURES:
+ * - Tickers packed into an 8-byte integer key (no heap, no string hash)
+ * - Wait-free lookups: insert-only open-addressing table of atomic slots
+ * - Known universe frozen into a two-level hash-and-displace perfect
+ *   hash (~2 slots per symbol, a few KB for a full universe), published
+ *   as an immutable snapshot through an atomic pointer
+ * - Registration serialized by a mutex (cold path, bounded by MAX_SYMBOLS)
+ *
+ * Ids start at 1; 0 means unknown or unregistrable (empty tickers,
+ * tickers longer than SymbolKey::MAX_LENGTH, or a full universe).
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "hft_straddle_system.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hft::data {
+
+// Ticker packed little-endian into one word, zero padded
+struct SymbolKey {
+    static constexpr size_t MAX_LENGTH = 8;
+
+    uint64_t value = 0;
+
+    constexpr SymbolKey() = default;
+    constexpr explicit SymbolKey(uint64_t packed) : value(packed) {}
+
+    // Invalid (zero) key for empty symbols or ones longer than MAX_LENGTH
+    static constexpr SymbolKey from(std::string_view symbol) {
+        if (symbol.empty() || symbol.size() > MAX_LENGTH) {
+            return SymbolKey();
+        }
+        uint64_t packed = 0;
+        for (size_t i = 0; i < symbol.size(); ++i) {
+            packed |= static_cast<uint64_t>(static_cast<uint8_t>(symbol[i])) << (8 * i);
+        }
+        return SymbolKey(packed);
+    }
+
+    bool valid() const { return value != 0; }
+    std::string to_string() const;
+
+    constexpr bool operator==(const SymbolKey& other) const { return value == other.value; }
+    constexpr bool operator!=(const SymbolKey& other) const { return value != other.value; }
+};
+
+class SymbolMapper {
+public:
+    // Largest id handed out is MAX_SYMBOLS - 1 so ids index MAX_SYMBOLS-sized arrays
+    static constexpr size_t MAX_IDS = constants::MAX_SYMBOLS - 1;
+
+    SymbolMapper() = default;
+    ~SymbolMapper();
+
+    SymbolMapper(const SymbolMapper&) = delete;
+    SymbolMapper& operator=(const SymbolMapper&) = delete;
+
+    // Lookup, registering unknown symbols (thread-safe)
+    uint32_t get_id(std::string_view symbol) { return get_id(SymbolKey::from(symbol)); }
+    uint32_t get_id(SymbolKey key);
+
+    // Lookup without registering; returns 0 for unknown symbols (wait-free)
+    uint32_t find_id(std::string_view symbol) const { return find_id(SymbolKey::from(symbol)); }
+    uint32_t find_id(SymbolKey key) const;
+
+    const std::string& get_symbol(uint32_t id) const;
+    SymbolKey get_key(uint32_t id) const;
+    size_t size() const { return count_.load(std::memory_order_acquire); }
+
+    // Register symbols and rebuild the perfect-hash fast path over every
+    // symbol known so far. Safe to call while other threads look up.
+    // False when any symbol could not be registered (the rest still are).
+    bool freeze(const std::vector<std::string>& symbols);
+    bool is_frozen() const { return frozen_.load(std::memory_order_acquire) != nullptr; }
+    // Slots in the current snapshot (0 before the first freeze)
+    size_t frozen_slots() const {
+        const PerfectHash* frozen = frozen_.load(std::memory_order_acquire);
+        return frozen ? frozen->keys.size() : 0;
+    }
+
+private:
+    static constexpr unsigned TABLE_BITS = 11;
+    static constexpr size_t TABLE_SIZE = size_t(1) << TABLE_BITS;
+    static constexpr size_t TABLE_MASK = TABLE_SIZE - 1;
+    static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    struct Slot {
+        std::atomic<uint64_t> key{0};   // Published last (release)
+        std::atomic<uint32_t> id{0};
+    };
+
+    // Immutable snapshot. A key's bucket picks a displacement seed and
+    // the seeded hash picks its slot; the build chooses seeds so no two
+    // keys share a slot. Two hashes, one compare, no probing.
+    struct PerfectHash {
+        std::vector<uint32_t> seeds;    // Per bucket (~4 keys each)
+        std::vector<uint64_t> keys;     // Per slot (~2 per key); 0 = empty
+        std::vector<uint32_t> ids;
+
+        uint32_t find(uint64_t key) const {
+            const size_t slot = reduce(mix(key, seeds[reduce(mix(key, 0), seeds.size())]), keys.size());
+            return keys[slot] == key ? ids[slot] : 0;
+        }
+    };
+
+    // splitmix64 finalizer over the key offset by the seed
+    static uint64_t mix(uint64_t key, uint64_t seed) {
+        uint64_t x = key + seed * HASH_MULTIPLIER;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    // hash into [0, n) without a division
+    static size_t reduce(uint64_t hash, size_t n) {
+        __extension__ typedef unsigned __int128 uint128;
+        return static_cast<size_t>((static_cast<uint128>(hash) * n) >> 64);
+    }
+
+    static size_t slot_index(uint64_t key) {
+        return (key * HASH_MULTIPLIER) >> (64 - TABLE_BITS);
+    }
+
+    uint32_t find_in_table(uint64_t key) const;
+    uint32_t insert_locked(SymbolKey key);
+    static std::unique_ptr<PerfectHash> build_perfect_hash(const std::vector<std::pair<uint64_t, uint32_t>>& entries);
+
+    static_assert(TABLE_SIZE >= 2 * MAX_IDS, "keep the probe table at most half full");
+
+    std::array<Slot, TABLE_SIZE> table_;
+    std::array<std::atomic<uint64_t>, constants::MAX_SYMBOLS> id_to_key_{};
+    std::array<std::string, constants::MAX_SYMBOLS> id_to_symbol_;
+    std::atomic<uint32_t> count_{0};
+
+    std::atomic<const PerfectHash*> frozen_{nullptr};
+    std::vector<std::unique_ptr<PerfectHash>> snapshots_;  // Retired snapshots stay alive for readers
+
+    std::mutex registration_mutex_;
+};
+
+} // namespace hft::data
@@ -26,11 +26,17 @@
 
 #include "hft_straddle_system.h"
 #include "market_data.h"
+#include "options_chain.h"
+#include "rolling_window.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace hft::selection {
 
@@ -124,8 +130,14 @@ private:
         "AMZN", "MSFT", "GOOGL", "CRM", "NOW", "SNOW"
     };
     
-    std::unordered_map<std::string, StockFundamentals> fundamentals_;
+    struct FundamentalsEntry {
+        StockFundamentals data;
+        uint64_t revision = 0;          // Bumped by every update_fundamentals
+    };
+    
+    std::unordered_map<std::string, FundamentalsEntry> fundamentals_;
     std::vector<std::string> active_universe_;
+    uint64_t revision_ = 0;
     
 public:
     TechStockUniverse();
@@ -144,7 +156,11 @@ public:
     
     // Fundamental data access
     bool get_fundamentals(const std::string& symbol, StockFundamentals& data) const;
-    std::vector<std::string> get_active_universe() const { return active_universe_; }
+    const std::vector<std::string>& get_active_universe() const { return active_universe_; }
+    
+    // No-copy lookup with the entry's revision, so callers can skip
+    // unchanged fundamentals; nullptr when unknown
+    const StockFundamentals* find_fundamentals(const std::string& symbol, uint64_t& revision) const;
     
     // Universe statistics
     size_t get_universe_size() const { return active_universe_.size(); }
@@ -152,9 +168,31 @@ public:
     double get_average_volume() const;
 };
 
+// What the selector scores from a symbol's options chain. Providers copy
+// it out under whatever guards the chain, so scoring never reads a chain
+// that another thread is updating.
+struct OptionsChainSnapshot {
+    uint64_t revision = 0;          // Chain revision it was taken at
+    size_t front_strikes = 0;       // Strikes on the front expiry; 0 without expiries
+    size_t front_two_sided = 0;     // Two-sided front quotes averaged below
+    double front_spread_pct = 0.0;  // Their mean relative bid-ask spread
+
+    // Call on the thread that owns the chain
+    static OptionsChainSnapshot of(const data::OptionsChain& chain);
+};
+
 // Stock selection engine
+//
+// Scores are cached per symbol between cycles. Each cycle pulls the
+// inputs of every active symbol on the calling thread, marks the inputs
+// that changed since that symbol was last scored (fundamentals revision,
+// market tick, options snapshot) and recomputes only the component
+// scores depending on them. Dirty symbols are scored on a persistent pool
+// of worker threads once there are enough of them (started on first use,
+// parked between cycles); the top candidates come out of a partial sort.
+// A config update rescores everything.
 class TechStockSelector {
-private:
+public:
     // Selection configuration
     struct Config {
         // Liquidity filters
@@ -190,6 +228,10 @@ private:
         size_t max_selections;
         double min_total_score;
         
+        // Scoring threads
+        size_t num_threads;             // 0 = hardware concurrency
+        size_t min_symbols_per_thread;  // Dirty symbols below this stay on the caller
+        
         Config() : min_market_cap(50e9),
                    min_avg_volume(10e6),
                    min_dollar_volume(500e6),
@@ -210,7 +252,48 @@ private:
                    technical_weight(0.10),
                    timing_weight(0.05),
                    max_selections(5),
-                   min_total_score(70.0) {}
+                   min_total_score(70.0),
+                   num_threads(0),
+                   min_symbols_per_thread(64) {}
+    };
+    
+    // Fill in a symbol's latest options snapshot; false when it has none
+    using OptionsChainProvider = std::function<bool(const std::string&, OptionsChainSnapshot&)>;
+    
+private:
+    // Changed inputs of a cached candidate
+    static constexpr uint8_t FUNDAMENTALS_CHANGED = 1;
+    static constexpr uint8_t MARKET_CHANGED = 2;
+    static constexpr uint8_t OPTIONS_CHANGED = 4;
+    static constexpr uint8_t ALL_CHANGED = FUNDAMENTALS_CHANGED | MARKET_CHANGED | OPTIONS_CHANGED;
+    
+    struct Candidate {
+        std::string symbol;
+        uint64_t cycle = 0;                   // Last cycle it was in the universe
+        
+        // Inputs as last scored
+        StockFundamentals fundamentals;
+        uint64_t fundamentals_revision = 0;
+        bool has_fundamentals = false;
+        data::MarketTick tick;
+        bool has_tick = false;
+        OptionsChainSnapshot options;
+        bool has_options = false;
+        uint8_t changed = ALL_CHANGED;
+        
+        // Cached component scores and filters
+        double liquidity_score = 0.0;
+        double volatility_score = 0.0;
+        double options_activity_score = 0.0;
+        double fundamental_score = 0.0;
+        double technical_score = 0.0;
+        double timing_score = 0.0;
+        bool passes_liquidity = false;
+        bool passes_options = false;
+        bool passes_volatility = false;
+        bool passes_timing = false;
+        double total_score = 0.0;
+        bool is_tradeable = false;
     };
     
     Config config_;
@@ -218,7 +301,27 @@ private:
     
     // Market data access
     std::function<bool(const std::string&, data::MarketTick&)> market_data_callback_;
-    std::function<bool(const std::string&, std::vector<data::OptionTick>&)> options_data_callback_;
+    OptionsChainProvider options_chain_provider_;
+    
+    // Per-symbol score cache, indexed by id
+    data::SymbolMapper ids_;
+    std::vector<std::unique_ptr<Candidate>> candidates_;
+    std::vector<Candidate*> active_;       // This cycle's universe
+    std::vector<Candidate*> dirty_;        // Subset needing a rescore
+    uint64_t cycle_ = 0;
+    bool config_changed_ = true;
+    uint64_t symbols_rescored_ = 0;
+    
+    // Scoring pool; the caller scores alongside pool_active_ of the workers
+    std::vector<std::thread> pool_;
+    std::mutex pool_mutex_;
+    std::condition_variable pool_wake_;     // New round or shutdown
+    std::condition_variable pool_done_;     // Last busy worker finished
+    uint64_t pool_round_ = 0;
+    size_t pool_active_ = 0;
+    size_t pool_busy_ = 0;
+    bool pool_stop_ = false;
+    std::atomic<size_t> next_dirty_{0};     // Shared cursor into dirty_
     
     // Selection cache
     std::vector<SelectionScore> last_selection_;
@@ -231,88 +334,123 @@ public:
     
     // Initialization
     bool initialize();
+    TechStockUniverse& get_universe() { return *universe_; }
     
-    // Data callbacks
+    // Data callbacks (invoked on the thread calling select_best_candidates)
     void set_market_data_callback(std::function<bool(const std::string&, data::MarketTick&)> callback);
-    void set_options_data_callback(std::function<bool(const std::string&, std::vector<data::OptionTick>&)> callback);
+    void set_options_chain_provider(OptionsChainProvider provider);
     
     // Main selection process
     std::vector<SelectionScore> select_best_candidates();
     std::vector<std::string> get_top_symbols(size_t count = 5);
     
-    // Individual scoring functions
-    double calculate_liquidity_score(const StockFundamentals& stock, const data::MarketTick& market_data);
-    double calculate_volatility_score(const StockFundamentals& stock);
+    // Individual scoring functions (pure; safe to call concurrently)
+    double calculate_liquidity_score(const StockFundamentals& stock, const data::MarketTick& market_data) const;
+    double calculate_volatility_score(const StockFundamentals& stock) const;
     double calculate_options_activity_score(const StockFundamentals& stock, 
-                                           const std::vector<data::OptionTick>& options_chain);
-    double calculate_fundamental_score(const StockFundamentals& stock);
-    double calculate_technical_score(const std::string& symbol, const data::MarketTick& market_data);
-    double calculate_timing_score(const StockFundamentals& stock);
+                                           const OptionsChainSnapshot* options) const;
+    double calculate_fundamental_score(const StockFundamentals& stock) const;
+    double calculate_technical_score(const std::string& symbol, const data::MarketTick& market_data) const;
+    double calculate_timing_score(const StockFundamentals& stock) const;
     
     // Filtering functions
-    bool passes_liquidity_filter(const StockFundamentals& stock, const data::MarketTick& market_data);
-    bool passes_options_filter(const std::vector<data::OptionTick>& options_chain);
-    bool passes_volatility_filter(const StockFundamentals& stock);
-    bool passes_timing_filter(const StockFundamentals& stock);
+    bool passes_liquidity_filter(const StockFundamentals& stock, const data::MarketTick& market_data) const;
+    bool passes_options_filter(const StockFundamentals& stock, const OptionsChainSnapshot* options) const;
+    bool passes_volatility_filter(const StockFundamentals& stock) const;
+    bool passes_timing_filter(const StockFundamentals& stock) const;
     
     // Selection results
     std::vector<SelectionScore> get_last_selection() const { return last_selection_; }
     bool is_selection_valid() const { return selection_valid_.load(); }
     data::Timestamp get_last_selection_time() const { return last_selection_time_; }
+    uint64_t get_symbols_rescored() const { return symbols_rescored_; }   // Cumulative, for monitoring
     
     // Configuration
-    void update_config(const Config& new_config) { config_ = new_config; }
+    void update_config(const Config& new_config) { config_ = new_config; config_changed_ = true; }
     Config get_config() const { return config_; }
     
 private:
     // Helper functions
-    void refresh_fundamentals();
+    void gather_inputs(Candidate& c);
+    void score(Candidate& c) const;
+    void score_dirty();
+    void score_chunks();
+    void pool_worker(size_t index);
     bool is_earnings_week(const StockFundamentals& stock) const;
     double normalize_score(double value, double min_val, double max_val) const;
-    SelectionScore create_selection_score(const std::string& symbol);
+    SelectionScore create_selection_score(const Candidate& c, int rank) const;
 };
 
 // Volatility ranking system
+//
+// IV and HV history per symbol is a fixed window of the last
+// HISTORY_WINDOW samples, kept sorted alongside arrival order, so memory
+// stays bounded however long the process runs. Each update refreshes the
+// symbol's metrics in place (percentiles by binary search, rank from the
+// window min / max, trend from sliding least-squares sums); rankings are
+// one pass over the id-indexed metrics array plus a sort.
 class VolatilityRanker {
-private:
+public:
+    static constexpr size_t HISTORY_WINDOW = 252;            // One trading year of daily samples
+    static constexpr size_t TREND_WINDOW = 10;               // Samples in the trend regression
+    static constexpr double LOW_VOL_PERCENTILE = 30.0;       // Bottom 30% of the IV window
+    static constexpr double MAX_ENTRY_IV_HV_RATIO = 1.2;     // Premium over realized vol we will pay
+
     struct VolatilityMetrics {
         std::string symbol;
-        double current_iv;              // Current implied volatility
-        double iv_percentile;           // IV percentile (0-100)
-        double hv_current;              // Current historical volatility
-        double hv_percentile;           // HV percentile (0-100)
-        double iv_hv_ratio;             // IV/HV ratio
-        double iv_rank;                 // IV rank (0-100)
-        double volatility_trend;        // Volatility trend (rising/falling)
-        bool is_low_vol_regime;         // Is in low volatility regime
-        double vol_expansion_potential; // Potential for vol expansion
+        double current_iv = 0.0;              // Current implied volatility
+        double iv_percentile = 50.0;          // IV percentile (0-100)
+        double hv_current = 0.0;              // Current historical volatility
+        double hv_percentile = 50.0;          // HV percentile (0-100)
+        double iv_hv_ratio = 0.0;             // IV/HV ratio (0 until HV is known)
+        double iv_rank = 50.0;                // IV rank (0-100)
+        double volatility_trend = 0.0;        // IV slope per sample over TREND_WINDOW samples
+        bool is_low_vol_regime = false;       // Is in low volatility regime
+        double vol_expansion_potential = 0.0; // Potential for vol expansion (0-100)
     };
     
-    std::unordered_map<std::string, VolatilityMetrics> vol_metrics_;
-    std::unordered_map<std::string, std::vector<double>> iv_history_;
-    std::unordered_map<std::string, std::vector<double>> hv_history_;
+    VolatilityRanker();
     
-public:
-    // Update volatility data
+    // Update volatility data (non-positive or non-finite values are ignored)
     void update_volatility_data(const std::string& symbol, 
                                double implied_vol, 
                                double historical_vol);
     
     // Get volatility metrics
-    bool get_volatility_metrics(const std::string& symbol, VolatilityMetrics& metrics);
+    bool get_volatility_metrics(const std::string& symbol, VolatilityMetrics& metrics) const;
     
-    // Ranking functions
-    std::vector<std::string> rank_by_low_volatility(const std::vector<std::string>& symbols);
-    std::vector<std::string> rank_by_vol_expansion_potential(const std::vector<std::string>& symbols);
-    std::vector<std::string> get_optimal_straddle_candidates(const std::vector<std::string>& symbols);
+    // Ranking functions (symbols without data are left out)
+    std::vector<std::string> rank_by_low_volatility(const std::vector<std::string>& symbols) const;
+    std::vector<std::string> rank_by_vol_expansion_potential(const std::vector<std::string>& symbols) const;
+    std::vector<std::string> get_optimal_straddle_candidates(const std::vector<std::string>& symbols) const;
     
     // Analysis functions
-    bool is_good_straddle_entry(const std::string& symbol);
-    double calculate_vol_expansion_probability(const std::string& symbol);
+    bool is_good_straddle_entry(const std::string& symbol) const;
+    double calculate_vol_expansion_probability(const std::string& symbol) const;
     
 private:
-    double calculate_percentile(const std::vector<double>& data, double value);
-    double calculate_trend(const std::vector<double>& data, size_t window = 10);
+    struct History {
+        data::SortedWindow<HISTORY_WINDOW> iv;
+        data::SortedWindow<HISTORY_WINDOW> hv;
+        
+        // Least-squares sums over the last TREND_WINDOW IVs, x = 0 oldest
+        double trend_sum = 0.0;         // sum y
+        double trend_xy_sum = 0.0;      // sum x * y
+        data::ResyncCounter trend_resync;
+    };
+    
+    const VolatilityMetrics* find(const std::string& symbol) const;
+    static void add_trend_sample(History& h, double iv);
+    static double trend_slope(const History& h);
+    void refresh_metrics(const History& h, VolatilityMetrics& m) const;
+    bool is_good_entry(const VolatilityMetrics& m) const;
+    
+    template<typename Key, typename Filter>
+    std::vector<std::string> rank(const std::vector<std::string>& symbols, Key key, Filter filter) const;
+    
+    data::SymbolMapper ids_;
+    std::vector<std::unique_ptr<History>> history_;   // By id, allocated on first update
+    std::vector<VolatilityMetrics> metrics_;          // By id; empty symbol = no data yet
 };
 
 // Market timing analyzer
@@ -0,0 +1,198 @@
+/*
+ * ===================================================================
+ *                  COLUMNAR TICK ARCHIVE (ON DISK)
+ * ===================================================================
+ *
+ * Compact per-symbol tick history for backtesting, opened via mmap
+ *
+ * FILE LAYOUT (little-endian, offsets from start of file):
+ *   FileHeader
+ *   block data ...            (every symbol, every block)
+ *   BlockIndex[]  per symbol  (time index, 8-byte aligned)
+ *   SymbolEntry[] directory   (8-byte aligned)
+ *
+ * BLOCK ENCODING (BLOCK_TICKS ticks, self-contained, column by column):
+ *   timestamp        varint delta from the previous tick (sorted)
+ *   bid, ask, last   zigzag varint delta of Price::value
+ *   bid/ask size     varint
+ *   volume           varint
+ *   sequence_number  zigzag varint delta
+ *   exchange_id      varint
+ *
+ * PERFORMANCE FEATURES:
+ * - Opening an archive maps it; nothing is parsed or copied up front
+ * - Range queries binary-search the time index and decode only the
+ *   blocks that overlap the range, one block at a time
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hft::data {
+
+namespace archive_format {
+
+constexpr char MAGIC[8] = {'H', 'F', 'T', 'T', 'I', 'C', 'K', 'S'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t BLOCK_TICKS = 1024;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t symbol_count;
+    uint64_t directory_offset;
+    uint64_t reserved;
+};
+
+struct SymbolEntry {
+    uint64_t key;            // SymbolKey::value
+    uint64_t tick_count;
+    uint64_t block_count;
+    uint64_t index_offset;   // BlockIndex[block_count]
+};
+
+struct BlockIndex {
+    uint64_t first_timestamp;
+    uint64_t last_timestamp;
+    uint64_t data_offset;
+    uint32_t data_size;
+    uint32_t tick_count;
+};
+
+static_assert(sizeof(FileHeader) == 32, "archive header layout");
+static_assert(sizeof(SymbolEntry) == 32, "archive directory layout");
+static_assert(sizeof(BlockIndex) == 32, "archive index layout");
+
+} // namespace archive_format
+
+// One symbol's ticks to be written (sorted by timestamp)
+struct ArchiveSeries {
+    std::string symbol;
+    const MarketTick* ticks;
+    size_t count;
+};
+
+// Read-only view of a memory-mapped archive file
+class TickArchive {
+public:
+    ~TickArchive();
+
+    TickArchive(const TickArchive&) = delete;
+    TickArchive& operator=(const TickArchive&) = delete;
+
+    // nullptr when the file is missing, truncated or not an archive
+    static std::unique_ptr<TickArchive> open(const std::string& path);
+
+    // Write series to path; returns false on I/O error or symbols over 8 chars
+    static bool write(const std::string& path, const std::vector<ArchiveSeries>& series);
+
+    size_t symbol_count() const { return symbol_count_; }
+    const archive_format::SymbolEntry* symbol(size_t index) const { return directory_ + index; }
+    const archive_format::SymbolEntry* find(SymbolKey key) const;
+
+    const archive_format::BlockIndex* blocks(const archive_format::SymbolEntry& entry) const;
+
+    // Decode one block into out (room for BLOCK_TICKS); returns ticks written
+    size_t decode_block(const archive_format::BlockIndex& block, uint32_t symbol_id, MarketTick* out) const;
+
+private:
+    TickArchive() = default;
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    const archive_format::SymbolEntry* directory_ = nullptr;
+    size_t symbol_count_ = 0;
+};
+
+// Ticks in [start, end] for one symbol, without materializing the range.
+// In-memory series are walked in place; archived series are decoded a
+// block at a time into a buffer owned by each iterator, so iterations
+// are independent and the range may be moved while they are in flight.
+class TickRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = MarketTick;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const MarketTick*;
+        using reference = const MarketTick&;
+
+        iterator() = default;
+        iterator(const iterator& other);                // Copies the decoded block
+        iterator& operator=(const iterator& other);
+        iterator(iterator&&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+        reference operator*() const { return *current_; }
+        pointer operator->() const { return current_; }
+
+        iterator& operator++() {
+            if (++current_ == chunk_end_) {
+                next_chunk();
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const { return current_ == other.current_; }
+        bool operator!=(const iterator& other) const { return current_ != other.current_; }
+
+    private:
+        friend class TickRange;
+
+        void next_chunk();
+
+        const MarketTick* current_ = nullptr;   // nullptr at end
+        const MarketTick* chunk_end_ = nullptr;
+
+        // Archived source: blocks still to decode, and where they decode to
+        const TickArchive* archive_ = nullptr;
+        const archive_format::BlockIndex* next_block_ = nullptr;
+        const archive_format::BlockIndex* last_block_ = nullptr;
+        uint32_t symbol_id_ = 0;
+        uint64_t start_ = 0;
+        uint64_t end_ = 0;
+        std::unique_ptr<MarketTick[]> buffer_;
+    };
+
+    TickRange() = default;
+    TickRange(const MarketTick* begin, const MarketTick* end);
+    TickRange(const TickArchive* archive, const archive_format::SymbolEntry* entry,
+              uint32_t symbol_id, Timestamp start, Timestamp end);
+
+    iterator begin() const;
+    iterator end() const { return iterator(); }
+
+    bool empty() const { return count_ticks(1) == 0; }
+    size_t size() const { return count_ticks(SIZE_MAX); }
+    std::vector<MarketTick> to_vector() const;
+
+    // Contiguous in-memory source (nullptr for archived series)
+    const MarketTick* data() const { return archive_ ? nullptr : memory_begin_; }
+
+private:
+    // Ticks in range, stopping once limit is reached; leaves iterators untouched
+    size_t count_ticks(size_t limit) const;
+
+    // In-memory source
+    const MarketTick* memory_begin_ = nullptr;
+    const MarketTick* memory_end_ = nullptr;
+
+    // Archived source
+    const TickArchive* archive_ = nullptr;
+    const archive_format::BlockIndex* first_block_ = nullptr;
+    const archive_format::BlockIndex* last_block_ = nullptr;  // Exclusive
+    uint32_t symbol_id_ = 0;
+    uint64_t start_ = 0;
+    uint64_t end_ = 0;
+};
+
+} // namespace hft::data
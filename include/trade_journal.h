@@ -0,0 +1,152 @@
+/*
+ * ===================================================================
+ *                    BINARY TRADE JOURNAL
+ * ===================================================================
+ *
+ * Trade and position events from the strategy thread to disk, off the
+ * trading path
+ *
+ * PERFORMANCE FEATURES:
+ * - One fixed 64-byte record per event, filled with plain stores and
+ *   pushed onto an SPSC ring: no formatting, locks or syscalls on the
+ *   producer side (a full ring drops and counts the record instead of
+ *   blocking)
+ * - A writer thread batches records into large buffered write(2) calls
+ * - Records go to disk as raw binary; decode_journal / format_record
+ *   (and the hft_journal_decode tool) render them as text offline
+ *
+ * FILE FORMAT:
+ *   JournalHeader (16 bytes: magic, version, record size), then
+ *   JournalRecord after JournalRecord in host byte order
+ *
+ * THREADING:
+ * - record(): one producer thread (the strategy)
+ * - The writer thread is internal; without start(), open() and then
+ *   flush() write queued records on the calling thread instead
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include "ring_buffer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hft::data {
+
+enum class JournalEvent : uint8_t {
+    POSITION_OPEN = 1,
+    POSITION_CLOSE = 2
+};
+
+struct alignas(64) JournalRecord {
+    uint64_t timestamp_ns;        // Event time of the decision
+    uint32_t position_id;
+    uint32_t symbol_id;
+    JournalEvent event;
+    uint8_t reserved[7];
+    Price call_strike;
+    Price put_strike;
+    Price premium;                // Paid at entry
+    Price value;                  // Mark of both legs
+    Price pnl;                    // Dollars, same fixed-point scale
+};
+static_assert(sizeof(JournalRecord) == 64, "JournalRecord must fill exactly one cache line");
+
+struct JournalHeader {
+    static constexpr uint64_t MAGIC = 0x314C4E524A544648ull;   // "HFTJRNL1"
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t record_size = sizeof(JournalRecord);
+};
+static_assert(sizeof(JournalHeader) == 16, "JournalHeader is part of the file format");
+
+const char* to_string(JournalEvent event);
+
+// One text line (no newline) into out[0, size); returns its length,
+// truncated to size - 1
+size_t format_record(const JournalRecord& record, char* out, size_t size);
+
+// Every complete record of a journal file; false when the file is
+// missing or its header does not match this build's format
+bool decode_journal(const std::string& path, std::vector<JournalRecord>& out);
+
+class TradeJournal {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 16384;   // Records in flight (1 MB)
+    static constexpr size_t WRITE_BATCH = 256;        // Records per write call
+
+    struct Config {
+        std::string path;
+        int writer_cpu;              // Core for the writer thread; -1 = not pinned
+        uint32_t idle_sleep_us;      // Writer back-off when the queue is empty
+        bool use_hugepages;          // Queue storage
+
+        Config() : path("./logs/trades.journal"),
+                   writer_cpu(-1),
+                   idle_sleep_us(200),
+                   use_hugepages(false) {}
+    };
+
+    explicit TradeJournal(const Config& config = Config{});
+    ~TradeJournal();
+
+    TradeJournal(const TradeJournal&) = delete;
+    TradeJournal& operator=(const TradeJournal&) = delete;
+
+    // Creates (truncates) the file and writes the header
+    bool open();
+    bool is_open() const { return fd_ >= 0; }
+
+    // ---- Writer thread ----
+    bool start();                // Opens the file if needed
+    void stop();                 // Writes everything queued, then closes
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+    // Write queued records on the calling thread (file open, writer
+    // thread not running); returns the records written
+    size_t flush();
+
+    // ---- Producer thread ----
+    bool record(const JournalRecord& record) {
+        if (queue_.push(record)) {
+            return true;
+        }
+        records_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // ---- Statistics (any thread) ----
+    uint64_t records_written() const { return records_written_.load(std::memory_order_relaxed); }
+    uint64_t records_dropped() const { return records_dropped_.load(std::memory_order_relaxed); }
+    uint64_t write_failures() const { return write_failures_.load(std::memory_order_relaxed); }
+
+    const Config& get_config() const { return config_; }
+
+private:
+    size_t drain();
+    bool write_all(const void* data, size_t length);
+    void write_loop();
+    void close();
+
+    Config config_;
+    int fd_ = -1;
+
+    SPSCRingBuffer<JournalRecord, QUEUE_CAPACITY> queue_;
+
+    std::thread writer_thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> records_written_{0};
+    std::atomic<uint64_t> records_dropped_{0};
+    std::atomic<uint64_t> write_failures_{0};
+};
+
+} // namespace hft::data
@@ -0,0 +1,96 @@
+/*
+ * ===================================================================
+ *                    IMPLIED VOLATILITY SURFACE
+ * ===================================================================
+ *
+ * Per-underlying strike x expiry implied volatility, fitted from the
+ * option quotes as they arrive
+ *
+ * MODEL:
+ * - One slice per expiration date; within a slice a natural cubic
+ *   spline of IV against log-strike through the quoted strikes (the
+ *   mean of call and put IV where both are quoted), flat beyond the
+ *   outermost strikes
+ * - Between expiries, total variance (IV^2 * T) is linear in time
+ *
+ * PERFORMANCE FEATURES:
+ * - A quote only marks its own slice dirty; a slice is refitted at most
+ *   once per batch of quotes, on the first lookup that needs it
+ * - Each fit is resampled on a uniform log-strike grid, so a lookup is
+ *   an index computation and one linear interpolation
+ *
+ * THREADING:
+ * - Single thread (the strategy thread); lookups refit lazily
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "market_data.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hft::data {
+
+class VolatilitySurface {
+public:
+    static constexpr size_t MAX_EXPIRIES = 16;
+    static constexpr size_t GRID_POINTS = 64;
+    static constexpr size_t NO_SLICE = SIZE_MAX;
+    static constexpr double MIN_VOLATILITY = 1e-4;   // Floor for spline undershoot
+
+    explicit VolatilitySurface(uint32_t underlying_id);
+
+    // Apply one quote; false when it is for another underlying or its
+    // expiry does not fit (all MAX_EXPIRIES slots hold later expiries)
+    bool update(const OptionTick& tick);
+
+    // Interpolated IV on one expiry; 0 when the expiry has no fitted strikes
+    double implied_volatility(Price strike, uint32_t expiration_date) const;
+
+    // IV at any maturity, interpolating total variance between slices
+    double implied_volatility(Price strike, double days_to_expiry) const;
+
+    // ---- Slice index (slices ordered by expiration date) ----
+    size_t slice_count() const { return slices_.size(); }
+    uint32_t expiration_date(size_t slice) const { return slices_[slice].expiration_date; }
+    uint16_t days_to_expiry(size_t slice) const { return slices_[slice].days_to_expiry; }
+    size_t find_expiry(uint32_t expiration_date) const;
+
+    uint32_t underlying_id() const { return underlying_id_; }
+    uint64_t refit_count() const { return refits_; }
+
+private:
+    struct Slice {
+        uint32_t expiration_date = 0;
+        uint16_t days_to_expiry = 0;
+        std::vector<int64_t> strikes;      // Sorted, basis points
+        std::vector<float> call_iv;        // 0 = no call quote with IV yet
+        std::vector<float> put_iv;
+
+        // Fit, rebuilt lazily when dirty
+        mutable bool dirty = true;
+        mutable bool fitted = false;
+        mutable double x_min = 0.0;
+        mutable double inv_step = 0.0;
+        mutable std::array<double, GRID_POINTS> grid{};
+    };
+
+    void refit(const Slice& slice) const;
+    double evaluate(const Slice& slice, double log_strike) const;
+
+    uint32_t underlying_id_;
+    std::vector<Slice> slices_;
+    mutable uint64_t refits_ = 0;
+
+    // Fit workspace, reused so a refit does not allocate once warm
+    mutable std::vector<double> scratch_x_;
+    mutable std::vector<double> scratch_y_;
+    mutable std::vector<double> scratch_m_;
+    mutable std::vector<double> scratch_c_;
+};
+
+} // namespace hft::data
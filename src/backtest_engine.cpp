@@ -0,0 +1,142 @@
+/*
+ * ===================================================================
+ *                       EVENT-DRIVEN BACKTESTER
+ * ===================================================================
+ */
+
+#include "../include/backtest_engine.h"
+#include <algorithm>
+
+namespace hft::analytics {
+
+namespace {
+
+bool by_timestamp(const data::OptionTick& a, const data::OptionTick& b) {
+    return a.timestamp.nanoseconds_since_epoch < b.timestamp.nanoseconds_since_epoch;
+}
+
+} // namespace
+
+BacktestEngine::BacktestEngine(const Config& config)
+    : config_(config),
+      latest_ticks_(constants::MAX_SYMBOLS),
+      has_tick_(constants::MAX_SYMBOLS, 0),
+      chains_(constants::MAX_SYMBOLS) {}
+
+void BacktestEngine::add_market_data(data::TickRange range) {
+    market_sources_.push_back(std::move(range));
+}
+
+bool BacktestEngine::add_market_data(const data::HistoricalDataLoader& loader, const std::string& symbol) {
+    data::TickRange range = loader.get_historical_data(symbol, config_.start, config_.end);
+    if (range.empty()) {
+        return false;
+    }
+    add_market_data(std::move(range));
+    return true;
+}
+
+bool BacktestEngine::add_options_data(std::vector<data::OptionTick> ticks) {
+    const auto outside = [this](const data::OptionTick& tick) {
+        const uint64_t ts = tick.timestamp.nanoseconds_since_epoch;
+        return ts < config_.start.nanoseconds_since_epoch || ts > config_.end.nanoseconds_since_epoch;
+    };
+    ticks.erase(std::remove_if(ticks.begin(), ticks.end(), outside), ticks.end());
+    if (!std::is_sorted(ticks.begin(), ticks.end(), by_timestamp)) {
+        std::stable_sort(ticks.begin(), ticks.end(), by_timestamp);
+    }
+    return add_options_data(std::make_shared<const std::vector<data::OptionTick>>(std::move(ticks)));
+}
+
+bool BacktestEngine::add_options_data(std::shared_ptr<const std::vector<data::OptionTick>> ticks) {
+    if (!ticks) {
+        return false;
+    }
+    const bool in_window = ticks->empty() ||
+        (ticks->front().timestamp.nanoseconds_since_epoch >= config_.start.nanoseconds_since_epoch &&
+         ticks->back().timestamp.nanoseconds_since_epoch <= config_.end.nanoseconds_since_epoch);
+    if (!in_window || !std::is_sorted(ticks->begin(), ticks->end(), by_timestamp)) {
+        return add_options_data(std::vector<data::OptionTick>(*ticks));
+    }
+
+    for (const auto& tick : *ticks) {
+        if (tick.underlying_id >= chains_.size()) {
+            return false;
+        }
+    }
+
+    // Every contract gets a fixed slot in its underlying's chain up front
+    OptionSeries series;
+    series.slots.reserve(ticks->size());
+    for (const auto& tick : *ticks) {
+        const ContractKey key{tick.underlying_id, tick.expiration_date, tick.strike.value, tick.option_type};
+        ChainState& chain = chains_[tick.underlying_id];
+        auto [it, inserted] = contract_slots_.emplace(key, static_cast<uint32_t>(chain.contracts.size()));
+        if (inserted) {
+            chain.contracts.emplace_back();
+            chain.quoted.push_back(0);
+        }
+        series.slots.push_back(it->second);
+    }
+    series.ticks = std::move(ticks);
+    option_sources_.push_back(std::move(series));
+    return true;
+}
+
+BacktestStats BacktestEngine::run(strategy::StraddleStrategy& strategy) {
+    BacktestStats stats;
+    if (strategy.initialize()) {
+        strategy.start();
+        stats = replay(strategy);
+        strategy.stop();
+    }
+    return stats;
+}
+
+bool BacktestEngine::latest_market_data(uint32_t symbol_id, data::MarketTick& tick) const {
+    if (symbol_id >= latest_ticks_.size() || !has_tick_[symbol_id]) {
+        return false;
+    }
+    tick = latest_ticks_[symbol_id];
+    return true;
+}
+
+bool BacktestEngine::options_chain(uint32_t underlying_id, std::vector<data::OptionTick>& chain) const {
+    chain.clear();
+    if (underlying_id >= chains_.size()) {
+        return false;
+    }
+    const ChainState& state = chains_[underlying_id];
+    for (size_t i = 0; i < state.contracts.size(); ++i) {
+        if (state.quoted[i]) {
+            chain.push_back(state.contracts[i]);
+        }
+    }
+    return !chain.empty();
+}
+
+void BacktestEngine::prepare() {
+    clock_ = data::Timestamp();
+    std::fill(has_tick_.begin(), has_tick_.end(), 0);
+    for (auto& chain : chains_) {
+        std::fill(chain.quoted.begin(), chain.quoted.end(), 0);
+    }
+
+    streams_.clear();
+    heads_.clear();
+    for (const auto& range : market_sources_) {
+        Stream stream;
+        stream.range = &range;
+        stream.market = range.begin();
+        heads_.push_back(stream.market != range.end() ? stream.market->timestamp.nanoseconds_since_epoch : EXHAUSTED);
+        streams_.push_back(std::move(stream));
+    }
+    for (const auto& series : option_sources_) {
+        Stream stream;
+        stream.options = &series;
+        heads_.push_back(!series.ticks->empty() ? series.ticks->front().timestamp.nanoseconds_since_epoch : EXHAUSTED);
+        streams_.push_back(stream);
+    }
+}
+
+} // namespace hft::analytics
@@ -0,0 +1,228 @@
+/*
+ * ===================================================================
+ *                  CPU TOPOLOGY AND THREAD PLACEMENT
+ * ===================================================================
+ */
+
+#include "../include/cpu_topology.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HFT_HAS_AFFINITY 1
+#endif
+
+namespace hft::data {
+
+namespace {
+
+constexpr const char* NODE_ROOT = "/sys/devices/system/node/";
+constexpr const char* CPU_ROOT = "/sys/devices/system/cpu/";
+constexpr int MPOL_PREFERRED_MODE = 1;   // <numaif.h> MPOL_PREFERRED
+constexpr size_t PAGE_SIZE = 4096;
+
+bool read_file(const std::string& path, std::string& out) {
+    std::ifstream file(path);
+    if (!file) return false;
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+#ifdef HFT_HAS_AFFINITY
+bool allowed(const cpu_set_t& set, int cpu) {
+    return cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &set);
+}
+#endif
+
+} // namespace
+
+std::vector<int> CpuTopology::parse_cpu_list(std::string_view list) {
+    std::vector<int> cpus;
+    size_t i = 0;
+    auto number = [&](int& out) {
+        const size_t start = i;
+        long value = 0;
+        while (i < list.size() && static_cast<unsigned>(list[i] - '0') <= 9) {
+            value = value * 10 + (list[i++] - '0');
+            if (value > 1 << 20) return false;
+        }
+        out = static_cast<int>(value);
+        return i > start;
+    };
+
+    while (i < list.size() && list[i] != '\n') {
+        int first, last;
+        if (!number(first)) return {};
+        last = first;
+        if (i < list.size() && list[i] == '-') {
+            ++i;
+            if (!number(last) || last < first) return {};
+        }
+        for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        if (i < list.size() && list[i] == ',') {
+            ++i;
+        } else if (i < list.size() && list[i] != '\n') {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+CpuTopology::CpuTopology(std::vector<std::vector<int>> cpus_of_node, std::vector<int> isolated)
+    : cpus_of_node_(std::move(cpus_of_node)),
+      isolated_(std::move(isolated)) {
+    for (size_t node = 0; node < cpus_of_node_.size(); ++node) {
+        for (const int cpu : cpus_of_node_[node]) {
+            if (static_cast<size_t>(cpu) >= node_of_cpu_.size()) {
+                node_of_cpu_.resize(static_cast<size_t>(cpu) + 1, -1);
+            }
+            node_of_cpu_[static_cast<size_t>(cpu)] = static_cast<int>(node);
+        }
+    }
+}
+
+CpuTopology CpuTopology::detect() {
+    std::string text;
+    std::vector<std::vector<int>> nodes;
+    if (read_file(std::string(NODE_ROOT) + "online", text)) {
+        for (const int node : parse_cpu_list(text)) {
+            std::string cpus;
+            if (!read_file(std::string(NODE_ROOT) + "node" + std::to_string(node) + "/cpulist", cpus)) continue;
+            if (static_cast<size_t>(node) >= nodes.size()) nodes.resize(static_cast<size_t>(node) + 1);
+            nodes[static_cast<size_t>(node)] = parse_cpu_list(cpus);
+        }
+    }
+
+    bool any = false;
+    for (const auto& cpus : nodes) any |= !cpus.empty();
+    if (!any) {
+        // No NUMA information: one node with every online CPU
+        std::vector<int> cpus;
+        if (read_file(std::string(CPU_ROOT) + "online", text)) cpus = parse_cpu_list(text);
+        if (cpus.empty()) {
+            const unsigned n = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned cpu = 0; cpu < n; ++cpu) cpus.push_back(static_cast<int>(cpu));
+        }
+        nodes.assign(1, std::move(cpus));
+    }
+
+    std::vector<int> isolated;
+    if (read_file(std::string(CPU_ROOT) + "isolated", text)) isolated = parse_cpu_list(text);
+    return CpuTopology(std::move(nodes), std::move(isolated));
+}
+
+const CpuTopology& CpuTopology::instance() {
+    static const CpuTopology topology = detect();
+    return topology;
+}
+
+int CpuTopology::node_of_cpu(int cpu) const {
+    return cpu >= 0 && static_cast<size_t>(cpu) < node_of_cpu_.size() ? node_of_cpu_[static_cast<size_t>(cpu)] : -1;
+}
+
+const std::vector<int>& CpuTopology::cpus_of_node(int node) const {
+    static const std::vector<int> none;
+    return node >= 0 && static_cast<size_t>(node) < cpus_of_node_.size() ? cpus_of_node_[static_cast<size_t>(node)]
+                                                                          : none;
+}
+
+bool CpuTopology::is_isolated(int cpu) const {
+    return std::find(isolated_.begin(), isolated_.end(), cpu) != isolated_.end();
+}
+
+std::vector<int> CpuTopology::select_cpus(size_t count, int node) const {
+    std::vector<int> candidates;
+    for (size_t cpu = 0; cpu < node_of_cpu_.size(); ++cpu) {
+        if (node_of_cpu_[cpu] >= 0 && (node < 0 || node_of_cpu_[cpu] == node)) {
+            candidates.push_back(static_cast<int>(cpu));
+        }
+    }
+#ifdef HFT_HAS_AFFINITY
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&set](int cpu) { return !allowed(set, cpu); }),
+                         candidates.end());
+    }
+#endif
+
+    std::sort(candidates.begin(), candidates.end(), [this](int a, int b) {
+        const bool a_isolated = is_isolated(a);
+        const bool b_isolated = is_isolated(b);
+        if (a_isolated != b_isolated) return a_isolated;
+        return a_isolated ? a < b : a > b;
+    });
+    if (candidates.size() > count) candidates.resize(count);
+    return candidates;
+}
+
+bool pin_thread(std::thread& thread, int cpu) {
+#ifdef HFT_HAS_AFFINITY
+    if (cpu < 0 || cpu >= CPU_SETSIZE || !thread.joinable()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+    (void)thread;
+    (void)cpu;
+    return false;
+#endif
+}
+
+bool pin_current_thread(int cpu) {
+#ifdef HFT_HAS_AFFINITY
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+int current_cpu() {
+#ifdef HFT_HAS_AFFINITY
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+bool bind_memory_to_node(void* data, size_t bytes, int node) {
+#if defined(HFT_HAS_AFFINITY) && defined(SYS_mbind)
+    if (!data || bytes == 0 || node < 0 || node >= 1024) {
+        return false;
+    }
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(data) & ~(PAGE_SIZE - 1);
+    const uintptr_t end = reinterpret_cast<uintptr_t>(data) + bytes;
+
+    constexpr size_t BITS = 8 * sizeof(unsigned long);
+    unsigned long mask[1024 / BITS] = {};
+    mask[static_cast<size_t>(node) / BITS] = 1ul << (static_cast<size_t>(node) % BITS);
+    // The kernel reads maxnode - 1 bits
+    const unsigned long maxnode = (static_cast<size_t>(node) / BITS + 1) * BITS + 1;
+    return syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED_MODE, mask, maxnode, 0) == 0;
+#else
+    (void)data;
+    (void)bytes;
+    (void)node;
+    return false;
+#endif
+}
+
+} // namespace hft::data
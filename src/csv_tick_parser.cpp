@@ -0,0 +1,307 @@
+/*
+ * ===================================================================
+ *                   PARALLEL CSV TICK PARSER
+ * ===================================================================
+ */
+
+#include "../include/csv_tick_parser.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HFT_CSV_SIMD 1
+#endif
+
+namespace hft::data {
+
+namespace {
+
+constexpr size_t MAX_FIELDS = 9;
+constexpr size_t SCAN_WIDTH = 16;
+
+// Bit i set when block[i] is ',' or '\n' (scalar tail for the last block)
+inline uint32_t delimiter_mask(const char* block, const char* end) {
+#ifdef HFT_CSV_SIMD
+    if (end - block >= static_cast<ptrdiff_t>(SCAN_WIDTH)) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        const __m128i commas = _mm_cmpeq_epi8(bytes, _mm_set1_epi8(','));
+        const __m128i newlines = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(commas, newlines)));
+    }
+#endif
+    uint32_t mask = 0;
+    const size_t n = std::min<size_t>(SCAN_WIDTH, static_cast<size_t>(end - block));
+    for (size_t i = 0; i < n; ++i) {
+        if (block[i] == ',' || block[i] == '\n') mask |= 1u << i;
+    }
+    return mask;
+}
+
+// Walks delimiters in order, examining each 16-byte block once
+class DelimiterCursor {
+public:
+    DelimiterCursor(const char* begin, const char* end)
+        : block_(begin), end_(end), mask_(begin < end ? delimiter_mask(begin, end) : 0) {}
+
+    // Position of the next delimiter, or end when there are none left
+    const char* next() {
+        while (mask_ == 0) {
+            block_ += SCAN_WIDTH;
+            if (block_ >= end_) {
+                return end_;
+            }
+            mask_ = delimiter_mask(block_, end_);
+        }
+        const char* position = block_ + __builtin_ctz(mask_);
+        mask_ &= mask_ - 1;
+        return position;
+    }
+
+private:
+    const char* block_;
+    const char* end_;
+    uint32_t mask_;
+};
+
+template<typename T>
+inline bool parse_unsigned(const char* begin, const char* end, T& value) {
+    const size_t length = static_cast<size_t>(end - begin);
+    if (length == 0 || length > 20) return false;
+
+    uint64_t result = 0;
+    for (const char* p = begin; p < end; ++p) {
+        const unsigned digit = static_cast<unsigned>(*p - '0');
+        if (digit > 9) return false;
+        if (result > (std::numeric_limits<uint64_t>::max() - digit) / 10) return false;
+        result = result * 10 + digit;
+    }
+    if (result > std::numeric_limits<T>::max()) return false;
+    value = static_cast<T>(result);
+    return true;
+}
+
+struct Field {
+    const char* begin;
+    const char* end;
+};
+
+inline bool parse_fields(const Field* f, size_t n, uint32_t symbol_id, MarketTick& tick) {
+    if (n < 7 || n > MAX_FIELDS) return false;
+
+    uint64_t ts = 0;
+    if (!parse_unsigned(f[0].begin, f[0].end, ts) ||
+        !CsvTickParser::parse_price(f[1].begin, f[1].end, tick.bid.value) ||
+        !CsvTickParser::parse_price(f[2].begin, f[2].end, tick.ask.value) ||
+        !CsvTickParser::parse_price(f[3].begin, f[3].end, tick.last.value) ||
+        !parse_unsigned(f[4].begin, f[4].end, tick.bid_size) ||
+        !parse_unsigned(f[5].begin, f[5].end, tick.ask_size) ||
+        !parse_unsigned(f[6].begin, f[6].end, tick.volume)) {
+        return false;
+    }
+    tick.timestamp = Timestamp(ts);
+    tick.symbol_id = symbol_id;
+    tick.sequence_number = 0;
+    tick.exchange_id = 0;
+    tick.padding = 0;
+    if (n > 7 && !parse_unsigned(f[7].begin, f[7].end, tick.sequence_number)) return false;
+    if (n > 8 && !parse_unsigned(f[8].begin, f[8].end, tick.exchange_id)) return false;
+    return true;
+}
+
+struct ChunkResult {
+    size_t rows = 0;
+    size_t rejected = 0;
+    bool first_line_rejected = false;
+};
+
+// Parse [begin, end) (starting at a line start) into out; returns rows written
+ChunkResult parse_chunk(const char* begin, const char* end, uint32_t symbol_id, MarketTick* out) {
+    ChunkResult result;
+    DelimiterCursor cursor(begin, end);
+    Field fields[MAX_FIELDS + 1];
+    size_t field_count = 0;
+    const char* field_start = begin;
+    bool first_line = true;
+
+    while (field_start < end) {
+        const char* d = cursor.next();
+        if (field_count <= MAX_FIELDS) {
+            fields[field_count] = Field{field_start, d};
+        }
+        ++field_count;
+
+        if (d == end || *d == '\n') {
+            Field& last = fields[std::min(field_count, MAX_FIELDS + 1) - 1];
+            if (last.end > last.begin && last.end[-1] == '\r') --last.end;
+
+            const bool blank = field_count == 1 && fields[0].begin == fields[0].end;
+            if (!blank) {
+                if (parse_fields(fields, field_count, symbol_id, out[result.rows])) {
+                    ++result.rows;
+                } else {
+                    ++result.rejected;
+                    result.first_line_rejected |= first_line;
+                }
+            }
+            first_line = false;
+            field_count = 0;
+        }
+        field_start = d + 1;
+    }
+    return result;
+}
+
+} // namespace
+
+bool CsvTickParser::parse_price(const char* begin, const char* end, int64_t& value) {
+    Price price;
+    if (!Price::parse(begin, end, price)) return false;
+    value = price.value;
+    return true;
+}
+
+bool CsvTickParser::parse_row(const char* begin, const char* end, uint32_t symbol_id, MarketTick& tick) {
+    if (end > begin && end[-1] == '\r') --end;
+
+    Field fields[MAX_FIELDS];
+    size_t n = 0;
+    const char* start = begin;
+    for (const char* p = begin; p <= end; ++p) {
+        if (p == end || *p == ',') {
+            if (n == MAX_FIELDS) return false;
+            fields[n++] = Field{start, p};
+            start = p + 1;
+        }
+    }
+    return parse_fields(fields, n, symbol_id, tick);
+}
+
+size_t CsvTickParser::count_lines(const char* begin, const char* end) {
+    size_t count = 0;
+    const char* p = begin;
+#ifdef HFT_CSV_SIMD
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; end - p >= static_cast<ptrdiff_t>(SCAN_WIDTH); p += SCAN_WIDTH) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        count += __builtin_popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline))));
+    }
+#endif
+    for (; p < end; ++p) {
+        count += *p == '\n';
+    }
+    return count;
+}
+
+CsvParseResult CsvTickParser::parse(const char* data, size_t size, uint32_t symbol_id,
+                                    std::vector<MarketTick>& out, const Config& config) {
+    CsvParseResult result;
+    if (size == 0) {
+        return result;
+    }
+
+    size_t threads = config.num_threads ? config.num_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::max<size_t>(1, std::min(threads, size / std::max<size_t>(config.min_chunk_bytes, 1)));
+
+    // Chunk boundaries moved forward to the next line start
+    std::vector<const char*> bounds(threads + 1);
+    bounds[0] = data;
+    bounds[threads] = data + size;
+    for (size_t i = 1; i < threads; ++i) {
+        const char* guess = std::max(data + size * i / threads, bounds[i - 1]);
+        const void* newline = std::memchr(guess, '\n', static_cast<size_t>(data + size - guess));
+        bounds[i] = newline ? static_cast<const char*>(newline) + 1 : data + size;
+    }
+
+    // Pass 1: exact row capacity per chunk
+    std::vector<size_t> capacity(threads);
+    auto count_chunk = [&](size_t i) {
+        const char* begin = bounds[i];
+        const char* end = bounds[i + 1];
+        capacity[i] = count_lines(begin, end) + (end > begin && end[-1] != '\n' ? 1 : 0);
+    };
+
+    // Pass 2: parse into each chunk's slice of out
+    const size_t base = out.size();
+    std::vector<size_t> offset(threads + 1, 0);
+    std::vector<ChunkResult> chunks(threads);
+    auto parse_slice = [&](size_t i) {
+        chunks[i] = parse_chunk(bounds[i], bounds[i + 1], symbol_id, out.data() + base + offset[i]);
+    };
+
+    auto run_parallel = [&](auto&& task) {
+        std::vector<std::thread> workers;
+        workers.reserve(threads - 1);
+        for (size_t i = 1; i < threads; ++i) {
+            workers.emplace_back(task, i);
+        }
+        task(0);
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+
+    run_parallel(count_chunk);
+    for (size_t i = 0; i < threads; ++i) {
+        offset[i + 1] = offset[i] + capacity[i];
+    }
+    out.resize(base + offset[threads]);
+    run_parallel(parse_slice);
+
+    // Close the gaps left by rejected lines
+    size_t written = base;
+    for (size_t i = 0; i < threads; ++i) {
+        const MarketTick* slice = out.data() + base + offset[i];
+        if (out.data() + written != slice) {
+            std::copy(slice, slice + chunks[i].rows, out.data() + written);
+        }
+        written += chunks[i].rows;
+        result.rows += chunks[i].rows;
+        result.rejected += chunks[i].rejected;
+    }
+    result.first_line_rejected = chunks[0].first_line_rejected;
+    out.resize(written);
+    return result;
+}
+
+bool CsvTickParser::parse_file(const std::string& path, uint32_t symbol_id,
+                               std::vector<MarketTick>& out, CsvParseResult& result,
+                               const Config& config) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        result = CsvParseResult{};
+        return true;
+    }
+
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    madvise(mapped, size, MADV_SEQUENTIAL);
+
+    result = parse(static_cast<const char*>(mapped), size, symbol_id, out, config);
+    munmap(mapped, size);
+    return true;
+}
+
+} // namespace hft::data
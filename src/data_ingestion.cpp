@@ -0,0 +1,427 @@
+/*
+ * ===================================================================
+ *                    DATA INGESTION ENGINE
+ * ===================================================================
+ *
+ * Fan-in of every IDataFeed into one bounded MPMC ring, drained in
+ * batches by the worker pool and handed to subscribers.
+ *
+ * THREADING:
+ * - Feed threads call publish_event(s) concurrently (no mutex); with
+ *   validate_data each validates its own events before the ring, so a
+ *   stream's verdicts do not depend on which worker pops what
+ * - Worker threads claim batches of WORKER_BATCH_SIZE with pop_n
+ * - Subscribers must be registered before start(); a batch sink needs a
+ *   single worker, so its handlers only ever run on that one thread
+ *
+ * ===================================================================
+ */
+
+#include "../include/data_ingestion.h"
+#include "../include/cpu_topology.h"
+#include "../include/latency_tracker.h"
+#include "../include/multicast_feed.h"
+#include <cstdlib>
+
+namespace hft::data {
+
+namespace {
+
+// Ring pages go next to the consumers
+int worker_node(const DataIngestionEngine::Config& config) {
+    return config.worker_cpus.empty() ? -1 : CpuTopology::instance().node_of_cpu(config.worker_cpus.front());
+}
+
+std::atomic<uint64_t> g_next_engine_id{1};
+
+// Keeps accepted events in order; returns how many are kept
+size_t compact(DataEvent* events, size_t count, uint64_t rejected) {
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!(rejected >> i & 1)) {
+            if (kept != i) {
+                events[kept] = events[i];
+            }
+            ++kept;
+        }
+    }
+    return kept;
+}
+
+} // namespace
+
+DataIngestionEngine::DataIngestionEngine(const Config& config)
+    : config_(config),
+      event_buffer_(config.enable_hugepages, worker_node(config)),
+      instance_id_(g_next_engine_id.fetch_add(1, std::memory_order_relaxed)) {}
+
+DataIngestionEngine::~DataIngestionEngine() {
+    stop();
+}
+
+bool DataIngestionEngine::initialize() {
+    bool all_connected = true;
+    for (auto& feed : feeds_) {
+        all_connected = feed->connect() && all_connected;
+    }
+    subscribe_symbols(config_.tech_symbols);
+    // A ticker the mapper cannot key would otherwise publish as id 0
+    const bool all_mapped = symbol_mapper_.freeze(config_.tech_symbols);
+    return all_connected && all_mapped;
+}
+
+void DataIngestionEngine::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+
+    start_time_ = Timestamp::now();
+    const size_t workers = config_.num_worker_threads > 0 ? config_.num_worker_threads : 1;
+    worker_threads_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        const int cpu = config_.worker_cpus.empty() ? -1 : config_.worker_cpus[i % config_.worker_cpus.size()];
+        worker_threads_.emplace_back(&DataIngestionEngine::worker_thread_main, this, cpu);
+    }
+
+    for (auto& feed : feeds_) {
+        feed->start_feed();
+    }
+
+    if (config_.latency_report_interval_ms > 0) {
+        latency_reporter_ = std::make_unique<LatencyReporter>(config_.latency_report_interval_ms);
+        latency_reporter_->start();
+    }
+}
+
+void DataIngestionEngine::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+
+    latency_reporter_.reset();
+    for (auto& feed : feeds_) {
+        feed->stop_feed();
+    }
+    for (auto& worker : worker_threads_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    worker_threads_.clear();
+    pinned_workers_.store(0);
+
+    // Deliver whatever the feeds published before they stopped
+    std::array<DataEvent, WORKER_BATCH_SIZE> batch;
+    while (const size_t n = event_buffer_.pop_n(batch.data(), batch.size())) {
+        events_processed_.fetch_add(n, std::memory_order_relaxed);
+        process_batch(batch.data(), n);
+    }
+}
+
+void DataIngestionEngine::add_feed(std::unique_ptr<IDataFeed> feed) {
+    feed->attach(this);
+    feeds_.push_back(std::move(feed));
+}
+
+void DataIngestionEngine::subscribe_symbols(const std::vector<std::string>& symbols) {
+    for (const auto& symbol : symbols) {
+        symbol_mapper_.get_id(symbol);
+        for (auto& feed : feeds_) {
+            feed->subscribe_symbol(symbol);
+        }
+    }
+}
+
+bool DataIngestionEngine::set_event_sink(EventSink sink) {
+    if (config_.num_worker_threads > 1 || running_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    event_sink_ = sink;
+    return true;
+}
+
+void DataIngestionEngine::subscribe_to_events(std::function<void(const DataEvent&)> callback) {
+    subscribers_.push_back(std::move(callback));
+}
+
+bool DataIngestionEngine::publish_event(const DataEvent& event) {
+    if (config_.validate_data) {
+        Publisher* publisher = local_publisher();
+        if (!publisher) {
+            events_rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (publisher->validator.validate_events(&event, 1) != 0) {
+            return false;
+        }
+    }
+    if (event_buffer_.push(event)) {
+        return true;
+    }
+    events_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+size_t DataIngestionEngine::publish_events(const DataEvent* events, size_t count) {
+    if (!config_.validate_data) {
+        return push_events(events, count);
+    }
+    Publisher* publisher = local_publisher();
+    if (!publisher) {
+        events_rejected_.fetch_add(count, std::memory_order_relaxed);
+        return 0;
+    }
+    size_t published = 0;
+    for (size_t done = 0; done < count;) {
+        const size_t n = std::min(count - done, publisher->staging.size());
+        const uint64_t rejected = publisher->validator.validate_events(events + done, n);
+        if (rejected == 0) {
+            published += push_events(events + done, n);   // Common case: no copy
+        } else {
+            size_t kept = 0;
+            for (size_t i = 0; i < n; ++i) {
+                if (!(rejected >> i & 1)) {
+                    publisher->staging[kept++] = events[done + i];
+                }
+            }
+            published += push_events(publisher->staging.data(), kept);
+        }
+        done += n;
+    }
+    return published;
+}
+
+bool DataIngestionEngine::register_publisher() {
+    return !config_.validate_data || local_publisher() != nullptr;
+}
+
+size_t DataIngestionEngine::commit_staged(Publisher& publisher, DataEvent* staged, size_t count) {
+    const uint64_t rejected = publisher.validator.validate_events(staged, count);
+    return push_events(staged, rejected ? compact(staged, count, rejected) : count);
+}
+
+DataIngestionEngine::Publisher* DataIngestionEngine::local_publisher() {
+    struct Ref {
+        uint64_t engine_id;
+        Publisher* publisher;                // nullptr: none was free
+        std::weak_ptr<Publisher> owner;      // Expires with the engine
+    };
+    struct Cache {
+        std::vector<Ref> refs;
+        ~Cache() {
+            for (const Ref& ref : refs) {
+                if (const auto publisher = ref.owner.lock()) {
+                    publisher->owned.store(false, std::memory_order_release);   // Thread exit
+                }
+            }
+        }
+    };
+    thread_local Cache cache;
+    for (const Ref& ref : cache.refs) {
+        if (ref.engine_id == instance_id_) {
+            return ref.publisher;
+        }
+    }
+    // First publish from this thread: forget engines destroyed since
+    cache.refs.erase(std::remove_if(cache.refs.begin(), cache.refs.end(),
+                                    [](const Ref& ref) { return ref.publisher && ref.owner.expired(); }),
+                     cache.refs.end());
+    const std::shared_ptr<Publisher> publisher = claim_publisher();
+    cache.refs.push_back(Ref{instance_id_, publisher.get(), publisher});
+    return publisher.get();
+}
+
+// Cold: once per publishing thread
+std::shared_ptr<DataIngestionEngine::Publisher> DataIngestionEngine::claim_publisher() {
+    std::lock_guard<std::mutex> lock(publishers_mutex_);
+    for (const auto& publisher : publisher_storage_) {
+        bool owned = false;
+        if (publisher->owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel)) {
+            return publisher;   // Left by a thread that exited; its symbol state carries over
+        }
+    }
+    const size_t index = publisher_storage_.size();
+    if (index >= MAX_PUBLISHERS) {
+        return nullptr;
+    }
+    publisher_storage_.push_back(std::make_shared<Publisher>(config_.validation_rules));
+    publishers_[index].store(publisher_storage_.back().get(), std::memory_order_release);
+    publisher_count_.store(index + 1, std::memory_order_release);
+    return publisher_storage_.back();
+}
+
+uint64_t DataIngestionEngine::get_events_validated() const {
+    uint64_t total = 0;
+    const size_t count = publisher_count_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        total += publishers_[i].load(std::memory_order_acquire)->validator.get_validated_count();
+    }
+    return total;
+}
+
+uint64_t DataIngestionEngine::get_events_rejected() const {
+    uint64_t total = events_rejected_.load(std::memory_order_relaxed);
+    const size_t count = publisher_count_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        total += publishers_[i].load(std::memory_order_acquire)->validator.get_rejected_count();
+    }
+    return total;
+}
+
+size_t DataIngestionEngine::push_events(const DataEvent* events, size_t count) {
+    size_t accepted = 0;
+    while (accepted < count) {
+        const size_t n = event_buffer_.push_n(events + accepted, count - accepted);
+        if (n == 0) {
+            break;
+        }
+        accepted += n;
+    }
+    if (accepted < count) {
+        events_dropped_.fetch_add(count - accepted, std::memory_order_relaxed);
+    }
+    return accepted;
+}
+
+double DataIngestionEngine::get_processing_rate() const {
+    const double elapsed = Timestamp::now().to_seconds() - start_time_.to_seconds();
+    return elapsed > 0 ? static_cast<double>(events_processed_.load()) / elapsed : 0.0;
+}
+
+// Pinned before the first batch, so everything the worker allocates
+// (per-symbol series, subscriber state) is first touched on its node
+void DataIngestionEngine::worker_thread_main(int cpu) {
+    if (cpu >= 0 && pin_current_thread(cpu)) {
+        pinned_workers_.fetch_add(1, std::memory_order_relaxed);
+    }
+    LatencyTracker::register_thread();
+    std::array<DataEvent, WORKER_BATCH_SIZE> batch;
+
+    while (running_.load(std::memory_order_acquire)) {
+        const size_t n = event_buffer_.pop_n(batch.data(), batch.size());
+        if (n == 0) {
+            idle_wait(config_.busy_poll);
+            continue;
+        }
+
+        events_processed_.fetch_add(n, std::memory_order_relaxed);
+        process_batch(batch.data(), n);
+    }
+}
+
+bool DataIngestionEngine::get_latest_market_data(const std::string& symbol, MarketTick& tick) {
+    const uint32_t id = symbol_mapper_.find_id(symbol);
+    return id != 0 && market_aggregator_.get_latest_tick(id, tick);
+}
+
+std::vector<Price> DataIngestionEngine::get_price_history(const std::string& symbol, size_t count) {
+    const uint32_t id = symbol_mapper_.find_id(symbol);
+    return id != 0 ? market_aggregator_.get_price_history(id, count) : std::vector<Price>{};
+}
+
+Span<Price> DataIngestionEngine::get_price_history(std::string_view symbol, size_t count, MonotonicArena& arena) {
+    const uint32_t id = symbol_mapper_.find_id(symbol);
+    return id != 0 ? market_aggregator_.get_price_history(id, count, arena) : Span<Price>{};
+}
+
+void DataIngestionEngine::process_batch(const DataEvent* events, size_t count) {
+    ScopedLatency trace(LatencyStage::PROCESS_BATCH);
+    for (size_t i = 0; i < count; ++i) {
+        if (events[i].is_market_data()) {
+            market_aggregator_.add_tick(events[i].market_tick);
+        }
+    }
+
+    // Compiled pipeline first: one indirect call for the whole batch
+    if (event_sink_) {
+        event_sink_.dispatch(event_sink_.context, events, count);
+    }
+
+    if (!subscribers_.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            distribute_event(events[i]);
+        }
+    }
+}
+
+void DataIngestionEngine::distribute_event(const DataEvent& event) {
+    ScopedLatency trace(LatencyStage::DISTRIBUTE_EVENT);
+    for (const auto& subscriber : subscribers_) {
+        subscriber(event);
+    }
+}
+
+// ---- DataFeedFactory ----
+
+namespace {
+
+// "key=value;key=value" -> value for key, empty when absent
+std::string param(const std::string& params, const std::string& key) {
+    size_t start = 0;
+    while (start <= params.size()) {
+        size_t end = params.find(';', start);
+        if (end == std::string::npos) end = params.size();
+        const std::string item = params.substr(start, end - start);
+        const size_t eq = item.find('=');
+        if (eq != std::string::npos && item.compare(0, eq, key) == 0) {
+            return item.substr(eq + 1);
+        }
+        start = end + 1;
+    }
+    return std::string();
+}
+
+} // namespace
+
+std::unique_ptr<IDataFeed> DataFeedFactory::create_feed(FeedType type, const std::string& config_params) {
+    switch (type) {
+        case FeedType::MULTICAST: {
+            MulticastFeed::Config config;
+            config.line_a = param(config_params, "a");
+            config.line_b = param(config_params, "b");
+            config.interface_address = param(config_params, "iface");
+            const std::string rcvbuf = param(config_params, "rcvbuf");
+            if (!rcvbuf.empty()) {
+                config.socket_buffer_bytes = std::strtoull(rcvbuf.c_str(), nullptr, 10);
+            }
+            if (config.line_a.empty()) {
+                return nullptr;
+            }
+            return std::make_unique<MulticastFeed>(config);
+        }
+        case FeedType::IEX_CLOUD: {
+            const std::string token = param(config_params, "token");
+            if (token.empty()) {
+                return nullptr;
+            }
+            IEXCloudFeed::Config config;
+            const std::string url = param(config_params, "url");
+            if (!url.empty()) {
+                config.base_url = url;
+            }
+            const std::string interval = param(config_params, "interval_ms");
+            if (!interval.empty()) {
+                config.poll_interval_ms = static_cast<uint32_t>(std::strtoul(interval.c_str(), nullptr, 10));
+            }
+            config.options_expiration = param(config_params, "options");
+            config.fetch_options = !config.options_expiration.empty();
+#ifdef HAS_CURL
+            return std::make_unique<IEXCloudFeed>(token, config);
+#else
+            return nullptr;
+#endif
+        }
+        default:
+            return nullptr;
+    }
+}
+
+std::vector<std::string> DataFeedFactory::get_available_feeds() {
+#ifdef HAS_CURL
+    return {"IEX_CLOUD", "MULTICAST"};
+#else
+    return {"MULTICAST"};
+#endif
+}
+
+} // namespace hft::data
@@ -0,0 +1,179 @@
+/*
+ * ===================================================================
+ *                      MARKET DATA VALIDATOR
+ * ===================================================================
+ *
+ * Sanity rules for quotes before they reach the aggregator and the
+ * strategy, one tick at a time or BATCH_SIZE at a time (see
+ * validator_kernels.h for the rules themselves).
+ *
+ * ===================================================================
+ */
+
+#include "../include/data_ingestion.h"
+#include "validator_kernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace hft::data {
+
+namespace detail {
+
+uint64_t validate_quotes_scalar(const TickView& view, const DataValidator::Thresholds& limits,
+                                int64_t* last_good) {
+    uint64_t rejected = 0;
+    for (size_t i = 0; i < view.count; ++i) {
+        if (!(view.eligible >> i & 1)) {
+            continue;
+        }
+        const auto& tick = *reinterpret_cast<const MarketTick*>(view.base + i * view.stride);
+        const bool known = tick.symbol_id < constants::MAX_SYMBOLS;
+        if (known && quote_ok(tick.bid.value, tick.ask.value, tick.volume, last_good[tick.symbol_id], limits)) {
+            last_good[tick.symbol_id] = tick.bid.value + tick.ask.value;
+        } else {
+            rejected |= uint64_t(1) << i;
+        }
+    }
+    return rejected;
+}
+
+uint64_t validate_options_scalar(const TickView& view, const DataValidator::Thresholds& limits,
+                                 const int64_t* last_good) {
+    uint64_t rejected = 0;
+    for (size_t i = 0; i < view.count; ++i) {
+        if (!(view.eligible >> i & 1)) {
+            continue;
+        }
+        const auto& tick = *reinterpret_cast<const OptionTick*>(view.base + i * view.stride);
+        const bool known = tick.underlying_id < constants::MAX_SYMBOLS;
+        if (!known || !option_ok(tick.bid.value, tick.ask.value, tick.strike.value, tick.option_type,
+                                 tick.volume, last_good[tick.underlying_id], limits)) {
+            rejected |= uint64_t(1) << i;
+        }
+    }
+    return rejected;
+}
+
+} // namespace detail
+
+namespace {
+
+int64_t to_bp(double fraction) {
+    const double bp = std::round(fraction * 10000.0);
+    return static_cast<int64_t>(std::min(std::max(bp, 0.0), static_cast<double>(DataValidator::MAX_THRESHOLD_BP)));
+}
+
+bool avx2_supported() {
+#if defined(HFT_SIMD_KERNELS) && (defined(__GNUC__) || defined(__clang__))
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+uint64_t all_of(size_t count) {
+    return count >= 64 ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+}
+
+} // namespace
+
+DataValidator::DataValidator(const ValidationRules& rules)
+    : rules_(rules),
+      thresholds_{to_bp(rules.max_price_change_pct / 100.0),
+                  to_bp(std::min(rules.min_bid_ask_ratio, 1.0)),
+                  to_bp(rules.max_spread_pct / 100.0),
+                  rules.min_volume,
+                  rules.max_volume},
+      vectorized_(false) {}
+
+void DataValidator::set_vectorized(bool enabled) {
+    vectorized_ = enabled && avx2_supported();
+}
+
+bool DataValidator::validate_market_tick(const MarketTick& tick, const MarketTick* prev_tick) {
+    const int64_t prev = prev_tick && prev_tick->bid.value > 0 ? prev_tick->bid.value + prev_tick->ask.value : 0;
+    const bool ok = detail::quote_ok(tick.bid.value, tick.ask.value, tick.volume, prev, thresholds_);
+    count(1, ok ? 0 : 1);
+    return ok;
+}
+
+bool DataValidator::validate_option_tick(const OptionTick& tick, const MarketTick& underlying) {
+    const int64_t reference = underlying.bid.value > 0 && underlying.ask.value >= underlying.bid.value
+        ? underlying.bid.value + underlying.ask.value
+        : 0;
+    const bool ok = detail::option_ok(tick.bid.value, tick.ask.value, tick.strike.value, tick.option_type,
+                                      tick.volume, reference, thresholds_);
+    count(1, ok ? 0 : 1);
+    return ok;
+}
+
+uint64_t DataValidator::validate_market_batch(const MarketTick* ticks, size_t count_in) {
+    const size_t n = std::min(count_in, BATCH_SIZE);
+    const detail::TickView view{reinterpret_cast<const uint8_t*>(ticks), sizeof(MarketTick), n, all_of(n)};
+#ifdef HFT_SIMD_KERNELS
+    if (vectorized_) {
+        return count(n, detail::validate_quotes_avx2(view, thresholds_, last_good_.data()));
+    }
+#endif
+    return count(n, detail::validate_quotes_scalar(view, thresholds_, last_good_.data()));
+}
+
+uint64_t DataValidator::validate_option_batch(const OptionTick* ticks, size_t count_in) {
+    const size_t n = std::min(count_in, BATCH_SIZE);
+    const detail::TickView view{reinterpret_cast<const uint8_t*>(ticks), sizeof(OptionTick), n, all_of(n)};
+#ifdef HFT_SIMD_KERNELS
+    if (vectorized_) {
+        return count(n, detail::validate_options_avx2(view, thresholds_, last_good_.data()));
+    }
+#endif
+    return count(n, detail::validate_options_scalar(view, thresholds_, last_good_.data()));
+}
+
+uint64_t DataValidator::validate_events(const DataEvent* events, size_t count_in) {
+    const size_t n = std::min(count_in, BATCH_SIZE);
+    uint64_t quotes = 0;
+    uint64_t options = 0;
+    for (size_t i = 0; i < n; ++i) {
+        quotes |= uint64_t(events[i].type == DataEventType::MARKET_TICK) << i;
+        options |= uint64_t(events[i].type == DataEventType::OPTION_TICK) << i;
+    }
+
+    const auto* base = reinterpret_cast<const uint8_t*>(events);
+    const detail::TickView quote_view{base + offsetof(DataEvent, market_tick), sizeof(DataEvent), n, quotes};
+    const detail::TickView option_view{base + offsetof(DataEvent, option_tick), sizeof(DataEvent), n, options};
+    // Quotes first: options are bounded by the latest accepted underlying
+    // quote, including those earlier or later in this batch
+    uint64_t rejected = 0;
+#ifdef HFT_SIMD_KERNELS
+    if (vectorized_) {
+        rejected = quotes ? detail::validate_quotes_avx2(quote_view, thresholds_, last_good_.data()) : 0;
+        rejected |= options ? detail::validate_options_avx2(option_view, thresholds_, last_good_.data()) : 0;
+        return count(static_cast<size_t>(__builtin_popcountll(quotes | options)), rejected);
+    }
+#endif
+    rejected = quotes ? detail::validate_quotes_scalar(quote_view, thresholds_, last_good_.data()) : 0;
+    rejected |= options ? detail::validate_options_scalar(option_view, thresholds_, last_good_.data()) : 0;
+    return count(static_cast<size_t>(__builtin_popcountll(quotes | options)), rejected);
+}
+
+double DataValidator::get_rejection_rate() const {
+    const uint64_t validated = get_validated_count();
+    return validated > 0 ? static_cast<double>(get_rejected_count()) / static_cast<double>(validated) : 0.0;
+}
+
+uint64_t DataValidator::count(size_t checked, uint64_t rejected) {
+    validated_count_.store(validated_count_.load(std::memory_order_relaxed) + checked, std::memory_order_relaxed);
+    if (rejected != 0) {
+        rejected_count_.store(rejected_count_.load(std::memory_order_relaxed) +
+                                  static_cast<uint64_t>(__builtin_popcountll(rejected)),
+                              std::memory_order_relaxed);
+    }
+    return rejected;
+}
+
+} // namespace hft::data
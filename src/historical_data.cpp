@@ -0,0 +1,148 @@
+/*
+ * ===================================================================
+ *                    HISTORICAL DATA LOADER
+ * ===================================================================
+ *
+ * CSV ROW FORMAT (header line optional):
+ *   timestamp_ns,bid,ask,last,bid_size,ask_size,volume[,sequence,exchange_id]
+ *
+ * ===================================================================
+ */
+
+#include "../include/data_ingestion.h"
+#include "../include/csv_tick_parser.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace hft::data {
+
+namespace {
+
+bool by_timestamp(const MarketTick& a, const MarketTick& b) {
+    return a.timestamp.nanoseconds_since_epoch < b.timestamp.nanoseconds_since_epoch;
+}
+
+} // namespace
+
+HistoricalDataLoader::HistoricalDataLoader(const std::string& data_dir, SymbolMapper* symbols)
+    : data_directory_(data_dir), symbols_(symbols ? symbols : &own_symbols_) {}
+
+HistoricalDataLoader::~HistoricalDataLoader() = default;
+
+std::string HistoricalDataLoader::resolve_path(const std::string& filename) const {
+    namespace fs = std::filesystem;
+    if (data_directory_.empty() || fs::path(filename).is_absolute() || fs::exists(filename)) {
+        return filename;
+    }
+    return (fs::path(data_directory_) / filename).string();
+}
+
+bool HistoricalDataLoader::load_csv_data(const std::string& filename, const std::string& symbol) {
+    const uint32_t symbol_id = symbols_->get_id(symbol);
+    std::vector<MarketTick> ticks;
+    CsvParseResult parsed;
+    if (!CsvTickParser::parse_file(resolve_path(filename), symbol_id, ticks, parsed)) {
+        return false;
+    }
+    if (parsed.rejected > (parsed.first_line_rejected ? 1u : 0u)) {
+        return false;  // Malformed row (only a header row may fail)
+    }
+
+    if (!std::is_sorted(ticks.begin(), ticks.end(), by_timestamp)) {
+        std::stable_sort(ticks.begin(), ticks.end(), by_timestamp);
+    }
+    archived_data_.erase(symbol);
+    historical_data_[symbol] = std::move(ticks);
+    return true;
+}
+
+bool HistoricalDataLoader::load_binary_data(const std::string& filename) {
+    auto archive = TickArchive::open(resolve_path(filename));
+    if (!archive) {
+        return false;
+    }
+
+    for (size_t i = 0; i < archive->symbol_count(); ++i) {
+        const archive_format::SymbolEntry* entry = archive->symbol(i);
+        const std::string symbol = SymbolKey(entry->key).to_string();
+        symbols_->get_id(symbol);
+        historical_data_.erase(symbol);
+        archived_data_[symbol] = ArchivedSeries{archive.get(), entry};
+    }
+    archives_.push_back(std::move(archive));
+    return true;
+}
+
+bool HistoricalDataLoader::load_symbol(const std::string& symbol) {
+    const std::string archive_name = symbol + ARCHIVE_EXTENSION;
+    if (load_binary_data(archive_name)) {
+        return true;
+    }
+    if (!load_csv_data(symbol + ".csv", symbol)) {
+        return false;
+    }
+
+    // One-shot conversion; later runs take the mapped path above
+    const auto& ticks = historical_data_[symbol];
+    TickArchive::write(resolve_path(archive_name), {ArchiveSeries{symbol, ticks.data(), ticks.size()}});
+    return true;
+}
+
+bool HistoricalDataLoader::save_binary_data(const std::string& filename) const {
+    std::vector<ArchiveSeries> series;
+    series.reserve(historical_data_.size());
+    for (const auto& [symbol, ticks] : historical_data_) {
+        series.push_back(ArchiveSeries{symbol, ticks.data(), ticks.size()});
+    }
+    std::sort(series.begin(), series.end(),
+              [](const ArchiveSeries& a, const ArchiveSeries& b) { return a.symbol < b.symbol; });
+    return TickArchive::write(resolve_path(filename), series);
+}
+
+TickRange HistoricalDataLoader::get_historical_data(const std::string& symbol,
+                                                    const Timestamp& start,
+                                                    const Timestamp& end) const {
+    if (auto it = archived_data_.find(symbol); it != archived_data_.end()) {
+        return TickRange(it->second.archive, it->second.entry, symbols_->find_id(symbol), start, end);
+    }
+
+    auto it = historical_data_.find(symbol);
+    if (it == historical_data_.end()) {
+        return TickRange();
+    }
+    const auto& ticks = it->second;
+    const auto first = std::lower_bound(ticks.begin(), ticks.end(), start.nanoseconds_since_epoch,
+        [](const MarketTick& t, uint64_t ts) { return t.timestamp.nanoseconds_since_epoch < ts; });
+    const auto last = std::upper_bound(first, ticks.end(), end.nanoseconds_since_epoch,
+        [](uint64_t ts, const MarketTick& t) { return ts < t.timestamp.nanoseconds_since_epoch; });
+    return TickRange(ticks.data() + (first - ticks.begin()), ticks.data() + (last - ticks.begin()));
+}
+
+size_t HistoricalDataLoader::get_data_points(const std::string& symbol) const {
+    if (auto it = archived_data_.find(symbol); it != archived_data_.end()) {
+        return it->second.entry->tick_count;
+    }
+    auto it = historical_data_.find(symbol);
+    return it != historical_data_.end() ? it->second.size() : 0;
+}
+
+Timestamp HistoricalDataLoader::get_earliest_timestamp(const std::string& symbol) const {
+    if (auto it = archived_data_.find(symbol); it != archived_data_.end()) {
+        const auto& [archive, entry] = it->second;
+        return entry->block_count ? Timestamp(archive->blocks(*entry)[0].first_timestamp) : Timestamp();
+    }
+    auto it = historical_data_.find(symbol);
+    return it != historical_data_.end() && !it->second.empty() ? it->second.front().timestamp : Timestamp();
+}
+
+Timestamp HistoricalDataLoader::get_latest_timestamp(const std::string& symbol) const {
+    if (auto it = archived_data_.find(symbol); it != archived_data_.end()) {
+        const auto& [archive, entry] = it->second;
+        return entry->block_count ? Timestamp(archive->blocks(*entry)[entry->block_count - 1].last_timestamp)
+                                  : Timestamp();
+    }
+    auto it = historical_data_.find(symbol);
+    return it != historical_data_.end() && !it->second.empty() ? it->second.back().timestamp : Timestamp();
+}
+
+} // namespace hft::data
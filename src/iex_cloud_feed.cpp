@@ -0,0 +1,475 @@
+/*
+ * ===================================================================
+ *                      IEX CLOUD REST FEED
+ * ===================================================================
+ *
+ * Backup quotes and option chains over HTTP.
+ *
+ * - One curl easy handle per endpoint, created when the subscription
+ *   set changes and reused every cycle; its body buffer keeps its
+ *   capacity, so steady-state cycles do not allocate
+ * - All requests of a cycle are in flight together on the multi handle,
+ *   whose connection cache keeps connections alive between cycles
+ *   (HTTP/2 multiplexes them on one connection; libcurl no longer does
+ *   HTTP/1.1 pipelining, so there they queue on the kept-alive ones)
+ * - Bodies are parsed in place with JsonCursor
+ *
+ * ===================================================================
+ */
+
+#include "../include/data_ingestion.h"
+#include "../include/json_cursor.h"
+#include "../include/latency_tracker.h"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+
+#ifdef HAS_CURL
+#include <curl/curl.h>
+#endif
+
+namespace hft::data {
+
+namespace {
+
+constexpr size_t QUOTE_BODY_RESERVE = 4096;
+constexpr size_t CHAIN_BODY_RESERVE = 256 * 1024;
+constexpr uint32_t STOP_CHECK_MS = 10;
+
+// Days since 1970-01-01 for a civil date (proleptic Gregorian)
+int64_t days_from_civil(int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+int64_t days_from_yyyymmdd(uint32_t date) {
+    return days_from_civil(date / 10000, (date / 100) % 100, date % 100);
+}
+
+uint32_t today_yyyymmdd() {
+    const std::time_t now = std::time(nullptr);
+    std::tm utc{};
+    gmtime_r(&now, &utc);
+    return static_cast<uint32_t>((utc.tm_year + 1900) * 10000 + (utc.tm_mon + 1) * 100 + utc.tm_mday);
+}
+
+// "20261120" (string or number) -> 20261120
+bool read_date(JsonCursor& json, uint32_t& out) {
+    std::string_view text;
+    uint64_t number = 0;
+    if (json.peek() == '"') {
+        if (!json.read_string(text) || text.size() != 8) return false;
+        uint32_t value = 0;
+        for (const char c : text) {
+            if (static_cast<unsigned>(c - '0') > 9) return false;
+            value = value * 10 + static_cast<uint32_t>(c - '0');
+        }
+        out = value;
+        return true;
+    }
+    if (json.read_uint(number) && number >= 19000101 && number <= 99991231) {
+        out = static_cast<uint32_t>(number);
+        return true;
+    }
+    return false;
+}
+
+// Contract id from the vendor's contract symbol (FNV-1a)
+uint32_t contract_id(std::string_view symbol) {
+    uint32_t hash = 2166136261u;
+    for (const char c : symbol) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+template<typename T>
+void read_count(JsonCursor& json, T& out) {
+    uint64_t value;
+    if (json.read_uint(value)) {
+        out = static_cast<T>(std::min<uint64_t>(value, UINT32_MAX));
+    }
+}
+
+} // namespace
+
+// ---- Parsing ----
+
+bool IEXCloudFeed::parse_quote(std::string_view body, MarketTick& tick) {
+    JsonCursor json(body.data(), body.size());
+    if (!json.enter_object()) {
+        return false;
+    }
+
+    bool have_price = false;
+    std::string_view key;
+    while (json.next_key(key)) {
+        uint64_t millis;
+        if (key == "latestPrice") {
+            have_price = json.read_price(tick.last);
+        } else if (key == "iexBidPrice") {
+            json.read_price(tick.bid);
+        } else if (key == "iexAskPrice") {
+            json.read_price(tick.ask);
+        } else if (key == "iexBidSize") {
+            read_count(json, tick.bid_size);
+        } else if (key == "iexAskSize") {
+            read_count(json, tick.ask_size);
+        } else if (key == "latestVolume") {
+            read_count(json, tick.volume);
+        } else if (key == "latestUpdate") {
+            if (json.read_uint(millis)) {
+                tick.timestamp = Timestamp(millis * 1000000ull);
+            }
+        } else {
+            json.skip();
+        }
+    }
+    return json.ok() && json.at_end() && have_price;
+}
+
+bool IEXCloudFeed::parse_options_chain(std::string_view body, uint32_t underlying_id, uint32_t today,
+                                       std::vector<OptionTick>& out) {
+    out.clear();
+    JsonCursor json(body.data(), body.size());
+    if (!json.enter_array()) {
+        return false;
+    }
+
+    const int64_t today_days = days_from_yyyymmdd(today);
+    std::string_view key;
+    std::string_view text;
+    while (json.next_element()) {
+        if (!json.enter_object()) {
+            return false;
+        }
+        OptionTick& tick = out.emplace_back();
+        tick = OptionTick{};
+        tick.underlying_id = underlying_id;
+        bool have_strike = false;
+        bool have_side = false;
+
+        while (json.next_key(key)) {
+            if (key == "id") {
+                if (json.read_string(text)) tick.symbol_id = contract_id(text);
+            } else if (key == "expirationDate") {
+                read_date(json, tick.expiration_date);
+            } else if (key == "strikePrice") {
+                have_strike = json.read_price(tick.strike);
+            } else if (key == "side") {
+                if (json.read_string(text)) {
+                    have_side = text == "call" || text == "put";
+                    tick.option_type = text == "put" ? 1 : 0;
+                }
+            } else if (key == "bid") {
+                json.read_price(tick.bid);
+            } else if (key == "ask") {
+                json.read_price(tick.ask);
+            } else if (key == "lastPrice" || key == "closingPrice") {
+                json.read_price(tick.last);
+            } else if (key == "volume") {
+                read_count(json, tick.volume);
+            } else if (key == "openInterest") {
+                read_count(json, tick.open_interest);
+            } else if (key == "impliedVolatility") {
+                json.read_double(tick.implied_volatility);
+            } else {
+                json.skip();
+            }
+        }
+        if (!json.ok()) {
+            return false;
+        }
+
+        if (!have_strike || !have_side || tick.expiration_date == 0) {
+            out.pop_back();   // Incomplete contract
+            continue;
+        }
+        const int64_t days = days_from_yyyymmdd(tick.expiration_date) - today_days;
+        tick.days_to_expiry = static_cast<uint16_t>(std::clamp<int64_t>(days, 0, UINT16_MAX));
+    }
+    return json.ok() && json.at_end();
+}
+
+// ---- Transport ----
+
+#ifdef HAS_CURL
+
+struct IEXCloudFeed::Transport {
+    struct Request {
+        CURL* easy = nullptr;
+        std::string url;
+        std::string body;
+        uint32_t symbol_id = 0;
+        bool options = false;
+        bool active = false;
+    };
+
+    CURLM* multi = nullptr;
+    std::vector<std::unique_ptr<Request>> requests;
+
+    static size_t append(char* data, size_t size, size_t count, void* user) {
+        static_cast<std::string*>(user)->append(data, size * count);
+        return size * count;
+    }
+
+    void clear_requests() {
+        for (auto& request : requests) {
+            if (request->active) curl_multi_remove_handle(multi, request->easy);
+            curl_easy_cleanup(request->easy);
+        }
+        requests.clear();
+    }
+
+    ~Transport() {
+        clear_requests();
+        if (multi) curl_multi_cleanup(multi);   // Closes the kept-alive connections
+    }
+};
+
+#else
+
+struct IEXCloudFeed::Transport {};
+
+#endif
+
+// ---- Feed ----
+
+IEXCloudFeed::IEXCloudFeed(const std::string& token, const Config& config)
+    : api_token_(token),
+      config_(config),
+      symbols_(&own_symbols_) {}
+
+IEXCloudFeed::~IEXCloudFeed() {
+    disconnect();
+}
+
+void IEXCloudFeed::attach(DataIngestionEngine* engine) {
+    engine_ = engine;
+    symbols_ = &engine->get_symbol_mapper();
+    subscriptions_changed_.store(true);
+}
+
+bool IEXCloudFeed::connect() {
+#ifdef HAS_CURL
+    static const CURLcode global_init = curl_global_init(CURL_GLOBAL_DEFAULT);
+    if (global_init != CURLE_OK) {
+        return false;
+    }
+    if (!transport_) {
+        auto transport = std::make_unique<Transport>();
+        transport->multi = curl_multi_init();
+        if (!transport->multi) {
+            return false;
+        }
+        curl_multi_setopt(transport->multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(transport->multi, CURLMOPT_MAX_HOST_CONNECTIONS,
+                          static_cast<long>(std::max<size_t>(config_.max_connections, 1)));
+        transport_ = std::move(transport);
+        subscriptions_changed_.store(true);
+    }
+    connected_.store(true);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void IEXCloudFeed::disconnect() {
+    stop_feed();
+    transport_.reset();
+    connected_.store(false);
+}
+
+void IEXCloudFeed::subscribe_symbol(const std::string& symbol) {
+    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+    if (std::find(subscribed_symbols_.begin(), subscribed_symbols_.end(), symbol) == subscribed_symbols_.end()) {
+        subscribed_symbols_.push_back(symbol);
+        subscriptions_changed_.store(true);
+    }
+}
+
+void IEXCloudFeed::unsubscribe_symbol(const std::string& symbol) {
+    std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+    auto it = std::find(subscribed_symbols_.begin(), subscribed_symbols_.end(), symbol);
+    if (it != subscribed_symbols_.end()) {
+        subscribed_symbols_.erase(it);
+        subscriptions_changed_.store(true);
+    }
+}
+
+void IEXCloudFeed::start_feed() {
+    if (!connected_.load() && !connect()) {
+        return;
+    }
+    if (running_.exchange(true)) {
+        return;
+    }
+    polling_thread_ = std::thread(&IEXCloudFeed::polling_loop, this);
+}
+
+void IEXCloudFeed::stop_feed() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (polling_thread_.joinable()) {
+        polling_thread_.join();
+    }
+}
+
+void IEXCloudFeed::polling_loop() {
+    LatencyTracker::register_thread();
+    if (engine_) engine_->register_publisher();
+    while (running_.load(std::memory_order_acquire)) {
+        const auto cycle_start = std::chrono::steady_clock::now();
+        poll_once();
+        const auto next_cycle = cycle_start + std::chrono::milliseconds(config_.poll_interval_ms);
+        while (running_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < next_cycle) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                next_cycle - std::chrono::steady_clock::now(), std::chrono::milliseconds(STOP_CHECK_MS)));
+        }
+    }
+}
+
+// Cold path: only when the subscription set changes
+void IEXCloudFeed::rebuild_requests() {
+#ifdef HAS_CURL
+    std::vector<std::string> symbols;
+    {
+        std::lock_guard<std::mutex> lock(subscriptions_mutex_);
+        symbols = subscribed_symbols_;
+        subscriptions_changed_.store(false);
+    }
+
+    transport_->clear_requests();
+    const long timeout_ms = static_cast<long>(std::max<uint32_t>(config_.poll_interval_ms, 1000)) * 5;
+    auto add = [&](const std::string& symbol, bool options) {
+        auto request = std::make_unique<Transport::Request>();
+        request->url = config_.base_url + "/stock/" + symbol +
+                       (options ? "/options/" + config_.options_expiration : std::string("/quote")) +
+                       "?token=" + api_token_;
+        request->body.reserve(options ? CHAIN_BODY_RESERVE : QUOTE_BODY_RESERVE);
+        request->symbol_id = symbols_->get_id(symbol);
+        request->options = options;
+
+        CURL* easy = curl_easy_init();
+        if (!easy) return;
+        curl_easy_setopt(easy, CURLOPT_URL, request->url.c_str());
+        curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, &Transport::append);
+        curl_easy_setopt(easy, CURLOPT_WRITEDATA, &request->body);
+        curl_easy_setopt(easy, CURLOPT_PRIVATE, reinterpret_cast<void*>(transport_->requests.size()));
+        curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);             // Prefer multiplexing to a new connection
+        curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(easy, CURLOPT_TCP_NODELAY, 1L);
+        curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, timeout_ms);
+        request->easy = easy;
+        transport_->requests.push_back(std::move(request));
+    };
+    for (const auto& symbol : symbols) {
+        if (symbols_->get_id(symbol) == 0) continue;   // Not representable
+        add(symbol, false);
+        if (config_.fetch_options && !config_.options_expiration.empty()) {
+            add(symbol, true);
+        }
+    }
+#endif
+}
+
+// One cycle: every request in flight together, handled as each completes
+void IEXCloudFeed::poll_once() {
+#ifdef HAS_CURL
+    if (!transport_) {
+        return;
+    }
+    if (subscriptions_changed_.load()) {
+        rebuild_requests();
+    }
+
+    auto& requests = transport_->requests;
+    for (auto& request : requests) {
+        request->body.clear();   // Keeps its capacity
+        request->active = curl_multi_add_handle(transport_->multi, request->easy) == CURLM_OK;
+    }
+
+    int running = 0;
+    do {
+        curl_multi_perform(transport_->multi, &running);
+        int queued = 0;
+        while (CURLMsg* message = curl_multi_info_read(transport_->multi, &queued)) {
+            if (message->msg != CURLMSG_DONE) continue;
+            CURL* easy = message->easy_handle;
+            char* index = nullptr;
+            curl_easy_getinfo(easy, CURLINFO_PRIVATE, &index);
+            long status = 0;
+            curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
+            const size_t request = reinterpret_cast<size_t>(index);
+
+            if (message->data.result == CURLE_OK && status == 200) {
+                handle_response(request);
+            } else {
+                request_failures_.fetch_add(1, std::memory_order_relaxed);
+            }
+            curl_multi_remove_handle(transport_->multi, easy);
+            requests[request]->active = false;
+        }
+        if (running > 0) {
+            curl_multi_poll(transport_->multi, nullptr, 0, static_cast<int>(STOP_CHECK_MS), nullptr);
+        }
+    } while (running > 0 && running_.load(std::memory_order_acquire));
+
+    for (auto& request : requests) {   // Stopped mid-cycle
+        if (request->active) {
+            curl_multi_remove_handle(transport_->multi, request->easy);
+            request->active = false;
+        }
+    }
+    poll_cycles_.fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+void IEXCloudFeed::handle_response(size_t index) {
+    ScopedLatency trace(LatencyStage::FEED_RECEIVE);
+#ifdef HAS_CURL
+    const Transport::Request& request = *transport_->requests[index];
+    const Timestamp received = Timestamp::now();
+
+    if (!request.options) {
+        MarketTick tick{};
+        tick.symbol_id = request.symbol_id;
+        tick.timestamp = received;
+        if (!parse_quote(request.body, tick)) {
+            parse_failures_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        responses_.fetch_add(1, std::memory_order_relaxed);
+        if (market_callback_) market_callback_(tick);
+        if (engine_) engine_->publish_event(DataEvent(DataEventType::MARKET_TICK, tick, received));
+        return;
+    }
+
+    if (!parse_options_chain(request.body, request.symbol_id, today_yyyymmdd(), chain_)) {
+        parse_failures_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    responses_.fetch_add(1, std::memory_order_relaxed);
+    for (OptionTick& tick : chain_) {
+        tick.timestamp = received;
+        if (option_callback_) option_callback_(tick);
+    }
+    if (engine_) {
+        engine_->publish_in_place(chain_.size(), [&](DataEvent& slot, size_t i) {
+            slot = DataEvent(DataEventType::OPTION_TICK, chain_[i], received);
+        });
+    }
+#else
+    (void)index;
+#endif
+}
+
+} // namespace hft::data
@@ -0,0 +1,273 @@
+/*
+ * ===================================================================
+ *                    ON-DEMAND JSON CURSOR
+ * ===================================================================
+ */
+
+#include "../include/json_cursor.h"
+#include <charconv>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HFT_JSON_SIMD 1
+#endif
+
+namespace hft::data {
+
+namespace {
+
+constexpr size_t SCAN_WIDTH = 16;
+
+inline bool is_whitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+inline bool is_number_char(char c) {
+    return static_cast<unsigned>(c - '0') <= 9 || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+// First '"' or '\\' at or after p, or end
+inline const char* find_quote_or_escape(const char* p, const char* end) {
+#ifdef HFT_JSON_SIMD
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i escape = _mm_set1_epi8('\\');
+    for (; end - p >= static_cast<ptrdiff_t>(SCAN_WIDTH); p += SCAN_WIDTH) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, escape))));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+    }
+#endif
+    for (; p < end; ++p) {
+        if (*p == '"' || *p == '\\') return p;
+    }
+    return end;
+}
+
+} // namespace
+
+void JsonCursor::skip_whitespace() {
+    while (p_ < end_ && is_whitespace(*p_)) ++p_;
+}
+
+bool JsonCursor::at_end() {
+    skip_whitespace();
+    return p_ == end_;
+}
+
+char JsonCursor::peek() {
+    skip_whitespace();
+    return p_ < end_ ? *p_ : '\0';
+}
+
+bool JsonCursor::consume_literal(const char* literal, size_t length) {
+    if (static_cast<size_t>(end_ - p_) < length || std::memcmp(p_, literal, length) != 0) {
+        return fail();
+    }
+    p_ += length;
+    return true;
+}
+
+bool JsonCursor::scan_string(const char*& begin, const char*& end) {
+    begin = ++p_;   // Past the opening quote
+    for (;;) {
+        const char* hit = find_quote_or_escape(p_, end_);
+        if (hit == end_) {
+            return fail();
+        }
+        if (*hit == '"') {
+            end = hit;
+            p_ = hit + 1;
+            return true;
+        }
+        if (end_ - hit < 2) {
+            return fail();
+        }
+        p_ = hit + 2;   // Escaped character, whatever it is
+    }
+}
+
+bool JsonCursor::scan_number(const char*& begin, const char*& end) {
+    begin = p_;
+    while (p_ < end_ && is_number_char(*p_)) ++p_;
+    end = p_;
+    return end != begin;
+}
+
+bool JsonCursor::enter_object() {
+    skip_whitespace();
+    if (!ok_ || p_ == end_ || *p_ != '{') return fail();
+    ++p_;
+    return true;
+}
+
+bool JsonCursor::enter_array() {
+    skip_whitespace();
+    if (!ok_ || p_ == end_ || *p_ != '[') return fail();
+    ++p_;
+    return true;
+}
+
+bool JsonCursor::next_key(std::string_view& key) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ == '}') {
+        ++p_;
+        return false;
+    }
+    if (*p_ == ',') {
+        ++p_;
+        skip_whitespace();
+    }
+    if (p_ == end_ || *p_ != '"') return fail();
+
+    const char* begin;
+    const char* end;
+    if (!scan_string(begin, end)) return false;
+    skip_whitespace();
+    if (p_ == end_ || *p_ != ':') return fail();
+    ++p_;
+    key = std::string_view(begin, static_cast<size_t>(end - begin));
+    return true;
+}
+
+bool JsonCursor::next_element() {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ == ']') {
+        ++p_;
+        return false;
+    }
+    if (*p_ == ',') {
+        ++p_;
+        skip_whitespace();
+        if (p_ == end_ || *p_ == ']') return fail();   // Trailing comma
+    }
+    return true;
+}
+
+bool JsonCursor::skip_null_or_other() {
+    skip();
+    return false;
+}
+
+bool JsonCursor::read_string(std::string_view& out) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ != '"') return skip_null_or_other();
+    const char* begin;
+    const char* end;
+    if (!scan_string(begin, end)) return false;
+    out = std::string_view(begin, static_cast<size_t>(end - begin));
+    return true;
+}
+
+bool JsonCursor::read_price(Price& out) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ != '-' && static_cast<unsigned>(*p_ - '0') > 9) return skip_null_or_other();
+    const char* begin;
+    const char* end;
+    scan_number(begin, end);
+    if (Price::parse(begin, end, out)) {
+        return true;
+    }
+    double value;                                   // Exponent form
+    const auto result = std::from_chars(begin, end, value);
+    if (result.ec != std::errc() || result.ptr != end) return fail();
+    out = Price::from_double(value, Rounding::NEAREST);
+    return true;
+}
+
+bool JsonCursor::read_double(double& out) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ != '-' && static_cast<unsigned>(*p_ - '0') > 9) return skip_null_or_other();
+    const char* begin;
+    const char* end;
+    scan_number(begin, end);
+    const auto result = std::from_chars(begin, end, out);
+    if (result.ec != std::errc() || result.ptr != end) return fail();
+    return true;
+}
+
+bool JsonCursor::read_uint(uint64_t& out) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (static_cast<unsigned>(*p_ - '0') > 9) return skip_null_or_other();
+    const char* begin;
+    const char* end;
+    scan_number(begin, end);
+    uint64_t value;
+    const auto result = std::from_chars(begin, end, value);
+    if (result.ec != std::errc()) return fail();
+    if (result.ptr != end) {                        // 12.0, 1e6
+        double real;
+        const auto full = std::from_chars(begin, end, real);
+        if (full.ec != std::errc() || full.ptr != end) return fail();
+        value = static_cast<uint64_t>(real);
+    }
+    out = value;
+    return true;
+}
+
+bool JsonCursor::read_bool(bool& out) {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+    if (*p_ == 't') {
+        if (!consume_literal("true", 4)) return false;
+        out = true;
+        return true;
+    }
+    if (*p_ == 'f') {
+        if (!consume_literal("false", 5)) return false;
+        out = false;
+        return true;
+    }
+    return skip_null_or_other();
+}
+
+bool JsonCursor::skip() {
+    skip_whitespace();
+    if (!ok_ || p_ == end_) return fail();
+
+    const char* begin;
+    const char* end;
+    switch (*p_) {
+        case '"':
+            return scan_string(begin, end);
+        case 't':
+            return consume_literal("true", 4);
+        case 'f':
+            return consume_literal("false", 5);
+        case 'n':
+            return consume_literal("null", 4);
+        case '{':
+        case '[': {
+            // Brackets only need to balance; strings are skipped whole
+            size_t depth = 0;
+            while (p_ < end_) {
+                const char c = *p_;
+                if (c == '"') {
+                    if (!scan_string(begin, end)) return false;
+                    continue;
+                }
+                ++p_;
+                if (c == '{' || c == '[') {
+                    ++depth;
+                } else if (c == '}' || c == ']') {
+                    if (--depth == 0) return true;
+                }
+            }
+            return fail();
+        }
+        default:
+            if (!scan_number(begin, end)) return fail();
+            return true;
+    }
+}
+
+} // namespace hft::data
@@ -0,0 +1,261 @@
+/*
+ * ===================================================================
+ *                  HOT-PATH LATENCY TRACEPOINTS
+ * ===================================================================
+ */
+
+#include "../include/latency_tracker.h"
+#include "../include/market_data.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace hft::data {
+
+namespace {
+
+// One recording thread's histograms, owned by at most one live thread
+struct ThreadSlot {
+    std::atomic<bool> owned{false};
+    std::array<LatencyHistogram, LATENCY_STAGE_COUNT> stages;
+};
+
+// Grow-only; slots are never freed, so readers can walk them at any time
+std::array<std::atomic<ThreadSlot*>, LatencyTracker::MAX_THREADS> g_slots{};
+
+ThreadSlot* acquire_slot() {
+    for (auto& entry : g_slots) {
+        ThreadSlot* slot = entry.load(std::memory_order_acquire);
+        if (!slot) {
+            auto* fresh = new ThreadSlot;
+            fresh->owned.store(true, std::memory_order_relaxed);
+            if (entry.compare_exchange_strong(slot, fresh, std::memory_order_acq_rel)) {
+                return fresh;
+            }
+            delete fresh;   // Another thread filled this entry first
+        }
+        bool owned = false;
+        if (slot->owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel)) {
+            return slot;    // Left behind by a thread that exited
+        }
+    }
+    return nullptr;
+}
+
+struct LocalSlot {
+    ThreadSlot* slot = nullptr;
+    bool exhausted = false;   // Every slot taken: stop searching
+
+    ~LocalSlot() {
+        if (slot) {
+            slot->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+thread_local LocalSlot t_slot;
+
+ThreadSlot* local_slot() {
+    if (!t_slot.slot && !t_slot.exhausted && !(t_slot.slot = acquire_slot())) {
+        t_slot.exhausted = true;
+    }
+    return t_slot.slot;
+}
+
+} // namespace
+
+std::atomic<bool> LatencyTracker::enabled_{true};
+
+const char* to_string(LatencyStage stage) {
+    switch (stage) {
+        case LatencyStage::FEED_RECEIVE:     return "feed_receive";
+        case LatencyStage::PROCESS_BATCH:    return "process_batch";
+        case LatencyStage::DISTRIBUTE_EVENT: return "distribute_event";
+        case LatencyStage::STRATEGY_TICK:    return "strategy_tick";
+        case LatencyStage::ENTRY_ANALYSIS:   return "entry_analysis";
+        case LatencyStage::ORDER_SUBMIT:     return "order_submit";
+        case LatencyStage::COUNT:            break;
+    }
+    return "unknown";
+}
+
+// ---- TscClock ----
+
+const TscClock::Calibration& TscClock::calibration() {
+    static const Calibration calibration = [] {
+        Calibration c;
+        c.base_ns = Timestamp::now().nanoseconds_since_epoch;
+        c.base_tsc = now();
+#ifdef HFT_HAS_RDTSC
+        std::this_thread::sleep_for(std::chrono::milliseconds(CALIBRATION_MS));
+        const uint64_t end_ns = Timestamp::now().nanoseconds_since_epoch;
+        const uint64_t end_tsc = now();
+        c.ns_per_tick = end_tsc > c.base_tsc
+            ? static_cast<double>(end_ns - c.base_ns) / static_cast<double>(end_tsc - c.base_tsc)
+            : 1.0;
+#else
+        c.ns_per_tick = 1.0;
+#endif
+        return c;
+    }();
+    return calibration;
+}
+
+// Off the hot path: the first tracepoint would otherwise sleep here
+[[maybe_unused]] const bool g_calibrated = TscClock::ns_per_tick() > 0.0;
+
+uint64_t TscClock::to_epoch_ns(uint64_t tsc) {
+    const Calibration& c = calibration();
+    const double offset = (static_cast<double>(tsc) - static_cast<double>(c.base_tsc)) * c.ns_per_tick;
+    return static_cast<uint64_t>(static_cast<double>(c.base_ns) + offset);
+}
+
+// ---- Histograms ----
+
+void LatencyHistogram::reset() {
+    for (auto& count : counts_) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    total_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+void HistogramSnapshot::add(const LatencyHistogram& histogram) {
+    for (size_t i = 0; i < LatencyHistogram::BUCKETS; ++i) {
+        const uint64_t n = histogram.count(i);
+        counts_[i] += n;
+        total_ += n;   // Sum of the buckets read, so percentiles stay consistent
+    }
+    max_ = std::max(max_, histogram.max());
+}
+
+uint64_t HistogramSnapshot::percentile(double q) const {
+    if (total_ == 0) {
+        return 0;
+    }
+    q = std::min(std::max(q, 0.0), 1.0);
+    const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * static_cast<double>(total_))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LatencyHistogram::BUCKETS; ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            return std::min(LatencyHistogram::highest_in(i), max_);
+        }
+    }
+    return max_;
+}
+
+// ---- LatencyTracker ----
+
+LatencyHistogram* LatencyTracker::local(LatencyStage stage) {
+    ThreadSlot* slot = local_slot();
+    return slot ? &slot->stages[static_cast<size_t>(stage)] : nullptr;
+}
+
+bool LatencyTracker::register_thread() {
+    return local_slot() != nullptr;
+}
+
+HistogramSnapshot LatencyTracker::snapshot(LatencyStage stage) {
+    HistogramSnapshot merged;
+    for (const auto& entry : g_slots) {
+        if (const ThreadSlot* slot = entry.load(std::memory_order_acquire)) {
+            merged.add(slot->stages[static_cast<size_t>(stage)]);
+        }
+    }
+    return merged;
+}
+
+void LatencyTracker::report(LatencyReport& out) {
+    for (size_t i = 0; i < LATENCY_STAGE_COUNT; ++i) {
+        const auto stage = static_cast<LatencyStage>(i);
+        const HistogramSnapshot merged = snapshot(stage);
+        out[i] = StageLatency{stage, merged.total(), merged.percentile(0.50), merged.percentile(0.99),
+                              merged.percentile(0.999), merged.max()};
+    }
+}
+
+std::string LatencyTracker::format_report(const LatencyReport& report) {
+    std::string text;
+    char line[160];
+    for (const StageLatency& stage : report) {
+        if (stage.count == 0) {
+            continue;
+        }
+        const int length = std::snprintf(
+            line, sizeof(line), "[LATENCY] %-16s n=%llu p50=%lluns p99=%lluns p99.9=%lluns max=%lluns\n",
+            to_string(stage.stage), static_cast<unsigned long long>(stage.count),
+            static_cast<unsigned long long>(stage.p50_ns), static_cast<unsigned long long>(stage.p99_ns),
+            static_cast<unsigned long long>(stage.p999_ns), static_cast<unsigned long long>(stage.max_ns));
+        if (length > 0) {
+            text.append(line, std::min(static_cast<size_t>(length), sizeof(line) - 1));
+        }
+    }
+    return text;
+}
+
+void LatencyTracker::reset() {
+    for (const auto& entry : g_slots) {
+        if (ThreadSlot* slot = entry.load(std::memory_order_acquire)) {
+            for (auto& histogram : slot->stages) {
+                histogram.reset();
+            }
+        }
+    }
+}
+
+// ---- LatencyReporter ----
+
+LatencyReporter::LatencyReporter(uint32_t interval_ms, Sink sink)
+    : interval_ms_(std::max<uint32_t>(interval_ms, 1)),
+      sink_(std::move(sink)) {}
+
+LatencyReporter::~LatencyReporter() {
+    stop();
+}
+
+bool LatencyReporter::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    thread_ = std::thread(&LatencyReporter::run, this);
+    return true;
+}
+
+void LatencyReporter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+    wake_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void LatencyReporter::run() {
+    LatencyReport report;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        if (wake_.wait_for(lock, std::chrono::milliseconds(interval_ms_),
+                           [this] { return !running_.load(std::memory_order_acquire); })) {
+            return;
+        }
+        LatencyTracker::report(report);
+        const std::string text = LatencyTracker::format_report(report);
+        if (text.empty()) {
+            continue;
+        }
+        if (sink_) {
+            sink_(text);
+        } else {
+            std::clog << text << std::flush;
+        }
+        reports_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace hft::data
@@ -0,0 +1,262 @@
+/*
+ * ===================================================================
+ *                    MARKET DATA AGGREGATION
+ * ===================================================================
+ *
+ * Per-symbol columnar tick history with O(1) VWAP, volatility and
+ * latest-tick queries.
+ *
+ * CONCURRENCY:
+ * - Writers serialize per symbol by taking the seqlock version odd
+ * - Readers copy what they need and retry if the version moved
+ * - Series are published once with a CAS and live until destruction
+ *
+ * ===================================================================
+ */
+
+#include "../include/market_data.h"
+#include <algorithm>
+#include <cmath>
+
+namespace hft::data {
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+// Reference price for returns: mid when both sides are quoted, else last
+inline double mark_price(const MarketTick& tick) {
+    if (tick.bid.value > 0 && tick.ask.value > 0) {
+        return (tick.bid.to_double() + tick.ask.to_double()) * 0.5;
+    }
+    return tick.last.to_double();
+}
+
+// Run reader against a consistent snapshot of series
+template<typename Reader>
+auto read_consistent(const SymbolTickSeries& series, Reader&& reader) {
+    for (;;) {
+        const uint64_t before = series.version.load(std::memory_order_acquire);
+        if (before & 1) {
+            cpu_relax();
+            continue;
+        }
+        auto result = reader();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (series.version.load(std::memory_order_relaxed) == before) {
+            return result;
+        }
+    }
+}
+
+} // namespace
+
+MarketDataAggregator::~MarketDataAggregator() {
+    for (auto& slot : series_) {
+        delete slot.load(std::memory_order_relaxed);
+    }
+}
+
+SymbolTickSeries* MarketDataAggregator::series_for(uint32_t symbol_id) const {
+    return symbol_id < series_.size() ? series_[symbol_id].load(std::memory_order_acquire) : nullptr;
+}
+
+SymbolTickSeries* MarketDataAggregator::get_or_create_series(uint32_t symbol_id) {
+    if (symbol_id >= series_.size()) {
+        return nullptr;
+    }
+
+    SymbolTickSeries* existing = series_[symbol_id].load(std::memory_order_acquire);
+    if (existing) {
+        return existing;
+    }
+
+    // Cold path: first tick for this symbol
+    auto* created = new SymbolTickSeries();
+    if (series_[symbol_id].compare_exchange_strong(existing, created, std::memory_order_acq_rel)) {
+        return created;
+    }
+    delete created;
+    return existing;
+}
+
+void MarketDataAggregator::add_tick(const MarketTick& tick) {
+    SymbolTickSeries* series = get_or_create_series(tick.symbol_id);
+    if (!series) {
+        return;
+    }
+
+    uint64_t version = series->version.load(std::memory_order_relaxed);
+    for (;;) {
+        if (!(version & 1) &&
+            series->version.compare_exchange_weak(version, version + 1, std::memory_order_acquire)) {
+            break;
+        }
+        cpu_relax();
+        version = series->version.load(std::memory_order_relaxed);
+    }
+
+    SymbolTickSeries& s = *series;
+    const size_t slot = s.count & SymbolTickSeries::MASK;
+    const double mark = mark_price(tick);
+
+    s.notional_before[slot] = s.total_notional;
+    s.volume_before[slot] = s.total_volume;
+    s.return_before[slot] = s.total_return;
+    s.return_sq_before[slot] = s.total_return_sq;
+
+    s.timestamps[slot] = tick.timestamp.nanoseconds_since_epoch;
+    s.mids[slot] = mark;
+    s.lasts[slot] = tick.last.value;
+    s.volumes[slot] = tick.volume;
+
+    s.total_notional += tick.last.to_double() * tick.volume;
+    s.total_volume += tick.volume;
+    if (s.count > 0 && s.mark > 0.0 && mark > 0.0) {
+        const double r = std::log(mark / s.mark);
+        s.total_return += r;
+        s.total_return_sq += r * r;
+    }
+
+    s.mark = mark;
+    s.latest = tick;
+    ++s.count;
+
+    series->version.store(version + 2, std::memory_order_release);
+}
+
+double MarketDataAggregator::calculate_vwap(uint32_t symbol_id, size_t window) const {
+    const SymbolTickSeries* series = series_for(symbol_id);
+    if (!series || window == 0) {
+        return 0.0;
+    }
+
+    return read_consistent(*series, [&] {
+        const uint64_t n = std::min<uint64_t>({window, series->count, SymbolTickSeries::HISTORY_SIZE});
+        if (n == 0) {
+            return 0.0;
+        }
+        const size_t first = (series->count - n) & SymbolTickSeries::MASK;
+        const double volume = series->total_volume - series->volume_before[first];
+        const double notional = series->total_notional - series->notional_before[first];
+        return volume > 0.0 ? notional / volume : 0.0;
+    });
+}
+
+double MarketDataAggregator::calculate_volatility(uint32_t symbol_id, size_t window) const {
+    const SymbolTickSeries* series = series_for(symbol_id);
+    if (!series || window < 2) {
+        return 0.0;
+    }
+
+    return read_consistent(*series, [&] {
+        // Tick 0 carries no return, so at most count - 1 returns exist
+        const uint64_t returns = series->count > 0 ? series->count - 1 : 0;
+        const uint64_t n = std::min<uint64_t>({window, returns, SymbolTickSeries::HISTORY_SIZE});
+        if (n < 2) {
+            return 0.0;
+        }
+        const size_t first = (series->count - n) & SymbolTickSeries::MASK;
+        const double sum = series->total_return - series->return_before[first];
+        const double sum_sq = series->total_return_sq - series->return_sq_before[first];
+        const double variance = (sum_sq - sum * sum / n) / (n - 1);
+        return variance > 0.0 ? std::sqrt(variance) : 0.0;
+    });
+}
+
+bool MarketDataAggregator::get_latest_tick(uint32_t symbol_id, MarketTick& tick) const {
+    const SymbolTickSeries* series = series_for(symbol_id);
+    if (!series) {
+        return false;
+    }
+
+    return read_consistent(*series, [&] {
+        if (series->count == 0) {
+            return false;
+        }
+        tick = series->latest;
+        return true;
+    });
+}
+
+size_t MarketDataAggregator::copy_price_history(uint32_t symbol_id, Price* out, size_t max) const {
+    const SymbolTickSeries* series = series_for(symbol_id);
+    if (!series || max == 0) {
+        return 0;
+    }
+
+    const size_t capacity = std::min<size_t>(max, SymbolTickSeries::HISTORY_SIZE);
+    return read_consistent(*series, [&] {
+        const uint64_t n = std::min<uint64_t>(capacity, series->count);
+        const uint64_t first = series->count - n;
+        for (uint64_t i = 0; i < n; ++i) {
+            out[i].value = series->lasts[(first + i) & SymbolTickSeries::MASK];
+        }
+        return static_cast<size_t>(n);
+    });
+}
+
+Span<Price> MarketDataAggregator::get_price_history(uint32_t symbol_id, size_t count,
+                                                    MonotonicArena& arena) const {
+    if (!series_for(symbol_id) || count == 0) {
+        return {};
+    }
+    const Span<Price> history =
+        arena.allocate_array<Price>(std::min<size_t>(count, SymbolTickSeries::HISTORY_SIZE));
+    return history.first(copy_price_history(symbol_id, history.data(), history.size()));
+}
+
+std::vector<Price> MarketDataAggregator::get_price_history(uint32_t symbol_id, size_t count) const {
+    std::vector<Price> history;
+    if (!series_for(symbol_id) || count == 0) {
+        return history;
+    }
+    history.resize(std::min<size_t>(count, SymbolTickSeries::HISTORY_SIZE));
+    history.resize(copy_price_history(symbol_id, history.data(), history.size()));
+    return history;
+}
+
+uint64_t MarketDataAggregator::get_tick_count(uint32_t symbol_id) const {
+    const SymbolTickSeries* series = series_for(symbol_id);
+    return series ? read_consistent(*series, [&] { return series->count; }) : 0;
+}
+
+// ===================================================================
+//                     BATCH PRICE OPERATIONS
+// ===================================================================
+
+// (bid + ask) / 2 truncates toward zero like Price::midpoint(TOWARD_ZERO);
+// the sum cannot overflow for any quotable price
+void compute_midpoints(const MarketTick* ticks, size_t count, int64_t* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (ticks[i].bid.value + ticks[i].ask.value) / 2;
+    }
+}
+
+void compute_spreads(const MarketTick* ticks, size_t count, int64_t* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = ticks[i].ask.value - ticks[i].bid.value;
+    }
+}
+
+void compute_midpoints(const int64_t* __restrict bid, const int64_t* __restrict ask, size_t count,
+                       int64_t* __restrict out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = (bid[i] + ask[i]) / 2;
+    }
+}
+
+void compute_spreads(const int64_t* __restrict bid, const int64_t* __restrict ask, size_t count,
+                     int64_t* __restrict out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = ask[i] - bid[i];
+    }
+}
+
+} // namespace hft::data
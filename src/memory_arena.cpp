@@ -0,0 +1,27 @@
+/*
+ * ===================================================================
+ *                  ARENA AND POOL ALLOCATORS
+ * ===================================================================
+ */
+
+#include "../include/memory_arena.h"
+#include <algorithm>
+
+namespace hft::data {
+
+MonotonicArena::MonotonicArena(size_t bytes, bool use_hugepages, int numa_node)
+    : buffer_(bytes, use_hugepages, numa_node) {}
+
+void* MonotonicArena::allocate(size_t bytes, size_t alignment) {
+    // alignment is a power of two; the block itself is page aligned
+    const size_t start = (offset_ + alignment - 1) & ~(alignment - 1);
+    if (start < offset_ || start > buffer_.size() || bytes > buffer_.size() - start) {
+        ++failed_allocations_;
+        return nullptr;
+    }
+    offset_ = start + bytes;
+    high_water_ = std::max(high_water_, offset_);
+    return static_cast<char*>(buffer_.data()) + start;
+}
+
+} // namespace hft::data
@@ -0,0 +1,478 @@
+/*
+ * ===================================================================
+ *                    MULTICAST MARKET DATA FEED
+ * ===================================================================
+ */
+
+#include "../include/multicast_feed.h"
+#include "../include/cpu_topology.h"
+#include "../include/latency_tracker.h"
+#include <arpa/inet.h>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hft::data {
+
+namespace {
+
+// Messages inside a datagram are not aligned
+template<typename T>
+inline T load(const uint8_t* data) {
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+bool parse_endpoint(const std::string& endpoint, in_addr& address, uint16_t& port) {
+    const size_t colon = endpoint.rfind(':');
+    if (colon == std::string::npos || colon == 0) {
+        return false;
+    }
+    const std::string host = endpoint.substr(0, colon);
+    char* end = nullptr;
+    const unsigned long value = std::strtoul(endpoint.c_str() + colon + 1, &end, 10);
+    if (end == endpoint.c_str() + colon + 1 || *end != '\0' || value > 65535) {
+        return false;
+    }
+    port = static_cast<uint16_t>(value);
+    return inet_pton(AF_INET, host.c_str(), &address) == 1;
+}
+
+} // namespace
+
+// ---- UdpMulticastSource ----
+
+UdpMulticastSource::UdpMulticastSource(const std::string& endpoint, const std::string& interface_address,
+                                       size_t socket_buffer_bytes)
+    : endpoint_(endpoint),
+      interface_address_(interface_address),
+      socket_buffer_bytes_(socket_buffer_bytes) {}
+
+UdpMulticastSource::~UdpMulticastSource() {
+    close();
+}
+
+bool UdpMulticastSource::open() {
+    if (fd_ >= 0) {
+        return true;
+    }
+
+    in_addr group{};
+    uint16_t port = 0;
+    if (!parse_endpoint(endpoint_, group, port)) {
+        return false;
+    }
+    const bool multicast = IN_MULTICAST(ntohl(group.s_addr));
+
+    in_addr interface{};
+    interface.s_addr = htonl(INADDR_ANY);
+    if (!interface_address_.empty() && inet_pton(AF_INET, interface_address_.c_str(), &interface) != 1) {
+        return false;
+    }
+
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+
+    const int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    if (socket_buffer_bytes_ > 0) {
+        // Best effort: the kernel caps it at net.core.rmem_max
+        const int bytes = static_cast<int>(socket_buffer_bytes_);
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes));
+    }
+
+    // Binding the group address keeps other groups on the same port out
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr = group;
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&local), sizeof(local)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    if (multicast) {
+        ip_mreq membership{};
+        membership.imr_multiaddr = group;
+        membership.imr_interface = interface;
+        if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+            ::close(fd);
+            return false;
+        }
+    }
+
+    socklen_t length = sizeof(local);
+    getsockname(fd, reinterpret_cast<sockaddr*>(&local), &length);
+    bound_port_ = ntohs(local.sin_port);
+
+    if (!buffers_) {
+        buffers_.reset(new uint8_t[BATCH * MAX_DATAGRAM]);
+        messages_.reset(new mmsghdr[BATCH]());
+        iovecs_.reset(new iovec[BATCH]());
+        for (size_t i = 0; i < BATCH; ++i) {
+            iovecs_[i].iov_base = buffers_.get() + i * MAX_DATAGRAM;
+            iovecs_[i].iov_len = MAX_DATAGRAM;
+            messages_[i].msg_hdr.msg_iov = &iovecs_[i];
+            messages_[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    fd_ = fd;
+    return true;
+}
+
+void UdpMulticastSource::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);   // Also leaves the group
+        fd_ = -1;
+    }
+}
+
+size_t UdpMulticastSource::receive(Datagram* out, size_t max) {
+    if (fd_ < 0) {
+        return 0;
+    }
+    const unsigned int batch = static_cast<unsigned int>(max < BATCH ? max : BATCH);
+    const int n = recvmmsg(fd_, messages_.get(), batch, MSG_DONTWAIT, nullptr);
+    if (n <= 0) {
+        return 0;
+    }
+
+    const Timestamp received = Timestamp::now();   // One clock read per batch
+    for (int i = 0; i < n; ++i) {
+        out[i].data = buffers_.get() + static_cast<size_t>(i) * MAX_DATAGRAM;
+        out[i].length = messages_[i].msg_len;
+        out[i].received = received;
+    }
+    return static_cast<size_t>(n);
+}
+
+// ---- SequenceArbiter ----
+
+SequenceArbiter::Verdict SequenceArbiter::accept(uint64_t sequence, uint64_t& gap_first, uint64_t& gap_count) {
+    gap_count = 0;
+    if (!started_) {
+        started_ = true;
+        start_ = sequence;
+        next_ = sequence;
+    }
+
+    if (sequence < next_) {
+        if (sequence < start_ || sequence + WINDOW < next_ || test(sequence)) {
+            return Verdict::DUPLICATE;
+        }
+        set(sequence);
+        --outstanding_;
+        ++recovered_;
+        return Verdict::RECOVERED;
+    }
+
+    if (sequence > next_) {
+        open_gap(sequence, gap_first, gap_count);
+    }
+    advance(sequence + 1);
+    set(sequence);
+    --outstanding_;
+    return Verdict::NEW;
+}
+
+void SequenceArbiter::observe_next(uint64_t next_sequence, uint64_t& gap_first, uint64_t& gap_count) {
+    gap_count = 0;
+    if (!started_) {
+        started_ = true;
+        start_ = next_sequence;
+        next_ = next_sequence;
+        return;
+    }
+    if (next_sequence > next_) {
+        open_gap(next_sequence, gap_first, gap_count);
+        advance(next_sequence);
+    }
+}
+
+void SequenceArbiter::open_gap(uint64_t to, uint64_t& gap_first, uint64_t& gap_count) {
+    gap_first = next_;
+    gap_count = to - next_;
+    ++gaps_;
+}
+
+// Every sequence entering the window starts out missing; the slot it
+// reuses belonged to sequence - WINDOW, which is lost if never seen
+void SequenceArbiter::advance(uint64_t new_next) {
+    if (new_next - next_ >= WINDOW) {
+        lost_ += outstanding_ + (new_next - WINDOW - next_);
+        bits_.fill(0);
+        outstanding_ = WINDOW;
+        next_ = new_next;
+        return;
+    }
+    for (uint64_t sequence = next_; sequence < new_next; ++sequence) {
+        if (sequence >= start_ + WINDOW && !test(sequence)) {
+            --outstanding_;
+            ++lost_;
+        }
+        clear(sequence);
+        ++outstanding_;
+    }
+    next_ = new_next;
+}
+
+// ---- MulticastFeed ----
+
+MulticastFeed::MulticastFeed(const Config& config)
+    : busy_poll_(config.busy_poll),
+      feed_cpu_(config.feed_cpu),
+      subscribed_(constants::MAX_SYMBOLS, 0),
+      pending_(new Pending[MAX_PENDING]) {
+    lines_[0].reset(new UdpMulticastSource(config.line_a, config.interface_address, config.socket_buffer_bytes));
+    if (!config.line_b.empty()) {
+        lines_[1].reset(new UdpMulticastSource(config.line_b, config.interface_address, config.socket_buffer_bytes));
+    }
+}
+
+MulticastFeed::MulticastFeed(std::unique_ptr<PacketSource> line_a, std::unique_ptr<PacketSource> line_b,
+                             int feed_cpu)
+    : feed_cpu_(feed_cpu),
+      subscribed_(constants::MAX_SYMBOLS, 0),
+      pending_(new Pending[MAX_PENDING]) {
+    lines_[0] = std::move(line_a);
+    lines_[1] = std::move(line_b);
+}
+
+MulticastFeed::~MulticastFeed() {
+    disconnect();
+}
+
+bool MulticastFeed::connect() {
+    bool all_open = true;
+    for (auto& line : lines_) {
+        if (line) {
+            all_open = line->open() && all_open;
+        }
+    }
+    connected_.store(all_open);
+    return all_open;
+}
+
+void MulticastFeed::disconnect() {
+    stop_feed();
+    for (auto& line : lines_) {
+        if (line) {
+            line->close();
+        }
+    }
+    connected_.store(false);
+}
+
+// Subscriptions are read by the feed thread; make them before start_feed
+void MulticastFeed::subscribe_symbol(const std::string& symbol) {
+    if (!engine_) {
+        return;
+    }
+    const uint32_t id = engine_->get_symbol_mapper().get_id(symbol);
+    if (id != 0 && id < subscribed_.size()) {
+        subscribed_[id] = 1;
+    }
+}
+
+void MulticastFeed::unsubscribe_symbol(const std::string& symbol) {
+    if (!engine_) {
+        return;
+    }
+    const uint32_t id = engine_->get_symbol_mapper().find_id(symbol);
+    if (id != 0 && id < subscribed_.size()) {
+        subscribed_[id] = 0;
+    }
+}
+
+void MulticastFeed::start_feed() {
+    if (!connected_.load() && !connect()) {
+        return;
+    }
+    if (running_.exchange(true)) {
+        return;
+    }
+    feed_thread_ = std::thread(&MulticastFeed::feed_loop, this);
+    pinned_.store(pin_thread(feed_thread_, feed_cpu_));
+}
+
+void MulticastFeed::stop_feed() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    if (feed_thread_.joinable()) {
+        feed_thread_.join();
+    }
+    pinned_.store(false);
+}
+
+void MulticastFeed::feed_loop() {
+    LatencyTracker::register_thread();
+    if (engine_) engine_->register_publisher();
+    Datagram batch[RECV_BATCH];
+    while (running_.load(std::memory_order_acquire)) {
+        size_t received = 0;
+        for (size_t line = 0; line < MAX_LINES; ++line) {
+            if (!lines_[line]) continue;
+            const size_t n = lines_[line]->receive(batch, RECV_BATCH);
+            if (n != 0) {
+                process(batch, n, line);
+                received += n;
+            }
+        }
+        if (received == 0) {
+            idle_wait(busy_poll_);
+        }
+    }
+}
+
+uint32_t MulticastFeed::subscribed_id(uint64_t symbol_key) const {
+    const uint32_t id = engine_->get_symbol_mapper().find_id(SymbolKey(symbol_key));
+    return id < subscribed_.size() && subscribed_[id] ? id : 0;
+}
+
+void MulticastFeed::report_gap(uint64_t first, uint64_t count) {
+    if (gap_callback_) {
+        gap_callback_(first, count);
+    }
+}
+
+size_t MulticastFeed::process(const Datagram* datagrams, size_t count, size_t line) {
+    using namespace feed_format;
+    ScopedLatency trace(LatencyStage::FEED_RECEIVE);
+
+    packets_[line].fetch_add(count, std::memory_order_relaxed);
+    size_t published = 0;
+    uint64_t duplicates = 0;
+    uint64_t malformed = 0;
+    uint64_t gap_first = 0;
+    uint64_t gap_count = 0;
+
+    for (size_t d = 0; d < count; ++d) {
+        const uint8_t* data = datagrams[d].data;
+        const size_t length = datagrams[d].length;
+        if (length < sizeof(PacketHeader)) {
+            ++malformed;
+            continue;
+        }
+        const PacketHeader header = load<PacketHeader>(data);
+        if (header.message_count == 0) {
+            arbiter_.observe_next(header.sequence, gap_first, gap_count);
+            if (gap_count != 0) report_gap(gap_first, gap_count);
+            continue;
+        }
+
+        size_t offset = sizeof(PacketHeader);
+        for (uint16_t m = 0; m < header.message_count; ++m) {
+            if (length - offset < sizeof(uint16_t) + sizeof(uint8_t)) {
+                ++malformed;
+                break;
+            }
+            const uint8_t* message = data + offset;
+            const uint16_t message_length = load<uint16_t>(message);
+            const uint8_t type = message[2];
+            const size_t minimum = type == OPTION_QUOTE ? sizeof(OptionQuoteMessage)
+                                 : (type == QUOTE || type == TRADE) ? sizeof(QuoteMessage)
+                                 : sizeof(uint16_t) + sizeof(uint8_t);
+            if (message_length < minimum || message_length > length - offset) {
+                ++malformed;
+                break;
+            }
+            offset += message_length;
+
+            const uint64_t sequence = header.sequence + m;
+            if (arbiter_.accept(sequence, gap_first, gap_count) == SequenceArbiter::Verdict::DUPLICATE) {
+                ++duplicates;
+                continue;
+            }
+            if (gap_count != 0) report_gap(gap_first, gap_count);
+            if (!engine_ || minimum < sizeof(QuoteMessage)) {
+                continue;   // Unknown type: sequenced, not published
+            }
+
+            const uint64_t key = type == OPTION_QUOTE ? load<OptionQuoteMessage>(message).underlying
+                                                      : load<QuoteMessage>(message).symbol;
+            const uint32_t id = subscribed_id(key);
+            if (id == 0) {
+                continue;
+            }
+            pending_[pending_count_++] = Pending{message, sequence, id, type, datagrams[d].received};
+            if (pending_count_ == MAX_PENDING) {
+                published += flush();
+            }
+        }
+    }
+    published += flush();
+
+    duplicates_.fetch_add(duplicates, std::memory_order_relaxed);
+    malformed_.fetch_add(malformed, std::memory_order_relaxed);
+    update_stats();
+    return published;
+}
+
+// Decode every pending message straight into its ring slot
+size_t MulticastFeed::flush() {
+    using namespace feed_format;
+    if (pending_count_ == 0) {
+        return 0;
+    }
+
+    const size_t published = engine_->publish_in_place(pending_count_, [this](DataEvent& event, size_t i) {
+        const Pending& p = pending_[i];
+        event.timestamp = p.received;
+        if (p.type == OPTION_QUOTE) {
+            const OptionQuoteMessage m = load<OptionQuoteMessage>(p.message);
+            event.type = DataEventType::OPTION_TICK;
+            event.option_tick = OptionTick{};
+            OptionTick& tick = event.option_tick;
+            tick.timestamp = Timestamp(m.timestamp);
+            tick.symbol_id = m.contract_id;
+            tick.underlying_id = p.id;
+            tick.strike = Price::from_basis_points(m.strike);
+            tick.bid = Price::from_basis_points(m.bid);
+            tick.ask = Price::from_basis_points(m.ask);
+            tick.last = Price::from_basis_points(m.last);
+            tick.expiration_date = m.expiration_date;
+            tick.days_to_expiry = m.days_to_expiry;
+            tick.option_type = m.option_type;
+            tick.exercise_style = m.exercise_style;
+            tick.volume = m.volume;
+            tick.open_interest = m.open_interest;
+            tick.implied_volatility = m.implied_volatility;
+            event.symbol_id = p.id;
+        } else {
+            const QuoteMessage m = load<QuoteMessage>(p.message);
+            event.type = p.type == TRADE ? DataEventType::TRADE : DataEventType::MARKET_TICK;
+            MarketTick& tick = event.market_tick;
+            tick.timestamp = Timestamp(m.timestamp);
+            tick.bid = Price::from_basis_points(m.bid);
+            tick.ask = Price::from_basis_points(m.ask);
+            tick.last = Price::from_basis_points(m.last);
+            tick.symbol_id = p.id;
+            tick.bid_size = m.bid_size;
+            tick.ask_size = m.ask_size;
+            tick.volume = m.volume;
+            tick.sequence_number = static_cast<uint32_t>(p.sequence);
+            tick.exchange_id = m.exchange_id;
+            event.symbol_id = p.id;
+        }
+    });
+
+    published_.fetch_add(published, std::memory_order_relaxed);
+    pending_count_ = 0;
+    return published;
+}
+
+void MulticastFeed::update_stats() {
+    gaps_.store(arbiter_.gaps(), std::memory_order_relaxed);
+    recovered_.store(arbiter_.recovered(), std::memory_order_relaxed);
+    lost_.store(arbiter_.lost(), std::memory_order_relaxed);
+}
+
+} // namespace hft::data
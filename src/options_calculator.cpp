@@ -0,0 +1,461 @@
+/*
+ * ===================================================================
+ *                  OPTIONS PRICING AND GREEKS
+ * ===================================================================
+ *
+ * Black-Scholes pricing, Greeks and implied volatility for European
+ * options, plus the batch chain pricer used to reprice whole chains on
+ * each underlying tick.
+ *
+ * CONVENTIONS:
+ * - T in years, r and sigma annualized and continuously compounded
+ * - Theta per year, vega and rho per 1.00 change in sigma / r
+ * - Expired or zero-volatility contracts priced at discounted intrinsic
+ *
+ * ===================================================================
+ */
+
+#include "../include/straddle_strategy.h"
+#include "options_kernels.h"
+#include <array>
+#include <cmath>
+
+namespace hft::strategy {
+
+namespace {
+
+constexpr double INV_SQRT_2PI = 0.39894228040143267794;
+constexpr double INV_SQRT_2 = 0.70710678118654752440;
+
+struct D1D2 {
+    double d1;
+    double d2;
+    double vol_t;
+};
+
+inline bool is_degenerate(double S, double K, double T, double sigma) {
+    return !(S > 0.0) || !(K > 0.0) || !(T > 0.0) || !(sigma > 0.0);
+}
+
+inline D1D2 compute_d1_d2(double S, double K, double T, double r, double sigma) {
+    const double vol_t = sigma * std::sqrt(T);
+    const double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / vol_t;
+    return {d1, d1 - vol_t, vol_t};
+}
+
+inline double norm_cdf(double x) {
+    return 0.5 * std::erfc(-x * INV_SQRT_2);
+}
+
+inline double norm_pdf(double x) {
+    return INV_SQRT_2PI * std::exp(-0.5 * x * x);
+}
+
+// Discounted intrinsic value used for degenerate inputs
+inline double intrinsic_value(double S, double K, double T, double r, bool is_call) {
+    const double kd = K * std::exp(-r * std::max(T, 0.0));
+    return is_call ? std::max(S - kd, 0.0) : std::max(kd - S, 0.0);
+}
+
+// Corrado-Miller rational approximation used as the IV starting point
+inline double corrado_miller_guess(double market_price, double S, double K, double T, double r, bool is_call) {
+    constexpr double SQRT_2PI = 2.50662827463100050242;
+    constexpr double INV_PI = 0.31830988618379067154;
+
+    const double kd = K * std::exp(-r * T);
+    const double call_price = is_call ? market_price : market_price + S - kd;
+    const double half_diff = 0.5 * (S - kd);
+    const double excess = call_price - half_diff;
+    const double radicand = excess * excess - (S - kd) * (S - kd) * INV_PI;
+    const double vol_t = SQRT_2PI / (S + kd) * (excess + std::sqrt(std::max(radicand, 0.0)));
+    return vol_t / std::sqrt(T);
+}
+
+} // namespace
+
+// ===================================================================
+//                        SCALAR PRICING
+// ===================================================================
+
+double OptionsCalculator::black_scholes_call(double S, double K, double T, double r, double sigma) {
+    if (is_degenerate(S, K, T, sigma)) {
+        return intrinsic_value(S, K, T, r, true);
+    }
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    return S * norm_cdf(d.d1) - K * std::exp(-r * T) * norm_cdf(d.d2);
+}
+
+double OptionsCalculator::black_scholes_put(double S, double K, double T, double r, double sigma) {
+    if (is_degenerate(S, K, T, sigma)) {
+        return intrinsic_value(S, K, T, r, false);
+    }
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    return K * std::exp(-r * T) * norm_cdf(-d.d2) - S * norm_cdf(-d.d1);
+}
+
+double OptionsCalculator::calculate_delta(double S, double K, double T, double r, double sigma, bool is_call) {
+    if (is_degenerate(S, K, T, sigma)) {
+        const double kd = K * std::exp(-r * std::max(T, 0.0));
+        if (is_call) return S > kd ? 1.0 : 0.0;
+        return S < kd ? -1.0 : 0.0;
+    }
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    return is_call ? norm_cdf(d.d1) : -norm_cdf(-d.d1);
+}
+
+double OptionsCalculator::calculate_gamma(double S, double K, double T, double r, double sigma) {
+    if (is_degenerate(S, K, T, sigma)) return 0.0;
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    return norm_pdf(d.d1) / (S * d.vol_t);
+}
+
+double OptionsCalculator::calculate_theta(double S, double K, double T, double r, double sigma, bool is_call) {
+    if (is_degenerate(S, K, T, sigma)) return 0.0;
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    const double decay = -S * norm_pdf(d.d1) * sigma / (2.0 * std::sqrt(T));
+    const double kd = K * std::exp(-r * T);
+    return is_call ? decay - r * kd * norm_cdf(d.d2)
+                   : decay + r * kd * norm_cdf(-d.d2);
+}
+
+double OptionsCalculator::calculate_vega(double S, double K, double T, double r, double sigma) {
+    if (is_degenerate(S, K, T, sigma)) return 0.0;
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    return S * norm_pdf(d.d1) * std::sqrt(T);
+}
+
+double OptionsCalculator::calculate_rho(double S, double K, double T, double r, double sigma, bool is_call) {
+    if (is_degenerate(S, K, T, sigma)) return 0.0;
+    const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+    const double t_kd = T * K * std::exp(-r * T);
+    return is_call ? t_kd * norm_cdf(d.d2) : -t_kd * norm_cdf(-d.d2);
+}
+
+double OptionsCalculator::calculate_implied_volatility(double market_price, double S, double K,
+                                                       double T, double r, bool is_call) {
+    constexpr int MAX_ITERATIONS = 100;
+    constexpr double TOLERANCE = 1e-8;
+
+    if (is_degenerate(S, K, T, 1.0) || market_price <= intrinsic_value(S, K, T, r, is_call)) {
+        return 0.0;
+    }
+
+    // Newton-Raphson with a bisection safeguard
+    double lo = 1e-4;
+    double hi = 5.0;
+    double sigma = std::clamp(corrado_miller_guess(market_price, S, K, T, r, is_call), 0.01, 3.0);
+    for (int i = 0; i < MAX_ITERATIONS; ++i) {
+        const double price = is_call ? black_scholes_call(S, K, T, r, sigma)
+                                     : black_scholes_put(S, K, T, r, sigma);
+        const double diff = price - market_price;
+        if (std::abs(diff) < TOLERANCE) break;
+
+        if (diff > 0) hi = sigma; else lo = sigma;
+
+        const double vega = calculate_vega(S, K, T, r, sigma);
+        double next = vega > 1e-12 ? sigma - diff / vega : 0.5 * (lo + hi);
+        if (next <= lo || next >= hi) next = 0.5 * (lo + hi);
+        sigma = next;
+    }
+    return sigma;
+}
+
+// ===================================================================
+//                     STRADDLE CALCULATIONS
+// ===================================================================
+
+double OptionsCalculator::straddle_breakeven_upper(double call_strike, double total_premium) {
+    return call_strike + total_premium;
+}
+
+double OptionsCalculator::straddle_breakeven_lower(double put_strike, double total_premium) {
+    return put_strike - total_premium;
+}
+
+// Probability that an ATM straddle finishes outside its breakevens
+// (zero drift lognormal terminal distribution)
+double OptionsCalculator::straddle_max_profit_probability(double S, double K, double T, double sigma) {
+    if (is_degenerate(S, K, T, sigma)) return 0.0;
+
+    const double premium = black_scholes_call(S, K, T, 0.0, sigma) +
+                           black_scholes_put(S, K, T, 0.0, sigma);
+    const double upper = straddle_breakeven_upper(K, premium);
+    const double lower = straddle_breakeven_lower(K, premium);
+    const double vol_t = sigma * std::sqrt(T);
+
+    auto prob_below = [&](double level) {
+        if (level <= 0.0) return 0.0;
+        return norm_cdf((std::log(level / S) + 0.5 * vol_t * vol_t) / vol_t);
+    };
+    return (1.0 - prob_below(upper)) + prob_below(lower);
+}
+
+double OptionsCalculator::cumulative_normal_distribution(double x) {
+    return norm_cdf(x);
+}
+
+double OptionsCalculator::normal_pdf(double x) {
+    return norm_pdf(x);
+}
+
+// ===================================================================
+//                       BATCH CHAIN PRICING
+// ===================================================================
+
+namespace detail {
+
+void price_chain_scalar(const ChainPricingInput& in, const ChainPricingOutput& out,
+                        size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        const double S = in.spot[i];
+        const double K = in.strike[i];
+        const double T = in.time_to_expiry[i];
+        const double r = in.rate[i];
+        const double sigma = in.volatility[i];
+        const bool is_call = in.is_call[i] != 0;
+
+        if (is_degenerate(S, K, T, sigma)) {
+            out.price[i] = intrinsic_value(S, K, T, r, is_call);
+            out.delta[i] = OptionsCalculator::calculate_delta(S, K, T, r, sigma, is_call);
+            out.gamma[i] = 0.0;
+            out.theta[i] = 0.0;
+            out.vega[i] = 0.0;
+            out.rho[i] = 0.0;
+            continue;
+        }
+
+        const D1D2 d = compute_d1_d2(S, K, T, r, sigma);
+        const double sqrt_t = std::sqrt(T);
+        const double kd = K * std::exp(-r * T);
+        const double pdf1 = norm_pdf(d.d1);
+        const double decay = -S * pdf1 * sigma / (2.0 * sqrt_t);
+
+        if (is_call) {
+            const double n1 = norm_cdf(d.d1);
+            const double n2 = norm_cdf(d.d2);
+            out.price[i] = S * n1 - kd * n2;
+            out.delta[i] = n1;
+            out.theta[i] = decay - r * kd * n2;
+            out.rho[i] = T * kd * n2;
+        } else {
+            const double nm1 = norm_cdf(-d.d1);
+            const double nm2 = norm_cdf(-d.d2);
+            out.price[i] = kd * nm2 - S * nm1;
+            out.delta[i] = -nm1;
+            out.theta[i] = decay + r * kd * nm2;
+            out.rho[i] = -T * kd * nm2;
+        }
+        out.gamma[i] = pdf1 / (S * d.vol_t);
+        out.vega[i] = S * pdf1 * sqrt_t;
+    }
+}
+
+} // namespace detail
+
+// ===================================================================
+//                   CHAIN IMPLIED VOLATILITY
+// ===================================================================
+
+namespace {
+
+constexpr size_t IV_BLOCK_SIZE = 256;
+
+// Compacted working set of unconverged contracts within one block
+struct ImpliedVolBlock {
+    std::array<size_t, IV_BLOCK_SIZE> index;
+    std::array<double, IV_BLOCK_SIZE> spot, strike, expiry, rate, sigma;
+    std::array<double, IV_BLOCK_SIZE> target, lo, hi, sqrt_t, log_forward;
+    std::array<uint8_t, IV_BLOCK_SIZE> is_call;
+    std::array<double, IV_BLOCK_SIZE> price, delta, gamma, theta, vega, rho;
+};
+
+size_t solve_implied_volatility_block(const ChainImpliedVolInput& in, double* iv,
+                                      const ImpliedVolSolverConfig& config,
+                                      size_t base, size_t n) {
+    ImpliedVolBlock b;
+    size_t active = 0;
+    size_t converged = 0;
+
+    for (size_t i = base; i < base + n; ++i) {
+        const double S = in.spot[i];
+        const double K = in.strike[i];
+        const double T = in.time_to_expiry[i];
+        const double r = in.rate[i];
+        const double target = in.market_price[i];
+        const bool is_call = in.is_call[i] != 0;
+
+        iv[i] = 0.0;
+        if (is_degenerate(S, K, T, 1.0)) continue;
+
+        // No-arbitrage bounds: no volatility reproduces prices outside them
+        const double kd = K * std::exp(-r * T);
+        const double lower = is_call ? std::max(S - kd, 0.0) : std::max(kd - S, 0.0);
+        const double upper = is_call ? S : kd;
+        if (!(target > lower) || !(target < upper)) continue;
+
+        double guess = in.initial_guess ? in.initial_guess[i] : 0.0;
+        if (!(guess >= config.min_volatility && guess <= config.max_volatility)) {
+            guess = corrado_miller_guess(target, S, K, T, r, is_call);
+        }
+
+        b.index[active] = i;
+        b.spot[active] = S;
+        b.strike[active] = K;
+        b.expiry[active] = T;
+        b.rate[active] = r;
+        b.is_call[active] = is_call ? 1 : 0;
+        b.target[active] = target;
+        b.lo[active] = config.min_volatility;
+        b.hi[active] = config.max_volatility;
+        b.sigma[active] = std::clamp(guess, 2.0 * config.min_volatility, 0.5 * config.max_volatility);
+        b.sqrt_t[active] = std::sqrt(T);
+        b.log_forward[active] = std::log(S / K) + r * T;
+        ++active;
+    }
+
+    for (int iteration = 0; iteration < config.max_iterations && active > 0; ++iteration) {
+        const ChainPricingInput pricing_in{b.spot.data(), b.strike.data(), b.expiry.data(),
+                                           b.rate.data(), b.sigma.data(), b.is_call.data(), active};
+        const ChainPricingOutput pricing_out{b.price.data(), b.delta.data(), b.gamma.data(),
+                                             b.theta.data(), b.vega.data(), b.rho.data()};
+        OptionsCalculator::price_chain(pricing_in, pricing_out);
+
+        size_t still_active = 0;
+        for (size_t j = 0; j < active; ++j) {
+            const double sigma = b.sigma[j];
+            const double diff = b.price[j] - b.target[j];
+            if (std::abs(diff) < config.price_tolerance) {
+                iv[b.index[j]] = sigma;
+                ++converged;
+                continue;
+            }
+
+            double lo = diff > 0 ? b.lo[j] : sigma;
+            double hi = diff > 0 ? sigma : b.hi[j];
+
+            // Halley step: vomma / vega = d1 * d2 / sigma
+            double next = 0.5 * (lo + hi);
+            const double vega = b.vega[j];
+            if (vega > 1e-12) {
+                const double vol_t = sigma * b.sqrt_t[j];
+                const double d1 = b.log_forward[j] / vol_t + 0.5 * vol_t;
+                const double d2 = d1 - vol_t;
+                const double newton = diff / vega;
+                const double correction = 1.0 - 0.5 * newton * d1 * d2 / sigma;
+                const double step = correction > 0.5 ? newton / correction : newton;
+                const double candidate = sigma - step;
+                if (candidate > lo && candidate < hi) next = candidate;
+            }
+
+            // Compact in place so the next pricing pass only sees open contracts
+            const size_t k = still_active++;
+            b.index[k] = b.index[j];
+            b.spot[k] = b.spot[j];
+            b.strike[k] = b.strike[j];
+            b.expiry[k] = b.expiry[j];
+            b.rate[k] = b.rate[j];
+            b.is_call[k] = b.is_call[j];
+            b.target[k] = b.target[j];
+            b.sqrt_t[k] = b.sqrt_t[j];
+            b.log_forward[k] = b.log_forward[j];
+            b.lo[k] = lo;
+            b.hi[k] = hi;
+            b.sigma[k] = next;
+        }
+        active = still_active;
+    }
+
+    // Iteration budget exhausted: report the best estimate without counting it
+    for (size_t j = 0; j < active; ++j) {
+        iv[b.index[j]] = b.sigma[j];
+    }
+    return converged;
+}
+
+} // namespace
+
+size_t OptionsCalculator::solve_implied_volatility_chain(const ChainImpliedVolInput& input, double* implied_vol,
+                                                         const ImpliedVolSolverConfig& config) {
+    size_t converged = 0;
+    for (size_t base = 0; base < input.count; base += IV_BLOCK_SIZE) {
+        const size_t n = std::min(IV_BLOCK_SIZE, input.count - base);
+        converged += solve_implied_volatility_block(input, implied_vol, config, base, n);
+    }
+    return converged;
+}
+
+size_t OptionsCalculator::update_chain_implied_volatility(std::vector<data::OptionTick>& chain,
+                                                          const data::Price& underlying_price,
+                                                          double risk_free_rate,
+                                                          const ImpliedVolSolverConfig& config) {
+    std::array<double, IV_BLOCK_SIZE> market, spot, strike, expiry, rate, warm, result;
+    std::array<uint8_t, IV_BLOCK_SIZE> is_call;
+    spot.fill(underlying_price.to_double());
+    rate.fill(risk_free_rate);
+
+    size_t converged = 0;
+    for (size_t base = 0; base < chain.size(); base += IV_BLOCK_SIZE) {
+        const size_t n = std::min(IV_BLOCK_SIZE, chain.size() - base);
+        for (size_t j = 0; j < n; ++j) {
+            const data::OptionTick& tick = chain[base + j];
+            const bool has_quote = tick.bid.value > 0 && tick.ask.value > 0;
+            market[j] = has_quote ? 0.5 * (tick.bid.to_double() + tick.ask.to_double())
+                                  : tick.last.to_double();
+            strike[j] = tick.strike.to_double();
+            expiry[j] = tick.time_to_expiry();
+            is_call[j] = tick.option_type == 0 ? 1 : 0;
+            warm[j] = tick.implied_volatility;
+        }
+
+        const ChainImpliedVolInput input{market.data(), spot.data(), strike.data(), expiry.data(),
+                                         rate.data(), is_call.data(), warm.data(), n};
+        converged += solve_implied_volatility_chain(input, result.data(), config);
+
+        for (size_t j = 0; j < n; ++j) {
+            chain[base + j].implied_volatility = result[j];
+        }
+    }
+    return converged;
+}
+
+SimdLevel OptionsCalculator::detect_simd_level() {
+#if defined(HFT_SIMD_KERNELS) && (defined(__GNUC__) || defined(__clang__))
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::AVX2;
+        return SimdLevel::SCALAR;
+    }();
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+void OptionsCalculator::price_chain(const ChainPricingInput& input, const ChainPricingOutput& output) {
+    price_chain(input, output, detect_simd_level());
+}
+
+void OptionsCalculator::price_chain(const ChainPricingInput& input, const ChainPricingOutput& output,
+                                    SimdLevel level) {
+    // Never run a kernel the CPU cannot execute
+    if (level > detect_simd_level()) {
+        level = detect_simd_level();
+    }
+
+    switch (level) {
+#ifdef HFT_SIMD_KERNELS
+        case SimdLevel::AVX512:
+            detail::price_chain_avx512(input, output);
+            return;
+        case SimdLevel::AVX2:
+            detail::price_chain_avx2(input, output);
+            return;
+#endif
+        default:
+            detail::price_chain_scalar(input, output, 0, input.count);
+            return;
+    }
+}
+
+} // namespace hft::strategy
@@ -0,0 +1,126 @@
+/*
+ * ===================================================================
+ *                      INDEXED OPTIONS CHAIN
+ * ===================================================================
+ */
+
+#include "../include/options_chain.h"
+#include "../include/expiry_slots.h"
+#include <algorithm>
+
+namespace hft::data {
+
+OptionsChain::OptionsChain(uint32_t underlying_id) : underlying_id_(underlying_id) {
+    expiries_.reserve(MAX_EXPIRIES);
+}
+
+size_t OptionsChain::lower_bound(const int64_t* strikes, size_t n, int64_t key) {
+    if (n == 0) {
+        return 0;
+    }
+    const int64_t* base = strikes;
+    while (n > 1) {
+        const size_t half = n / 2;
+        base = base[half] < key ? base + half : base;   // cmov
+        n -= half;
+    }
+    return static_cast<size_t>(base - strikes) + (*base < key);
+}
+
+bool OptionsChain::update(const OptionTick& tick) {
+    if (tick.underlying_id != underlying_id_ || tick.option_type > PUT) {
+        return false;
+    }
+    Expiry* expiry = expiry_slot(expiries_, tick.expiration_date, MAX_EXPIRIES, [this](const Expiry& dropped) {
+        contracts_ -= std::count(dropped.quoted.begin(), dropped.quoted.end(), uint8_t(1));
+    });
+    if (!expiry) {
+        return false;
+    }
+    expiry->days_to_expiry = tick.days_to_expiry;
+
+    size_t i = lower_bound(expiry->strikes.data(), expiry->strikes.size(), tick.strike.value);
+    if (i == expiry->strikes.size() || expiry->strikes[i] != tick.strike.value) {
+        expiry->strikes.insert(expiry->strikes.begin() + i, tick.strike.value);
+        expiry->quotes.insert(expiry->quotes.begin() + 2 * i, 2, OptionTick{});
+        expiry->quoted.insert(expiry->quoted.begin() + 2 * i, 2, 0);
+    }
+    const size_t slot = 2 * i + tick.option_type;
+    contracts_ += expiry->quoted[slot] == 0;
+    expiry->quoted[slot] = 1;
+    expiry->quotes[slot] = tick;
+    ++revision_;
+    return true;
+}
+
+size_t OptionsChain::find_expiry(uint32_t expiration_date) const {
+    auto it = std::lower_bound(expiries_.begin(), expiries_.end(), expiration_date,
+                               [](const Expiry& e, uint32_t date) { return e.expiration_date < date; });
+    return it != expiries_.end() && it->expiration_date == expiration_date
+        ? static_cast<size_t>(it - expiries_.begin())
+        : NONE;
+}
+
+size_t OptionsChain::nearest_expiry(double min_days, double max_days) const {
+    size_t best = NONE;
+    for (size_t i = 0; i < expiries_.size(); ++i) {
+        const uint16_t days = expiries_[i].days_to_expiry;
+        if (days >= min_days && days <= max_days &&
+            (best == NONE || days < expiries_[best].days_to_expiry)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+size_t OptionsChain::find_strike(size_t expiry, Price strike) const {
+    const Expiry& e = expiries_[expiry];
+    const size_t i = lower_bound(e.strikes.data(), e.strikes.size(), strike.value);
+    return i < e.strikes.size() && e.strikes[i] == strike.value ? i : NONE;
+}
+
+size_t OptionsChain::nearest_strike(size_t expiry, Price price) const {
+    const Expiry& e = expiries_[expiry];
+    const size_t n = e.strikes.size();
+    if (n == 0) {
+        return NONE;
+    }
+    const size_t i = lower_bound(e.strikes.data(), n, price.value);
+    if (i == 0) return 0;
+    if (i == n) return n - 1;
+    return price.value - e.strikes[i - 1] <= e.strikes[i] - price.value ? i - 1 : i;
+}
+
+const OptionTick* OptionsChain::quote(size_t expiry, size_t strike_index, uint8_t option_type) const {
+    const Expiry& e = expiries_[expiry];
+    const size_t slot = 2 * strike_index + option_type;
+    return e.quoted[slot] ? &e.quotes[slot] : nullptr;
+}
+
+const OptionTick* OptionsChain::find(uint32_t expiration_date, Price strike, uint8_t option_type) const {
+    const size_t expiry = find_expiry(expiration_date);
+    if (expiry == NONE || option_type > PUT) {
+        return nullptr;
+    }
+    const size_t i = find_strike(expiry, strike);
+    return i == NONE ? nullptr : quote(expiry, i, option_type);
+}
+
+const OptionTick* OptionsChain::call_at_or_above(size_t expiry, Price floor) const {
+    const Expiry& e = expiries_[expiry];
+    for (size_t i = lower_bound(e.strikes.data(), e.strikes.size(), floor.value); i < e.strikes.size(); ++i) {
+        if (e.quoted[2 * i + CALL]) return &e.quotes[2 * i + CALL];
+    }
+    return nullptr;
+}
+
+const OptionTick* OptionsChain::put_at_or_below(size_t expiry, Price ceiling) const {
+    const Expiry& e = expiries_[expiry];
+    // First strike above the ceiling, then walk down
+    for (size_t i = lower_bound(e.strikes.data(), e.strikes.size(), ceiling.value + 1); i-- > 0;) {
+        if (e.quoted[2 * i + PUT]) return &e.quotes[2 * i + PUT];
+    }
+    return nullptr;
+}
+
+} // namespace hft::data
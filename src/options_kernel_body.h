@@ -0,0 +1,222 @@
+/*
+ * ===================================================================
+ *              VECTORIZED BLACK-SCHOLES KERNEL BODY
+ * ===================================================================
+ *
+ * Width-agnostic kernel shared by the AVX2 and AVX-512 translation
+ * units. Each unit defines an ops struct `V` exposing its register
+ * type and primitive operations, then instantiates price_chain_simd<V>.
+ *
+ * Everything here sits in an anonymous namespace so every translation
+ * unit gets its own copy compiled for its own instruction set.
+ *
+ * TRANSCENDENTALS PER CONTRACT:
+ * - 1 log  (ln S/K)
+ * - 3 exp  (discount factor, exp(-d1^2/2), exp(-d2^2/2))
+ * - 1 sqrt
+ * The normal CDF reuses the exp(-x^2/2) term already needed for the pdf
+ * (Hart 5666 rational approximation, ~1e-14 absolute error).
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "options_kernels.h"
+
+namespace hft::strategy::detail {
+namespace {
+
+constexpr double LOG2E = 1.4426950408889634074;
+constexpr double LN2_HI = 6.93145751953125e-1;
+constexpr double LN2_LO = 1.42860682030941723212e-6;
+constexpr double SQRT2 = 1.41421356237309504880;
+constexpr double INV_SQRT_2PI = 0.39894228040143267794;
+constexpr double SQRT_2PI = 2.50662827463100050242;
+
+// exp(x) with Cody-Waite range reduction and a degree-12 polynomial
+template<typename V>
+inline typename V::reg vexp(typename V::reg x) {
+    using R = typename V::reg;
+    const R lo = V::set1(-708.0);
+    const R xc = V::min(V::max(x, lo), V::set1(709.0));
+
+    const R n = V::round(V::mul(xc, V::set1(LOG2E)));
+    R r = V::fnmadd(n, V::set1(LN2_HI), xc);
+    r = V::fnmadd(n, V::set1(LN2_LO), r);
+
+    R p = V::set1(1.0 / 479001600.0);
+    p = V::fmadd(p, r, V::set1(1.0 / 39916800.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 3628800.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 362880.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 40320.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 5040.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 720.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 120.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 24.0));
+    p = V::fmadd(p, r, V::set1(1.0 / 6.0));
+    p = V::fmadd(p, r, V::set1(0.5));
+    p = V::fmadd(p, r, V::set1(1.0));
+    p = V::fmadd(p, r, V::set1(1.0));
+
+    const R result = V::mul(p, V::pow2i(n));
+    return V::select(V::cmp_lt(x, lo), V::set1(0.0), result);
+}
+
+// ln(x) for positive normal x via the atanh series on [sqrt(1/2), sqrt(2))
+template<typename V>
+inline typename V::reg vlog(typename V::reg x) {
+    using R = typename V::reg;
+    R e;
+    R m = V::split_exponent(x, e);  // x = m * 2^e, m in [1, 2)
+
+    const auto big = V::cmp_gt(m, V::set1(SQRT2));
+    m = V::select(big, V::mul(m, V::set1(0.5)), m);
+    e = V::select(big, V::add(e, V::set1(1.0)), e);
+
+    const R f = V::sub(m, V::set1(1.0));
+    const R s = V::div(f, V::add(f, V::set1(2.0)));
+    const R s2 = V::mul(s, s);
+
+    R p = V::set1(1.0 / 21.0);
+    p = V::fmadd(p, s2, V::set1(1.0 / 19.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 17.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 15.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 13.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 11.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 9.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 7.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 5.0));
+    p = V::fmadd(p, s2, V::set1(1.0 / 3.0));
+    p = V::fmadd(p, s2, V::set1(1.0));
+
+    const R series = V::mul(V::add(s, s), p);
+    return V::fmadd(e, V::set1(LN2_HI), V::fmadd(e, V::set1(LN2_LO), series));
+}
+
+// N(x) and N(-x) given the precomputed gaussian term exp(-x^2/2)
+template<typename V>
+inline void vnormal_cdf(typename V::reg x, typename V::reg gauss,
+                        typename V::reg& cdf, typename V::reg& cdf_neg) {
+    using R = typename V::reg;
+    const R ax = V::abs(x);
+
+    R num = V::set1(3.52624965998911e-02);
+    num = V::fmadd(num, ax, V::set1(0.700383064443688));
+    num = V::fmadd(num, ax, V::set1(6.37396220353165));
+    num = V::fmadd(num, ax, V::set1(33.912866078383));
+    num = V::fmadd(num, ax, V::set1(112.079291497871));
+    num = V::fmadd(num, ax, V::set1(221.213596169931));
+    num = V::fmadd(num, ax, V::set1(220.206867912376));
+
+    R den = V::set1(8.83883476483184e-02);
+    den = V::fmadd(den, ax, V::set1(1.75566716318264));
+    den = V::fmadd(den, ax, V::set1(16.064177579207));
+    den = V::fmadd(den, ax, V::set1(86.7807322029461));
+    den = V::fmadd(den, ax, V::set1(296.564248779674));
+    den = V::fmadd(den, ax, V::set1(637.333633378831));
+    den = V::fmadd(den, ax, V::set1(793.826512519948));
+    den = V::fmadd(den, ax, V::set1(440.413735824752));
+
+    const R central = V::div(V::mul(gauss, num), den);
+
+    // Continued fraction for the far tail
+    R cf = V::add(ax, V::set1(0.65));
+    cf = V::add(ax, V::div(V::set1(4.0), cf));
+    cf = V::add(ax, V::div(V::set1(3.0), cf));
+    cf = V::add(ax, V::div(V::set1(2.0), cf));
+    cf = V::add(ax, V::div(V::set1(1.0), cf));
+    const R tail = V::div(gauss, V::mul(cf, V::set1(SQRT_2PI)));
+
+    R lower = V::select(V::cmp_lt(ax, V::set1(7.07106781186547)), central, tail);
+    lower = V::select(V::cmp_gt(ax, V::set1(37.0)), V::set1(0.0), lower);
+    const R upper = V::sub(V::set1(1.0), lower);
+
+    const auto positive = V::cmp_gt(x, V::set1(0.0));
+    cdf = V::select(positive, upper, lower);
+    cdf_neg = V::select(positive, lower, upper);
+}
+
+// Price one register-width block starting at index i
+template<typename V>
+inline void price_block(const ChainPricingInput& in, const ChainPricingOutput& out, size_t i) {
+    using R = typename V::reg;
+    const R zero = V::set1(0.0);
+    const R one = V::set1(1.0);
+
+    R S = V::load(in.spot + i);
+    R K = V::load(in.strike + i);
+    R T = V::load(in.time_to_expiry + i);
+    R sigma = V::load(in.volatility + i);
+    const R r = V::load(in.rate + i);
+    const auto is_call = V::load_flags(in.is_call + i);
+
+    // Degenerate lanes (not > 0, NaN included, as in the scalar check) are
+    // neutralized here and re-priced by the scalar path
+    const auto bad = V::mask_or(V::mask_or(V::cmp_not_gt(S, zero), V::cmp_not_gt(K, zero)),
+                                V::mask_or(V::cmp_not_gt(T, zero), V::cmp_not_gt(sigma, zero)));
+    const unsigned bad_bits = V::mask_bits(bad);
+    if (bad_bits) {
+        S = V::select(bad, one, S);
+        K = V::select(bad, one, K);
+        T = V::select(bad, one, T);
+        sigma = V::select(bad, one, sigma);
+    }
+
+    const R sqrt_t = V::sqrt(T);
+    const R vol_t = V::mul(sigma, sqrt_t);
+    const R disc = vexp<V>(V::mul(V::sub(zero, r), T));
+    const R kd = V::mul(K, disc);
+
+    const R drift = V::fmadd(V::mul(V::set1(0.5), sigma), sigma, r);
+    const R d1 = V::div(V::fmadd(drift, T, vlog<V>(V::div(S, K))), vol_t);
+    const R d2 = V::sub(d1, vol_t);
+
+    const R half_neg = V::set1(-0.5);
+    const R g1 = vexp<V>(V::mul(V::mul(half_neg, d1), d1));
+    const R g2 = vexp<V>(V::mul(V::mul(half_neg, d2), d2));
+
+    R n1, nm1, n2, nm2;
+    vnormal_cdf<V>(d1, g1, n1, nm1);
+    vnormal_cdf<V>(d2, g2, n2, nm2);
+
+    const R pdf1 = V::mul(g1, V::set1(INV_SQRT_2PI));
+    const R s_pdf = V::mul(S, pdf1);
+    const R decay = V::div(V::mul(s_pdf, sigma), V::mul(V::set1(-2.0), sqrt_t));
+    const R r_kd = V::mul(r, kd);
+    const R t_kd = V::mul(T, kd);
+
+    const R call_price = V::fnmadd(kd, n2, V::mul(S, n1));
+    const R put_price = V::fnmadd(S, nm1, V::mul(kd, nm2));
+    const R call_theta = V::fnmadd(r_kd, n2, decay);
+    const R put_theta = V::fmadd(r_kd, nm2, decay);
+    const R call_rho = V::mul(t_kd, n2);
+    const R put_rho = V::sub(zero, V::mul(t_kd, nm2));
+
+    V::store(out.price + i, V::select(is_call, call_price, put_price));
+    V::store(out.delta + i, V::select(is_call, n1, V::sub(zero, nm1)));
+    V::store(out.gamma + i, V::div(pdf1, V::mul(S, vol_t)));
+    V::store(out.theta + i, V::select(is_call, call_theta, put_theta));
+    V::store(out.vega + i, V::mul(s_pdf, sqrt_t));
+    V::store(out.rho + i, V::select(is_call, call_rho, put_rho));
+
+    if (bad_bits) {
+        for (size_t lane = 0; lane < V::width; ++lane) {
+            if (bad_bits & (1u << lane)) {
+                price_chain_scalar(in, out, i + lane, i + lane + 1);
+            }
+        }
+    }
+}
+
+template<typename V>
+inline void price_chain_simd(const ChainPricingInput& in, const ChainPricingOutput& out) {
+    const size_t vector_end = in.count - (in.count % V::width);
+    for (size_t i = 0; i < vector_end; i += V::width) {
+        price_block<V>(in, out, i);
+    }
+    price_chain_scalar(in, out, vector_end, in.count);
+}
+
+} // namespace
+} // namespace hft::strategy::detail
@@ -0,0 +1,35 @@
+/*
+ * ===================================================================
+ *                  BATCH OPTIONS PRICING KERNELS
+ * ===================================================================
+ *
+ * Internal interface between OptionsCalculator::price_chain and the
+ * per-instruction-set kernels. Each kernel lives in its own translation
+ * unit compiled with the matching -m flags so the rest of the binary
+ * stays runnable on CPUs without AVX2/AVX-512. Those units see only
+ * this header and chain_pricing.h (plain structs): an inline function
+ * from a wider header compiled there could be the copy the linker keeps
+ * for every caller.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "../include/chain_pricing.h"
+
+namespace hft::strategy::detail {
+
+// Reference path: one contract at a time, shared d1/d2 and pdf
+void price_chain_scalar(const ChainPricingInput& input, const ChainPricingOutput& output,
+                        size_t begin, size_t end);
+
+#ifdef HFT_SIMD_KERNELS
+// 4-wide double kernel (requires AVX2 + FMA)
+void price_chain_avx2(const ChainPricingInput& input, const ChainPricingOutput& output);
+
+// 8-wide double kernel (requires AVX-512F)
+void price_chain_avx512(const ChainPricingInput& input, const ChainPricingOutput& output);
+#endif
+
+} // namespace hft::strategy::detail
@@ -0,0 +1,78 @@
+/*
+ * ===================================================================
+ *                  AVX2 BATCH OPTIONS PRICING KERNEL
+ * ===================================================================
+ *
+ * Compiled with -mavx2 -mfma. Only reached through the runtime
+ * dispatch in OptionsCalculator::price_chain.
+ *
+ * ===================================================================
+ */
+
+#include "options_kernel_body.h"
+#include <immintrin.h>
+#include <cstring>
+
+namespace hft::strategy::detail {
+namespace {
+
+struct Avx2Ops {
+    using reg = __m256d;
+    using mask = __m256d;
+    static constexpr size_t width = 4;
+
+    static reg set1(double v) { return _mm256_set1_pd(v); }
+    static reg load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm256_storeu_pd(p, v); }
+
+    static reg add(reg a, reg b) { return _mm256_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm256_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm256_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm256_div_pd(a, b); }
+    static reg fmadd(reg a, reg b, reg c) { return _mm256_fmadd_pd(a, b, c); }
+    static reg fnmadd(reg a, reg b, reg c) { return _mm256_fnmadd_pd(a, b, c); }
+    static reg sqrt(reg a) { return _mm256_sqrt_pd(a); }
+    static reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+    static reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+    static reg abs(reg a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static reg round(reg a) { return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    static mask cmp_lt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static mask cmp_gt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static mask cmp_not_gt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_NGT_UQ); }   // True on NaN
+    static mask mask_or(mask a, mask b) { return _mm256_or_pd(a, b); }
+    static unsigned mask_bits(mask m) { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+    static reg select(mask m, reg if_true, reg if_false) { return _mm256_blendv_pd(if_false, if_true, m); }
+
+    // 2^n for integral n in [-1022, 1023]
+    static reg pow2i(reg n) {
+        __m256i e = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n));
+        e = _mm256_add_epi64(e, _mm256_set1_epi64x(1023));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(e, 52));
+    }
+
+    // x = m * 2^e with m in [1, 2); x must be positive and normal
+    static reg split_exponent(reg x, reg& e) {
+        const __m256i bits = _mm256_castpd_si256(x);
+        const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL);  // 2^52
+        const __m256i biased = _mm256_or_si256(_mm256_srli_epi64(bits, 52), magic);
+        e = _mm256_sub_pd(_mm256_castsi256_pd(biased), _mm256_set1_pd(4503599627370496.0 + 1023.0));
+        const __m256i mant = _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+        return _mm256_castsi256_pd(_mm256_or_si256(mant, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+    }
+
+    static mask load_flags(const uint8_t* p) {
+        int32_t packed;
+        std::memcpy(&packed, p, sizeof(packed));
+        const __m256i wide = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed));
+        return _mm256_castsi256_pd(_mm256_cmpgt_epi64(wide, _mm256_setzero_si256()));
+    }
+};
+
+} // namespace
+
+void price_chain_avx2(const ChainPricingInput& input, const ChainPricingOutput& output) {
+    price_chain_simd<Avx2Ops>(input, output);
+}
+
+} // namespace hft::strategy::detail
@@ -0,0 +1,80 @@
+/*
+ * ===================================================================
+ *                 AVX-512 BATCH OPTIONS PRICING KERNEL
+ * ===================================================================
+ *
+ * Compiled with -mavx512f -mfma. Only reached through the runtime
+ * dispatch in OptionsCalculator::price_chain.
+ *
+ * ===================================================================
+ */
+
+#include "options_kernel_body.h"
+#include <immintrin.h>
+#include <cstring>
+
+namespace hft::strategy::detail {
+namespace {
+
+struct Avx512Ops {
+    using reg = __m512d;
+    using mask = __mmask8;
+    static constexpr size_t width = 8;
+
+    // GCC's unmasked forms of these intrinsics merge into a self-initialised
+    // _mm512_undefined_*() vector, which LTO reports as -Wmaybe-uninitialized
+    // once the kernel is inlined into price_chain. The zero-masked forms with
+    // every lane enabled emit the same instructions without the placeholder.
+    static constexpr __mmask8 all = 0xFF;
+
+    static reg set1(double v) { return _mm512_set1_pd(v); }
+    static reg load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, reg v) { _mm512_storeu_pd(p, v); }
+
+    static reg add(reg a, reg b) { return _mm512_add_pd(a, b); }
+    static reg sub(reg a, reg b) { return _mm512_sub_pd(a, b); }
+    static reg mul(reg a, reg b) { return _mm512_mul_pd(a, b); }
+    static reg div(reg a, reg b) { return _mm512_div_pd(a, b); }
+    static reg fmadd(reg a, reg b, reg c) { return _mm512_fmadd_pd(a, b, c); }
+    static reg fnmadd(reg a, reg b, reg c) { return _mm512_fnmadd_pd(a, b, c); }
+    static reg sqrt(reg a) { return _mm512_maskz_sqrt_pd(all, a); }
+    static reg min(reg a, reg b) { return _mm512_maskz_min_pd(all, a, b); }
+    static reg max(reg a, reg b) { return _mm512_maskz_max_pd(all, a, b); }
+    static reg abs(reg a) { return _mm512_abs_pd(a); }
+    static reg round(reg a) { return _mm512_maskz_roundscale_pd(all, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+    static mask cmp_lt(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static mask cmp_gt(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static mask cmp_not_gt(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_NGT_UQ); }   // True on NaN
+    static mask mask_or(mask a, mask b) { return static_cast<mask>(a | b); }
+    static unsigned mask_bits(mask m) { return static_cast<unsigned>(m); }
+    static reg select(mask m, reg if_true, reg if_false) { return _mm512_mask_blend_pd(m, if_false, if_true); }
+
+    // 2^n for integral n in [-1022, 1023]
+    static reg pow2i(reg n) {
+        __m512i e = _mm512_maskz_cvtepi32_epi64(all, _mm512_maskz_cvtpd_epi32(all, n));
+        e = _mm512_add_epi64(e, _mm512_set1_epi64(1023));
+        return _mm512_castsi512_pd(_mm512_maskz_slli_epi64(all, e, 52));
+    }
+
+    // x = m * 2^e with m in [1, 2); x must be positive and normal
+    static reg split_exponent(reg x, reg& e) {
+        e = _mm512_maskz_getexp_pd(all, x);
+        return _mm512_maskz_getmant_pd(all, x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero);
+    }
+
+    static mask load_flags(const uint8_t* p) {
+        int64_t packed;
+        std::memcpy(&packed, p, sizeof(packed));
+        const __m512i wide = _mm512_maskz_cvtepu8_epi64(all, _mm_cvtsi64_si128(packed));
+        return _mm512_test_epi64_mask(wide, wide);
+    }
+};
+
+} // namespace
+
+void price_chain_avx512(const ChainPricingInput& input, const ChainPricingOutput& output) {
+    price_chain_simd<Avx512Ops>(input, output);
+}
+
+} // namespace hft::strategy::detail
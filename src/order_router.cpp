@@ -0,0 +1,268 @@
+/*
+ * ===================================================================
+ *                      LOW-LATENCY ORDER ROUTER
+ * ===================================================================
+ */
+
+#include "../include/order_router.h"
+#include "../include/cpu_topology.h"
+#include "../include/latency_tracker.h"
+#include <algorithm>
+#include <cstring>
+
+namespace hft::execution {
+
+namespace {
+
+template<typename T>
+inline void store_be(uint8_t* out, T value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * (sizeof(T) - 1 - i)));
+    }
+}
+
+template<typename T>
+inline T load_be(const uint8_t* in) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value = (value << 8) | in[i];
+    }
+    return static_cast<T>(value);
+}
+
+} // namespace
+
+bool wire::decode_enter_order(const uint8_t* data, size_t length, EnterOrder& out) {
+    if (length < ENTER_ORDER_SIZE || data[TYPE_OFFSET] != ENTER_ORDER_TYPE) {
+        return false;
+    }
+    out.side = static_cast<Side>(data[SIDE_OFFSET]);
+    out.time_in_force = data[TIF_OFFSET];
+    out.capacity = data[CAPACITY_OFFSET];
+    out.instrument_id = load_be<uint32_t>(data + INSTRUMENT_OFFSET);
+    out.order_id = load_be<uint64_t>(data + TOKEN_OFFSET);
+    out.pair_id = load_be<uint64_t>(data + PAIR_TOKEN_OFFSET);
+    out.quantity = load_be<uint32_t>(data + QUANTITY_OFFSET);
+    out.firm_id = load_be<uint32_t>(data + FIRM_OFFSET);
+    out.price = data::Price::from_basis_points(load_be<int64_t>(data + PRICE_OFFSET));
+    out.send_time = data::Timestamp(load_be<uint64_t>(data + SEND_TIME_OFFSET));
+    return true;
+}
+
+OrderRouter::OrderRouter(WireWriter writer, const Config& config)
+    : config_(config),
+      writer_(std::move(writer)),
+      orders_(new Order[MAX_ORDERS]()),
+      queue_(false, data::CpuTopology::instance().node_of_cpu(config.send_cpu)) {
+    // Session-constant fields, encoded once
+    template_[wire::TYPE_OFFSET] = wire::ENTER_ORDER_TYPE;
+    template_[wire::TIF_OFFSET] = config_.time_in_force;
+    template_[wire::CAPACITY_OFFSET] = config_.capacity;
+    store_be<uint32_t>(template_.data() + wire::FIRM_OFFSET, config_.firm_id);
+
+    for (size_t i = 0; i < MAX_ORDERS; ++i) {
+        free_[i] = static_cast<uint32_t>(MAX_ORDERS - 1 - i);
+    }
+    free_count_ = MAX_ORDERS;
+}
+
+OrderRouter::~OrderRouter() {
+    stop();
+}
+
+bool OrderRouter::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    send_thread_ = std::thread(&OrderRouter::send_loop, this);
+    pinned_.store(data::pin_thread(send_thread_, config_.send_cpu), std::memory_order_release);
+    return true;
+}
+
+void OrderRouter::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (send_thread_.joinable()) {
+        send_thread_.join();
+    }
+    pinned_.store(false, std::memory_order_release);
+}
+
+void OrderRouter::send_loop() {
+    data::LatencyTracker::register_thread();
+    while (running_.load(std::memory_order_acquire)) {
+        if (drain() == 0) {
+            data::idle_wait(config_.busy_poll);
+        }
+    }
+    // Submissions queued before stop() still go out
+    while (drain() != 0) {
+    }
+}
+
+size_t OrderRouter::poll() {
+    return is_running() ? 0 : drain();
+}
+
+size_t OrderRouter::drain() {
+    SendRequest batch[SEND_BATCH];
+    const size_t n = queue_.pop_n(batch, SEND_BATCH);
+    for (size_t i = 0; i < n; ++i) {
+        send(batch[i]);
+    }
+    return n;
+}
+
+// Template copy plus the per-order fields
+void OrderRouter::encode(const Order& order, uint64_t send_time, uint8_t* out) const {
+    std::memcpy(out, template_.data(), wire::ENTER_ORDER_SIZE);
+    out[wire::SIDE_OFFSET] = static_cast<uint8_t>(order.side);
+    store_be<uint32_t>(out + wire::INSTRUMENT_OFFSET, order.instrument_id);
+    store_be<uint64_t>(out + wire::TOKEN_OFFSET, order.order_id);
+    store_be<uint64_t>(out + wire::PAIR_TOKEN_OFFSET, order.pair_id);
+    store_be<uint32_t>(out + wire::QUANTITY_OFFSET, order.quantity);
+    store_be<int64_t>(out + wire::PRICE_OFFSET, order.price.value);
+    store_be<uint64_t>(out + wire::SEND_TIME_OFFSET, send_time);
+}
+
+void OrderRouter::send(const SendRequest& request) {
+    alignas(64) uint8_t buffer[2 * wire::ENTER_ORDER_SIZE];
+    const uint64_t now = data::Timestamp::now().nanoseconds_since_epoch;
+    const size_t legs = request.second == NO_ORDER ? 1 : 2;
+    encode(orders_[request.first], now, buffer);
+    if (legs == 2) {
+        encode(orders_[request.second], now, buffer + wire::ENTER_ORDER_SIZE);
+    }
+
+    // Checked last, right before the wire, for orders queued before the halt
+    SendResult result;
+    if (halted()) {
+        orders_blocked_.fetch_add(legs, std::memory_order_relaxed);
+        result = SendResult::BLOCKED;
+    } else if (writer_ && writer_(buffer, legs * wire::ENTER_ORDER_SIZE)) {
+        orders_sent_.fetch_add(legs, std::memory_order_relaxed);
+        result = SendResult::SENT;
+    } else {
+        write_failures_.fetch_add(1, std::memory_order_relaxed);
+        result = SendResult::WRITE_FAILED;
+    }
+    orders_[request.first].result = result;
+    if (legs == 2) {
+        orders_[request.second].result = result;
+    }
+
+    // Never full: it holds at most the orders in flight
+    completions_.push(request.first);
+    if (legs == 2) {
+        completions_.push(request.second);
+    }
+}
+
+void OrderRouter::reclaim() {
+    uint32_t done[SEND_BATCH];
+    for (size_t n; (n = completions_.pop_n(done, SEND_BATCH)) != 0;) {
+        for (size_t i = 0; i < n; ++i) {
+            // One report per submission: a single, or a pair's first leg
+            const Order& order = orders_[done[i]];
+            if (order.pair_id == 0 || order.pair_id == order.order_id) {
+                if (report_count_ == MAX_ORDERS) {
+                    report_head_ = (report_head_ + 1) % MAX_ORDERS;
+                    --report_count_;
+                    ++reports_dropped_;
+                }
+                reports_[(report_head_ + report_count_++) % MAX_ORDERS] = SendReport{order.order_id, order.result};
+            }
+            free_[free_count_++] = done[i];
+        }
+    }
+}
+
+size_t OrderRouter::take_reports(SendReport* out, size_t max) {
+    reclaim();
+    const size_t n = std::min(max, report_count_);
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = reports_[report_head_];
+        report_head_ = (report_head_ + 1) % MAX_ORDERS;
+    }
+    report_count_ -= n;
+    return n;
+}
+
+Order* OrderRouter::allocate() {
+    if (free_count_ == 0) {
+        reclaim();
+        if (free_count_ == 0) {
+            return nullptr;
+        }
+    }
+    Order* order = &orders_[free_[--free_count_]];
+    *order = Order{};
+    return order;
+}
+
+void OrderRouter::release(Order* order) {
+    free_[free_count_++] = index_of(order);
+}
+
+bool OrderRouter::submit(Order* order) {
+    data::ScopedLatency trace(data::LatencyStage::ORDER_SUBMIT);
+    order->order_id = next_order_id_++;
+    order->pair_id = 0;
+    if (halted()) {
+        orders_blocked_.fetch_add(1, std::memory_order_relaxed);
+        release(order);
+        return false;
+    }
+    if (!queue_.push(SendRequest{index_of(order), NO_ORDER})) {
+        release(order);
+        return false;
+    }
+    ++submissions_;
+    return true;
+}
+
+bool OrderRouter::submit_pair(Order* first, Order* second) {
+    data::ScopedLatency trace(data::LatencyStage::ORDER_SUBMIT);
+    first->order_id = next_order_id_++;
+    second->order_id = next_order_id_++;
+    first->pair_id = first->order_id;
+    second->pair_id = first->order_id;
+    if (halted()) {
+        orders_blocked_.fetch_add(2, std::memory_order_relaxed);
+        release(first);
+        release(second);
+        return false;
+    }
+    if (!queue_.push(SendRequest{index_of(first), index_of(second)})) {
+        release(first);
+        release(second);
+        return false;
+    }
+    ++submissions_;
+    return true;
+}
+
+uint64_t OrderRouter::submit_straddle(Side side, uint32_t call_instrument, data::Price call_price,
+                                      uint32_t put_instrument, data::Price put_price, uint32_t quantity) {
+    Order* call = allocate();
+    if (!call) {
+        return 0;
+    }
+    Order* put = allocate();
+    if (!put) {
+        release(call);
+        return 0;
+    }
+    call->side = side;
+    call->instrument_id = call_instrument;
+    call->price = call_price;
+    call->quantity = quantity;
+    put->side = side;
+    put->instrument_id = put_instrument;
+    put->price = put_price;
+    put->quantity = quantity;
+    return submit_pair(call, put) ? call->pair_id : 0;
+}
+
+} // namespace hft::execution
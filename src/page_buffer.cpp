@@ -0,0 +1,124 @@
+/*
+ * ===================================================================
+ *                    PAGE-BACKED BUFFER STORAGE
+ * ===================================================================
+ */
+
+#include "../include/page_buffer.h"
+#include "../include/cpu_topology.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define HFT_HAS_MMAP 1
+#endif
+
+namespace hft::data {
+
+namespace {
+
+size_t round_up(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+} // namespace
+
+PageBuffer::PageBuffer(size_t bytes, bool use_hugepages, int numa_node) {
+    map(bytes, use_hugepages);
+    // Nothing is touched yet (the heap fallback is, so it stays put)
+    if (numa_node >= 0 && mapped_ && bind_memory_to_node(data_, size_, numa_node)) {
+        numa_node_ = numa_node;
+    }
+}
+
+void PageBuffer::map(size_t bytes, bool use_hugepages) {
+    if (bytes == 0) {
+        return;
+    }
+
+#ifdef HFT_HAS_MMAP
+#if defined(HAS_HUGEPAGES) && defined(MAP_HUGETLB)
+    if (use_hugepages) {
+        const size_t length = round_up(bytes, HUGE_PAGE_SIZE);
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            data_ = p;
+            size_ = length;
+            on_hugepages_ = true;
+            mapped_ = true;
+            return;
+        }
+    }
+#endif
+
+    const size_t length = round_up(bytes, use_hugepages ? HUGE_PAGE_SIZE : 4096);
+    void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+#if defined(HAS_HUGEPAGES) && defined(MADV_HUGEPAGE)
+    if (use_hugepages) {
+        madvise(p, length, MADV_HUGEPAGE);  // Best effort transparent hugepages
+    }
+#endif
+    data_ = p;
+    size_ = length;
+    mapped_ = true;
+#else
+    (void)use_hugepages;
+    const size_t length = round_up(bytes, 64);
+    data_ = std::aligned_alloc(64, length);
+    if (!data_) {
+        throw std::bad_alloc();
+    }
+    std::memset(data_, 0, length);
+    size_ = length;
+#endif
+}
+
+PageBuffer::~PageBuffer() {
+    release();
+}
+
+PageBuffer::PageBuffer(PageBuffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      on_hugepages_(std::exchange(other.on_hugepages_, false)),
+      mapped_(std::exchange(other.mapped_, false)),
+      numa_node_(std::exchange(other.numa_node_, -1)) {}
+
+PageBuffer& PageBuffer::operator=(PageBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        on_hugepages_ = std::exchange(other.on_hugepages_, false);
+        mapped_ = std::exchange(other.mapped_, false);
+        numa_node_ = std::exchange(other.numa_node_, -1);
+    }
+    return *this;
+}
+
+void PageBuffer::release() {
+    if (!data_) {
+        return;
+    }
+#ifdef HFT_HAS_MMAP
+    if (mapped_) {
+        munmap(data_, size_);
+    } else {
+        std::free(data_);
+    }
+#else
+    std::free(data_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    numa_node_ = -1;
+}
+
+} // namespace hft::data
@@ -0,0 +1,202 @@
+/*
+ * ===================================================================
+ *                    PARALLEL PARAMETER SWEEP
+ * ===================================================================
+ */
+
+#include "../include/parameter_sweep.h"
+#include <algorithm>
+#include <thread>
+
+namespace hft::analytics {
+
+namespace {
+
+// A worker's share of the job indices; owner and thieves both claim
+// with fetch_add, so a range is never handed out twice
+struct alignas(64) JobRange {
+    std::atomic<size_t> next{0};
+    size_t end = 0;
+
+    bool claim(size_t& job) {
+        if (next.load(std::memory_order_relaxed) >= end) {
+            return false;
+        }
+        job = next.fetch_add(1, std::memory_order_relaxed);
+        return job < end;
+    }
+};
+
+template<typename T>
+std::vector<T> axis_or(const std::vector<T>& axis, const T& fallback) {
+    return axis.empty() ? std::vector<T>{fallback} : axis;
+}
+
+} // namespace
+
+// ===================================================================
+//                            SWEEP DATA
+// ===================================================================
+
+void SweepData::add_market_data(std::vector<data::MarketTick> ticks) {
+    const auto by_timestamp = [](const data::MarketTick& a, const data::MarketTick& b) {
+        return a.timestamp.nanoseconds_since_epoch < b.timestamp.nanoseconds_since_epoch;
+    };
+    if (!std::is_sorted(ticks.begin(), ticks.end(), by_timestamp)) {
+        std::stable_sort(ticks.begin(), ticks.end(), by_timestamp);
+    }
+    market_.push_back(std::move(ticks));
+}
+
+bool SweepData::add_market_data(const data::HistoricalDataLoader& loader, const std::string& symbol,
+                                const data::Timestamp& start, const data::Timestamp& end) {
+    std::vector<data::MarketTick> ticks = loader.get_historical_data(symbol, start, end).to_vector();
+    if (ticks.empty()) {
+        return false;
+    }
+    market_.push_back(std::move(ticks));
+    return true;
+}
+
+void SweepData::add_options_data(std::vector<data::OptionTick> ticks) {
+    const auto by_timestamp = [](const data::OptionTick& a, const data::OptionTick& b) {
+        return a.timestamp.nanoseconds_since_epoch < b.timestamp.nanoseconds_since_epoch;
+    };
+    if (!std::is_sorted(ticks.begin(), ticks.end(), by_timestamp)) {
+        std::stable_sort(ticks.begin(), ticks.end(), by_timestamp);
+    }
+    options_.push_back(std::make_shared<const std::vector<data::OptionTick>>(std::move(ticks)));
+}
+
+bool SweepData::load(BacktestEngine& engine) const {
+    for (const auto& ticks : market_) {
+        engine.add_market_data(data::TickRange(ticks.data(), ticks.data() + ticks.size()));
+    }
+    for (const auto& ticks : options_) {
+        if (!engine.add_options_data(ticks)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t SweepData::market_ticks() const {
+    size_t total = 0;
+    for (const auto& ticks : market_) {
+        total += ticks.size();
+    }
+    return total;
+}
+
+// ===================================================================
+//                            SWEEP GRID
+// ===================================================================
+
+size_t SweepGrid::size() const {
+    const auto n = [](size_t axis) { return std::max<size_t>(axis, 1); };
+    return n(otm_offset_pct.size()) * n(profit_target_pct.size()) * n(stop_loss_pct.size()) *
+           n(max_hold_days.size()) * n(implied_vol_band.size()) * n(expiry_band.size());
+}
+
+std::vector<strategy::StraddleStrategy::Config> SweepGrid::expand() const {
+    std::vector<strategy::StraddleStrategy::Config> configs;
+    configs.reserve(size());
+
+    for (double otm : axis_or(otm_offset_pct, base.otm_offset_pct))
+    for (double target : axis_or(profit_target_pct, base.profit_target_pct))
+    for (double stop : axis_or(stop_loss_pct, base.stop_loss_pct))
+    for (uint16_t hold : axis_or(max_hold_days, base.max_hold_days))
+    for (const auto& iv : axis_or(implied_vol_band, {base.min_implied_vol, base.max_implied_vol}))
+    for (const auto& expiry : axis_or(expiry_band, {base.min_time_to_expiry, base.max_time_to_expiry})) {
+        strategy::StraddleStrategy::Config config = base;
+        config.otm_offset_pct = otm;
+        config.profit_target_pct = target;
+        config.stop_loss_pct = stop;
+        config.max_hold_days = hold;
+        config.min_implied_vol = iv.first;
+        config.max_implied_vol = iv.second;
+        config.min_time_to_expiry = expiry.first;
+        config.max_time_to_expiry = expiry.second;
+        configs.push_back(config);
+    }
+    return configs;
+}
+
+// ===================================================================
+//                          PARAMETER SWEEP
+// ===================================================================
+
+ParameterSweep::ParameterSweep(const SweepData& data, const Config& config)
+    : data_(data), config_(config) {}
+
+std::vector<SweepResult> ParameterSweep::run(const std::vector<strategy::StraddleStrategy::Config>& configs) {
+    std::vector<SweepResult> results(configs.size());
+    steals_.store(0, std::memory_order_relaxed);
+    if (configs.empty()) {
+        return results;
+    }
+
+    size_t threads = config_.num_threads ? config_.num_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, configs.size());
+
+    std::vector<JobRange> ranges(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        ranges[i].next.store(configs.size() * i / threads, std::memory_order_relaxed);
+        ranges[i].end = configs.size() * (i + 1) / threads;
+    }
+
+    auto worker = [&](size_t self) {
+        BacktestEngine engine;
+        if (!data_.load(engine)) {
+            return;
+        }
+
+        uint64_t stolen = 0;
+        size_t job = 0;
+        for (size_t offset = 0; offset < threads; ++offset) {
+            JobRange& range = ranges[(self + offset) % threads];
+            while (range.claim(job)) {
+                strategy::StraddleStrategy strategy(configs[job]);
+                SweepResult& result = results[job];
+                result.stats = engine.run(strategy);
+                result.config = configs[job];
+                result.trades = strategy.get_total_trades_count();
+                result.win_rate = strategy.get_win_rate();
+                result.sharpe_ratio = strategy.get_sharpe_ratio();
+                result.max_drawdown = strategy.get_max_drawdown();
+                result.total_pnl = strategy.get_total_pnl();
+                result.average_trade_pnl = strategy.get_average_trade_pnl();
+                stolen += offset != 0;
+            }
+        }
+        steals_.fetch_add(stolen, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back(worker, i);
+    }
+    worker(0);
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    return results;
+}
+
+void ParameterSweep::write_csv(std::ostream& out, const std::vector<SweepResult>& results) {
+    out << "otm_offset_pct,profit_target_pct,stop_loss_pct,max_hold_days,min_implied_vol,max_implied_vol,"
+           "min_time_to_expiry,max_time_to_expiry,trades,win_rate,sharpe_ratio,max_drawdown,total_pnl,"
+           "average_trade_pnl,events,ticks_per_second\n";
+    for (const auto& r : results) {
+        const auto& c = r.config;
+        out << c.otm_offset_pct << ',' << c.profit_target_pct << ',' << c.stop_loss_pct << ','
+            << c.max_hold_days << ',' << c.min_implied_vol << ',' << c.max_implied_vol << ','
+            << c.min_time_to_expiry << ',' << c.max_time_to_expiry << ','
+            << r.trades << ',' << r.win_rate << ',' << r.sharpe_ratio << ',' << r.max_drawdown << ','
+            << r.total_pnl << ',' << r.average_trade_pnl << ','
+            << r.stats.events() << ',' << r.stats.ticks_per_second() << '\n';
+    }
+}
+
+} // namespace hft::analytics
@@ -0,0 +1,180 @@
+/*
+ * ===================================================================
+ *                      STRADDLE POSITION BOOK
+ * ===================================================================
+ */
+
+#include "../include/position_book.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace hft::strategy {
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#endif
+}
+
+} // namespace
+
+PositionBook::PositionBook(size_t capacity, size_t journal_capacity)
+    : capacity_(capacity),
+      journal_capacity_(std::max<size_t>(journal_capacity, 1)),
+      slots_(new Slot[capacity]),
+      symbols_(new uint32_t[capacity]),
+      journal_(new StraddlePosition[journal_capacity_]()),
+      by_symbol_size_(constants::MAX_SYMBOLS),
+      by_symbol_(new PortfolioExposure[by_symbol_size_]()) {
+    std::fill(symbols_.get(), symbols_.get() + capacity_, FREE);
+}
+
+StraddlePosition* PositionBook::open(const StraddlePosition& position) {
+    const auto free_slot = std::find(symbols_.get(), symbols_.get() + capacity_, FREE);
+    if (free_slot == symbols_.get() + capacity_) {
+        return nullptr;
+    }
+    const size_t index = static_cast<size_t>(free_slot - symbols_.get());
+    Slot& slot = slots_[index];
+
+    begin_write(exposure_version_);
+    begin_write(slot.version);
+    slot.position = position;
+    if (position.status != PositionStatus::ENTRY_PENDING) {
+        slot.position.status = PositionStatus::ACTIVE;
+    }
+    end_write(slot.version);
+    apply_exposure(slot.position, 1.0);
+    count_position(position.symbol_id, 1);
+    end_write(exposure_version_);
+
+    symbols_[index] = position.symbol_id;
+    active_.fetch_add(1, std::memory_order_release);
+    return &slot.position;
+}
+
+void PositionBook::close(StraddlePosition& position) {
+    Slot& slot = slot_of(position);
+    const size_t index = index_of(position);
+
+    // Journal entry n may overwrite entry n - capacity: reserve first so
+    // a reader of the old entry sees its copy invalidated
+    const uint64_t n = journal_published_.load(std::memory_order_relaxed);
+    journal_reserved_.store(n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    journal_[n % journal_capacity_] = slot.position;
+    journal_[n % journal_capacity_].status = PositionStatus::CLOSED;
+    journal_published_.store(n + 1, std::memory_order_release);
+
+    begin_write(exposure_version_);
+    begin_write(slot.version);
+    slot.position.status = PositionStatus::CLOSED;
+    end_write(slot.version);
+    apply_exposure(slot.position, -1.0);
+    count_position(slot.position.symbol_id, -1);
+    end_write(exposure_version_);
+
+    symbols_[index] = FREE;
+    active_.fetch_sub(1, std::memory_order_release);
+}
+
+void PositionBook::discard(StraddlePosition& position) {
+    Slot& slot = slot_of(position);
+    const size_t index = index_of(position);
+
+    begin_write(exposure_version_);
+    begin_write(slot.version);
+    slot.position.status = PositionStatus::NONE;
+    end_write(slot.version);
+    apply_exposure(slot.position, -1.0);
+    count_position(slot.position.symbol_id, -1);
+    end_write(exposure_version_);
+
+    symbols_[index] = FREE;
+    active_.fetch_sub(1, std::memory_order_release);
+}
+
+bool PositionBook::has_position(uint32_t symbol_id) const {
+    return std::find(symbols_.get(), symbols_.get() + capacity_, symbol_id) != symbols_.get() + capacity_;
+}
+
+size_t PositionBook::snapshot_active(StraddlePosition* out, size_t max) const {
+    size_t written = 0;
+    for (size_t i = 0; i < capacity_ && written < max; ++i) {
+        const Slot& slot = slots_[i];
+        for (;;) {
+            const uint64_t before = slot.version.load(std::memory_order_acquire);
+            if (before & 1) {
+                cpu_relax();
+                continue;
+            }
+            out[written] = slot.position;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.version.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+        written += out[written].status == PositionStatus::ACTIVE;
+    }
+    return written;
+}
+
+size_t PositionBook::read_closed(uint64_t first, StraddlePosition* out, size_t max) const {
+    const uint64_t published = journal_published_.load(std::memory_order_acquire);
+    size_t written = 0;
+    for (uint64_t n = first; n < published && written < max; ++n) {
+        out[written] = journal_[n % journal_capacity_];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (journal_reserved_.load(std::memory_order_relaxed) - n > journal_capacity_) {
+            break;  // Overwritten while (or before) it was copied
+        }
+        ++written;
+    }
+    return written;
+}
+
+// Totals are reset exactly when their last position closes, so rounding
+// from the incremental updates cannot accumulate across positions
+void PositionBook::count_position(uint32_t symbol_id, int delta) {
+    portfolio_.positions += delta;
+    if (portfolio_.positions == 0) {
+        portfolio_ = PortfolioExposure{};
+    }
+    if (symbol_id < by_symbol_size_) {
+        PortfolioExposure& exposure = by_symbol_[symbol_id];
+        exposure.positions += delta;
+        if (exposure.positions == 0) {
+            exposure = PortfolioExposure{};
+        }
+    }
+}
+
+PortfolioExposure PositionBook::read_exposure(const PortfolioExposure& source) const {
+    for (;;) {
+        const uint64_t before = exposure_version_.load(std::memory_order_acquire);
+        if (before & 1) {
+            cpu_relax();
+            continue;
+        }
+        const PortfolioExposure copy = source;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (exposure_version_.load(std::memory_order_relaxed) == before) {
+            return copy;
+        }
+    }
+}
+
+PortfolioExposure PositionBook::portfolio_exposure() const {
+    return read_exposure(portfolio_);
+}
+
+PortfolioExposure PositionBook::symbol_exposure(uint32_t symbol_id) const {
+    return symbol_id < by_symbol_size_ ? read_exposure(by_symbol_[symbol_id]) : PortfolioExposure{};
+}
+
+} // namespace hft::strategy
@@ -0,0 +1,281 @@
+/*
+ * ===================================================================
+ *                      STRADDLE RISK MANAGER
+ * ===================================================================
+ *
+ * Portfolio limits evaluated against the position book's running
+ * exposure totals. Capital at risk of a long straddle is its current
+ * market value; every check is O(1).
+ *
+ * Every update turns the totals into per-limit headroom (dollars left
+ * under each limit), so the pre-trade check never divides, loops or
+ * touches another thread's cache lines beyond the kill switch.
+ *
+ * ===================================================================
+ */
+
+#include "../include/straddle_strategy.h"
+#include <algorithm>
+#include <limits>
+
+namespace hft::strategy {
+
+namespace {
+
+constexpr double UNLIMITED = std::numeric_limits<double>::infinity();
+
+} // namespace
+
+RiskManager::RiskManager(const RiskLimits& limits) : limits_(limits) {
+    refresh_headroom();
+}
+
+bool RiskManager::can_open_position(const StraddlePosition& position, double portfolio_value) const {
+    if (!(portfolio_value > 0.0)) {
+        return false;
+    }
+    const double capital = position.total_premium_paid.to_double() * StraddleStrategy::CONTRACT_MULTIPLIER;
+    if (portfolio_value == portfolio_value_.load(std::memory_order_relaxed)) {
+        return can_open_position(position.symbol_id, capital);
+    }
+    // Cold: limits scaled to a portfolio value the snapshot was not built for
+    if (is_kill_switch_engaged() || loss_limit_breached(portfolio_value) ||
+        positions_ >= limits_.max_positions) {
+        return false;
+    }
+    const Buckets b = position.symbol_id < buckets_.size() ? buckets_[position.symbol_id] : Buckets{};
+    return capital <= limits_.max_position_size * portfolio_value &&
+           capital_ + capital <= limits_.max_portfolio_risk * portfolio_value &&
+           (b.sector == UNASSIGNED ||
+            sector_capital_[b.sector] + capital <= limits_.max_sector_exposure * portfolio_value) &&
+           (b.correlation == UNASSIGNED ||
+            correlation_capital_[b.correlation] + capital <= limits_.max_position_size * portfolio_value);
+}
+
+bool RiskManager::should_reduce_exposure() const {
+    return current_portfolio_risk_.load(std::memory_order_relaxed) > limits_.max_portfolio_risk;
+}
+
+bool RiskManager::should_stop_trading() const {
+    return loss_limit_breached(portfolio_value_.load(std::memory_order_relaxed));
+}
+
+bool RiskManager::loss_limit_breached(double portfolio_value) const {
+    if (!(portfolio_value > 0.0)) {
+        return false;
+    }
+    return get_daily_pnl() <= -limits_.max_daily_loss * portfolio_value ||
+           get_monthly_pnl() <= -limits_.max_monthly_loss * portfolio_value;
+}
+
+bool RiskManager::set_sector(uint32_t symbol_id, uint8_t sector) {
+    if (symbol_id >= buckets_.size() || sector >= MAX_BUCKETS) {
+        return false;
+    }
+    Buckets& b = buckets_[symbol_id];
+    sector_capital_[b.sector] -= symbol_capital_[symbol_id];
+    sector_capital_[sector] += symbol_capital_[symbol_id];
+    b.sector = sector;
+    refresh_headroom();
+    return true;
+}
+
+bool RiskManager::set_correlation_group(uint32_t symbol_id, uint8_t group) {
+    if (symbol_id >= buckets_.size() || group >= MAX_BUCKETS) {
+        return false;
+    }
+    Buckets& b = buckets_[symbol_id];
+    correlation_capital_[b.correlation] -= symbol_capital_[symbol_id];
+    correlation_capital_[group] += symbol_capital_[symbol_id];
+    b.correlation = group;
+    refresh_headroom();
+    return true;
+}
+
+void RiskManager::set_portfolio_value(double portfolio_value) {
+    portfolio_value_.store(portfolio_value, std::memory_order_relaxed);
+    refresh_headroom();
+}
+
+void RiskManager::update_symbol_risk(uint32_t symbol_id, const PortfolioExposure& exposure) {
+    if (symbol_id >= buckets_.size()) {
+        return;
+    }
+    const Buckets b = buckets_[symbol_id];
+    const double capital = exposure.market_value * StraddleStrategy::CONTRACT_MULTIPLIER;
+    const double delta = capital - symbol_capital_[symbol_id];
+    symbol_capital_[symbol_id] = capital;
+    positions_ += exposure.positions - symbol_positions_[symbol_id];
+    symbol_positions_[symbol_id] = exposure.positions;
+
+    if (positions_ == 0) {
+        // Flat book: drop the rounding the running sums picked up
+        capital_ = 0.0;
+        symbol_capital_.fill(0.0);
+        sector_capital_.fill(0.0);
+        correlation_capital_.fill(0.0);
+        refresh_headroom();
+        return;
+    }
+    capital_ += delta;
+    sector_capital_[b.sector] += delta;
+    correlation_capital_[b.correlation] += delta;
+
+    const double value = portfolio_value_.load(std::memory_order_relaxed);
+    headroom_.portfolio = limits_.max_portfolio_risk * value - capital_;
+    headroom_.positions = positions_ < limits_.max_positions
+        ? static_cast<uint32_t>(limits_.max_positions - positions_) : 0;
+    if (b.sector != UNASSIGNED) {
+        headroom_.sector[b.sector] = limits_.max_sector_exposure * value - sector_capital_[b.sector];
+        publish_breach(sector_breaches_, b.sector, headroom_.sector[b.sector]);
+    }
+    if (b.correlation != UNASSIGNED) {
+        headroom_.correlation[b.correlation] =
+            limits_.max_position_size * value - correlation_capital_[b.correlation];
+        publish_breach(correlation_breaches_, b.correlation, headroom_.correlation[b.correlation]);
+    }
+    publish_totals();
+}
+
+void RiskManager::refresh_headroom() {
+    const double value = portfolio_value_.load(std::memory_order_relaxed);
+    headroom_.portfolio = limits_.max_portfolio_risk * value - capital_;
+    headroom_.position = limits_.max_position_size * value;
+    headroom_.positions = positions_ < limits_.max_positions
+        ? static_cast<uint32_t>(limits_.max_positions - positions_) : 0;
+    headroom_.sector[UNASSIGNED] = UNLIMITED;
+    headroom_.correlation[UNASSIGNED] = UNLIMITED;
+    for (size_t i = 1; i < MAX_BUCKETS; ++i) {
+        headroom_.sector[i] = limits_.max_sector_exposure * value - sector_capital_[i];
+        headroom_.correlation[i] = limits_.max_position_size * value - correlation_capital_[i];
+        publish_breach(sector_breaches_, i, headroom_.sector[i]);
+        publish_breach(correlation_breaches_, i, headroom_.correlation[i]);
+    }
+    refresh_trading();
+    publish_totals();
+}
+
+void RiskManager::refresh_trading() {
+    const bool breached = loss_limit_breached(portfolio_value_.load(std::memory_order_relaxed));
+    headroom_.trading = !breached;
+    if (breached) {
+        engage_kill_switch();   // Latched: a P&L reset does not resume trading
+    }
+}
+
+void RiskManager::publish_totals() {
+    const double value = portfolio_value_.load(std::memory_order_relaxed);
+    open_positions_.store(positions_, std::memory_order_relaxed);
+    current_portfolio_risk_.store(value > 0.0 ? capital_ / value : 0.0, std::memory_order_relaxed);
+}
+
+void RiskManager::publish_breach(std::atomic<uint32_t>& breaches, size_t bucket, double headroom) {
+    const uint32_t bit = 1u << bucket;
+    const uint32_t current = breaches.load(std::memory_order_relaxed);
+    breaches.store(headroom < 0.0 ? current | bit : current & ~bit, std::memory_order_relaxed);
+}
+
+void RiskManager::update_daily_pnl(double pnl) {
+    const int64_t units = data::PnlCounter::to_fixed(pnl);
+    daily_pnl_.add(units);
+    monthly_pnl_.add(units);
+    refresh_trading();
+}
+
+void RiskManager::reset_daily_pnl() {
+    daily_pnl_.reset();
+    refresh_trading();
+}
+
+void RiskManager::reset_monthly_pnl() {
+    monthly_pnl_.reset();
+    refresh_trading();
+}
+
+bool RiskManager::is_risk_limit_breached() const {
+    return should_reduce_exposure() || should_stop_trading() || is_kill_switch_engaged() ||
+           open_positions_.load(std::memory_order_relaxed) > limits_.max_positions ||
+           sector_breaches_.load(std::memory_order_relaxed) != 0 ||
+           correlation_breaches_.load(std::memory_order_relaxed) != 0;
+}
+
+size_t RiskManager::get_risk_alerts(Alert* out, size_t max) const {
+    size_t count = 0;
+    auto add = [&](Alert::Kind kind, double value, double limit) {
+        if (count < max) {
+            out[count++] = Alert{kind, value, limit};
+        }
+    };
+    if (should_reduce_exposure()) {
+        add(Alert::Kind::PORTFOLIO_RISK, get_portfolio_risk(), limits_.max_portfolio_risk);
+    }
+    const uint32_t positions = open_positions_.load(std::memory_order_relaxed);
+    if (positions > limits_.max_positions) {
+        add(Alert::Kind::POSITION_COUNT, positions, static_cast<double>(limits_.max_positions));
+    }
+    const double value = portfolio_value_.load(std::memory_order_relaxed);
+    if (value > 0.0 && get_daily_pnl() <= -limits_.max_daily_loss * value) {
+        add(Alert::Kind::DAILY_LOSS, get_daily_pnl(), -limits_.max_daily_loss * value);
+    }
+    if (value > 0.0 && get_monthly_pnl() <= -limits_.max_monthly_loss * value) {
+        add(Alert::Kind::MONTHLY_LOSS, get_monthly_pnl(), -limits_.max_monthly_loss * value);
+    }
+    // Bucket alerts count the buckets over their limit
+    if (const uint32_t sectors = sector_breaches_.load(std::memory_order_relaxed)) {
+        add(Alert::Kind::SECTOR_EXPOSURE, __builtin_popcount(sectors), limits_.max_sector_exposure);
+    }
+    if (const uint32_t groups = correlation_breaches_.load(std::memory_order_relaxed)) {
+        add(Alert::Kind::CORRELATED_EXPOSURE, __builtin_popcount(groups), limits_.max_position_size);
+    }
+    if (is_kill_switch_engaged()) {
+        add(Alert::Kind::KILL_SWITCH, 1.0, 0.0);
+    }
+    return count;
+}
+
+data::Span<RiskManager::Alert> RiskManager::get_risk_alerts(data::MonotonicArena& arena) const {
+    Alert alerts[MAX_ALERTS];
+    const size_t count = get_risk_alerts(alerts, MAX_ALERTS);
+    if (count == 0) {
+        return {};
+    }
+    const data::Span<Alert> out = arena.allocate_array<Alert>(count);
+    std::copy(alerts, alerts + out.size(), out.begin());
+    return out;
+}
+
+std::vector<std::string> RiskManager::get_risk_alerts() const {
+    Alert alerts[MAX_ALERTS];
+    const size_t count = get_risk_alerts(alerts, MAX_ALERTS);
+    std::vector<std::string> messages;
+    messages.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        messages.push_back(describe(alerts[i]));
+    }
+    return messages;
+}
+
+std::string RiskManager::describe(const Alert& alert) {
+    switch (alert.kind) {
+        case Alert::Kind::PORTFOLIO_RISK:
+            return "portfolio risk " + std::to_string(alert.value) + " exceeds limit " +
+                   std::to_string(alert.limit);
+        case Alert::Kind::POSITION_COUNT:
+            return "open positions exceed limit " + std::to_string(static_cast<size_t>(alert.limit));
+        case Alert::Kind::DAILY_LOSS:
+            return "daily loss limit reached: " + std::to_string(alert.value);
+        case Alert::Kind::MONTHLY_LOSS:
+            return "monthly loss limit reached: " + std::to_string(alert.value);
+        case Alert::Kind::SECTOR_EXPOSURE:
+            return std::to_string(static_cast<size_t>(alert.value)) + " sector(s) exceed exposure limit " +
+                   std::to_string(alert.limit);
+        case Alert::Kind::CORRELATED_EXPOSURE:
+            return std::to_string(static_cast<size_t>(alert.value)) +
+                   " correlation group(s) exceed position limit " + std::to_string(alert.limit);
+        case Alert::Kind::KILL_SWITCH:
+            return "kill switch engaged: order flow halted";
+    }
+    return {};
+}
+
+} // namespace hft::strategy
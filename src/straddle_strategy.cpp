@@ -0,0 +1,650 @@
+/*
+ * ===================================================================
+ *                      STRADDLE STRATEGY ENGINE
+ * ===================================================================
+ *
+ * Long OTM straddles entered in low realized-volatility regimes and
+ * exited on profit target, stop loss, max hold or approaching expiry.
+ *
+ * CONVENTIONS:
+ * - Entries pay the ask on both legs, marks and exits use the bid
+ * - One contract per leg; dollar P&L = premium P&L * CONTRACT_MULTIPLIER
+ * - All timing uses event time (the timestamp of the triggering tick),
+ *   never the wall clock, so a replay is deterministic
+ *
+ * ===================================================================
+ */
+
+#include "../include/straddle_strategy.h"
+#include "../include/order_router.h"
+#include "../include/latency_tracker.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+
+namespace hft::strategy {
+
+namespace {
+
+constexpr double NS_PER_DAY = 86400.0 * 1e9;
+constexpr double TRADING_DAYS_PER_YEAR = 252.0;
+constexpr double RISK_FREE_RATE = 0.02;
+constexpr uint8_t CALL = 0;
+constexpr uint8_t PUT = 1;
+
+data::Price mark_price(const data::OptionTick& option) {
+    return option.bid.value > 0 ? option.bid : option.last;
+}
+
+data::Price entry_price(const data::OptionTick& option) {
+    return option.ask.value > 0 ? option.ask : option.last;
+}
+
+} // namespace
+
+// ===================================================================
+//                        STRADDLE POSITION
+// ===================================================================
+
+bool StraddlePosition::should_close() const {
+    if (status != PositionStatus::ACTIVE) {
+        return false;
+    }
+    const data::Price value = calculate_position_value();
+    return !(value < profit_target) ||
+           !(value > stop_loss) ||
+           days_held >= max_hold_days ||
+           days_to_expiry <= 1;
+}
+
+// ===================================================================
+//                      VOLATILITY ANALYZER
+// ===================================================================
+
+VolatilityAnalyzer::VolatilityAnalyzer() : symbols_(constants::MAX_SYMBOLS) {}
+
+void VolatilityAnalyzer::add_price(uint32_t symbol_id, const data::Price& price, const data::Timestamp&) {
+    if (price.value <= 0 || symbol_id >= symbols_.size()) {
+        return;
+    }
+    auto& slot = symbols_[symbol_id];
+    if (!slot) {
+        slot = std::make_unique<SymbolState>();
+    }
+    SymbolState& s = *slot;
+
+    const double p = price.to_double();
+    const double last = s.last_price;
+    s.last_price = p;
+    if (last <= 0.0) {
+        return;
+    }
+    add_return(s, std::log(p / last));
+    if (s.return_count < VOLATILITY_WINDOW) {
+        return;
+    }
+
+    // Sample stdev of log returns, annualized as if one sample per trading
+    // day (the regime tests are percentiles, so the scale cancels out)
+    const double variance = s.m2 / (VOLATILITY_WINDOW - 1);
+    s.current_volatility = std::sqrt(variance * TRADING_DAYS_PER_YEAR);
+    add_volatility(s, s.current_volatility);
+}
+
+// Welford update; once the ring is full the oldest return is swapped out
+void VolatilityAnalyzer::add_return(SymbolState& s, double r) {
+    if (s.return_count < VOLATILITY_WINDOW) {
+        s.returns[s.return_count++] = r;
+        const double delta = r - s.mean;
+        s.mean += delta / s.return_count;
+        s.m2 += delta * (r - s.mean);
+        return;
+    }
+
+    const double old = s.returns[s.return_head];
+    s.returns[s.return_head] = r;
+    s.return_head = (s.return_head + 1) % VOLATILITY_WINDOW;
+    const double old_mean = s.mean;
+    s.mean += (r - old) / VOLATILITY_WINDOW;
+    s.m2 += (r - old) * (r - s.mean + old - old_mean);
+
+    if (s.return_resync.due()) {
+        double sum = 0.0;
+        for (double x : s.returns) sum += x;
+        s.mean = sum / VOLATILITY_WINDOW;
+        s.m2 = 0.0;
+        for (double x : s.returns) s.m2 += (x - s.mean) * (x - s.mean);
+    }
+    s.m2 = std::max(s.m2, 0.0);
+}
+
+void VolatilityAnalyzer::add_volatility(SymbolState& s, double volatility) {
+    if (s.history.full()) {
+        const double old = s.history.oldest();
+        s.history_sq_sum -= old * old;
+    }
+    s.history.push(volatility);
+
+    // Mid-rank, so a flat history sits at 0.5 rather than looking "low"
+    s.percentile = s.history.rank_of(volatility);
+
+    s.history_sq_sum += volatility * volatility;
+    if (s.history_resync.due()) {
+        s.history_sq_sum = 0.0;
+        const double* sorted = s.history.sorted();
+        for (size_t i = 0; i < s.history.size(); ++i) s.history_sq_sum += sorted[i] * sorted[i];
+    }
+}
+
+double VolatilityAnalyzer::get_current_volatility(uint32_t symbol_id) const {
+    const SymbolState* s = state(symbol_id);
+    return s ? s->current_volatility : 0.0;
+}
+
+bool VolatilityAnalyzer::is_low_volatility_regime(uint32_t symbol_id) const {
+    const SymbolState* s = state(symbol_id);
+    return s && s->history.size() >= VOLATILITY_WINDOW && s->percentile <= LOW_VOL_PERCENTILE;
+}
+
+double VolatilityAnalyzer::get_volatility_percentile(uint32_t symbol_id) const {
+    const SymbolState* s = state(symbol_id);
+    return s && !s->history.empty() ? s->percentile : 0.5;
+}
+
+double VolatilityAnalyzer::predict_volatility(uint32_t symbol_id, int days_ahead) const {
+    const SymbolState* s = state(symbol_id);
+    if (!s || s->history.empty()) {
+        return 0.0;
+    }
+
+    // Variance mean-reverts geometrically toward its long-run level
+    constexpr double PERSISTENCE = 0.94;
+    const double long_run_variance = std::max(s->history_sq_sum, 0.0) / s->history.size();
+    const double current_variance = s->current_volatility * s->current_volatility;
+    const double decay = std::pow(PERSISTENCE, std::max(days_ahead, 0));
+    return std::sqrt(std::max(0.0, long_run_variance + decay * (current_variance - long_run_variance)));
+}
+
+// ===================================================================
+//                        STRADDLE STRATEGY
+// ===================================================================
+
+StraddleStrategy::StraddleStrategy(const Config& config)
+    : config_(config),
+      positions_(config.max_positions, config.max_closed_positions),
+      latest_ticks_(constants::MAX_SYMBOLS),
+      surfaces_(constants::MAX_SYMBOLS),
+      chains_(constants::MAX_SYMBOLS) {}
+
+StraddleStrategy::~StraddleStrategy() {
+    stop();
+}
+
+bool StraddleStrategy::initialize() {
+    if (!volatility_analyzer_) {
+        volatility_analyzer_ = std::make_unique<VolatilityAnalyzer>();
+    }
+    if (!options_calculator_) {
+        options_calculator_ = std::make_unique<OptionsCalculator>();
+    }
+    return config_.max_positions > 0 && config_.min_time_to_expiry <= config_.max_time_to_expiry;
+}
+
+void StraddleStrategy::start() {
+    running_.store(true, std::memory_order_release);
+}
+
+void StraddleStrategy::stop() {
+    running_.store(false, std::memory_order_release);
+    event_thread_.store(std::thread::id{}, std::memory_order_relaxed);
+}
+
+void StraddleStrategy::on_market_data(const data::MarketTick& tick) {
+    data::ScopedLatency trace(data::LatencyStage::STRATEGY_TICK);
+    check_event_thread();
+    process_order_reports();
+    if (tick.symbol_id >= latest_ticks_.size() || !volatility_analyzer_) {
+        return;
+    }
+    current_time_ = tick.timestamp;
+    latest_ticks_[tick.symbol_id] = tick;
+    volatility_analyzer_->add_price(tick.symbol_id, tick.midpoint(), tick.timestamp);
+
+    bool has_position = false;
+    bool touched = false;
+    positions_.for_each_on_symbol(tick.symbol_id, [&](StraddlePosition& position) {
+        if (position.status == PositionStatus::EXIT_PENDING) {
+            has_position = true;   // Marked at its exit prices until the report
+            return;
+        }
+        positions_.modify(position, [&](StraddlePosition& p) {
+            p.current_underlying_price = tick.midpoint();
+            update_position(p);
+        });
+        if (should_close_position(position)) {
+            close_position(position);
+        } else {
+            has_position = true;
+        }
+        touched = true;
+    });
+    if (touched) {
+        report_symbol_risk(tick.symbol_id);
+    }
+
+    if (!has_position && running_.load(std::memory_order_acquire)) {
+        analyze_entry_opportunity(tick.symbol_id);
+    }
+}
+
+void StraddleStrategy::on_options_data(const data::OptionTick& tick) {
+    check_event_thread();
+    process_order_reports();
+    current_time_ = tick.timestamp;
+    if (tick.underlying_id >= surfaces_.size()) {
+        return;
+    }
+    auto& chain = chains_[tick.underlying_id];
+    auto& surface = surfaces_[tick.underlying_id];
+    if (!surface) {
+        chain = std::make_unique<data::OptionsChain>(tick.underlying_id);
+        surface = std::make_unique<data::VolatilitySurface>(tick.underlying_id);
+    }
+    chain->update(tick);
+    surface->update(tick);
+
+    bool touched = false;
+    positions_.for_each_on_symbol(tick.underlying_id, [&](StraddlePosition& position) {
+        const bool is_call_leg = tick.option_type == CALL && tick.strike.value == position.call_strike.value;
+        const bool is_put_leg = tick.option_type == PUT && tick.strike.value == position.put_strike.value;
+        if (tick.expiration_date != position.expiration_date || !(is_call_leg || is_put_leg) ||
+            position.status == PositionStatus::EXIT_PENDING) {
+            return;
+        }
+
+        positions_.modify(position, [&](StraddlePosition& p) {
+            (is_call_leg ? p.current_call_price : p.current_put_price) = mark_price(tick);
+            p.days_to_expiry = tick.days_to_expiry;
+            const double iv = 0.5 * (surface->implied_volatility(p.call_strike, p.expiration_date) +
+                                     surface->implied_volatility(p.put_strike, p.expiration_date));
+            if (iv > 0.0) {
+                p.implied_volatility = iv;
+            }
+            update_position(p);
+        });
+        if (should_close_position(position)) {
+            close_position(position);
+        }
+        touched = true;
+    });
+    if (touched) {
+        report_symbol_risk(tick.underlying_id);
+    }
+}
+
+bool StraddleStrategy::analyze_entry_opportunity(uint32_t symbol_id) {
+    data::ScopedLatency trace(data::LatencyStage::ENTRY_ANALYSIS);
+    if (symbol_id >= latest_ticks_.size() || get_active_positions_count() >= config_.max_positions) {
+        return false;
+    }
+    const data::MarketTick& tick = latest_ticks_[symbol_id];
+    if (!is_good_entry_opportunity(symbol_id, tick)) {
+        return false;
+    }
+    return create_straddle_position(symbol_id, tick);
+}
+
+bool StraddleStrategy::is_good_entry_opportunity(uint32_t symbol_id, const data::MarketTick& tick) {
+    if (!volatility_analyzer_ || tick.bid.value <= 0 || tick.ask.value < tick.bid.value) {
+        return false;
+    }
+    return volatility_analyzer_->is_low_volatility_regime(symbol_id);
+}
+
+std::pair<const data::OptionTick*, const data::OptionTick*> StraddleStrategy::select_optimal_strikes(
+    const data::MarketTick& underlying, const data::OptionsChain& chain) const {
+    // Nearest expiry inside the configured band
+    const size_t expiry = chain.nearest_expiry(config_.min_time_to_expiry, config_.max_time_to_expiry);
+    if (expiry == data::OptionsChain::NONE) {
+        return {nullptr, nullptr};
+    }
+
+    // Closest-to-the-money strikes at least otm_offset_pct away on each side,
+    // bounds in basis points so exact-offset strikes are not lost to FP error
+    const double spot = static_cast<double>(underlying.midpoint().value);
+    const auto call_floor = data::Price::from_basis_points(std::llround(spot * (1.0 + config_.otm_offset_pct)));
+    const auto put_ceiling = data::Price::from_basis_points(std::llround(spot * (1.0 - config_.otm_offset_pct)));
+    return {chain.call_at_or_above(expiry, call_floor), chain.put_at_or_below(expiry, put_ceiling)};
+}
+
+const data::VolatilitySurface* StraddleStrategy::get_volatility_surface(uint32_t underlying_id) const {
+    return underlying_id < surfaces_.size() ? surfaces_[underlying_id].get() : nullptr;
+}
+
+const data::OptionsChain* StraddleStrategy::get_options_chain(uint32_t underlying_id) const {
+    return underlying_id < chains_.size() ? chains_[underlying_id].get() : nullptr;
+}
+
+bool StraddleStrategy::create_straddle_position(uint32_t symbol_id, const data::MarketTick& underlying_tick) {
+    const data::OptionsChain* chain = get_options_chain(symbol_id);
+    const data::VolatilitySurface* surface = get_volatility_surface(symbol_id);
+    if (!chain || !surface) {
+        return false;
+    }
+
+    const auto [call, put] = select_optimal_strikes(underlying_tick, *chain);
+    if (!call || !put) {
+        return false;
+    }
+
+    // Smoothed IV from the surface rather than the two raw leg quotes
+    const double call_iv = surface->implied_volatility(call->strike, call->expiration_date);
+    const double put_iv = surface->implied_volatility(put->strike, put->expiration_date);
+    for (const double iv : {call_iv, put_iv}) {
+        if (iv < config_.min_implied_vol || iv > config_.max_implied_vol) {
+            return false;
+        }
+    }
+
+    const double spot = underlying_tick.midpoint().to_double();
+    const data::Price premium = entry_price(*call) + entry_price(*put);
+    if (premium.value <= 0 || premium.to_double() > spot * config_.max_premium_pct) {
+        return false;
+    }
+
+    StraddlePosition position{};
+    position.position_id = next_position_id_.fetch_add(1, std::memory_order_relaxed);
+    position.symbol_id = symbol_id;
+    position.entry_time = current_time_;
+    position.underlying_entry_price = underlying_tick.midpoint();
+    position.call_strike = call->strike;
+    position.put_strike = put->strike;
+    position.call_entry_price = entry_price(*call);
+    position.put_entry_price = entry_price(*put);
+    position.total_premium_paid = premium;
+    position.status = PositionStatus::ACTIVE;
+    position.last_update = current_time_;
+    position.current_call_price = mark_price(*call);
+    position.current_put_price = mark_price(*put);
+    position.current_underlying_price = underlying_tick.midpoint();
+    position.expiration_date = call->expiration_date;
+    position.days_to_expiry = call->days_to_expiry;
+    position.implied_volatility = 0.5 * (call_iv + put_iv);
+    position.profit_target = data::Price::from_double(premium.to_double() * (1.0 + config_.profit_target_pct),
+                                                      data::Rounding::NEAREST);
+    position.stop_loss = data::Price::from_double(premium.to_double() * (1.0 - config_.stop_loss_pct),
+                                                  data::Rounding::NEAREST);
+    position.days_held = 0;
+    position.max_hold_days = config_.max_hold_days;
+    position.call_symbol_id = call->symbol_id;
+    position.put_symbol_id = put->symbol_id;
+
+    if (!validate_position_parameters(position)) {
+        return false;
+    }
+    update_position(position);
+
+    if (positions_.full()) {
+        return false;   // Check before anything goes to market
+    }
+    if (risk_manager_ &&
+        !risk_manager_->can_open_position(symbol_id, premium.to_double() * CONTRACT_MULTIPLIER)) {
+        return false;
+    }
+    if (order_router_) {
+        position.order_pair_id = order_router_->submit_straddle(execution::Side::BUY, call->symbol_id,
+                                                                position.call_entry_price, put->symbol_id,
+                                                                position.put_entry_price, 1);
+        if (position.order_pair_id == 0) {
+            return false;
+        }
+        position.status = PositionStatus::ENTRY_PENDING;
+    }
+    positions_.open(position);   // Not full: checked above, and only this thread opens
+    report_symbol_risk(symbol_id);
+    if (order_router_) {
+        process_order_reports();
+    } else {
+        log_trade_execution(position, data::JournalEvent::POSITION_OPEN);
+    }
+    return true;
+}
+
+void StraddleStrategy::report_symbol_risk(uint32_t symbol_id) {
+    if (risk_manager_) {
+        risk_manager_->update_symbol_risk(symbol_id, positions_.symbol_exposure(symbol_id));
+    }
+}
+
+void StraddleStrategy::update_position(StraddlePosition& position) {
+    position.last_update = current_time_;
+    const double held_ns = current_time_.nanoseconds_since_epoch > position.entry_time.nanoseconds_since_epoch
+        ? static_cast<double>(current_time_.nanoseconds_since_epoch - position.entry_time.nanoseconds_since_epoch)
+        : 0.0;
+    position.days_held = static_cast<uint16_t>(std::min(held_ns / NS_PER_DAY, 65535.0));
+
+    const data::Price pnl = position.calculate_pnl();
+    position.unrealized_pnl = pnl;
+    if (pnl > position.max_profit) position.max_profit = pnl;
+    if (pnl < position.max_loss) position.max_loss = pnl;
+
+    const double S = position.current_underlying_price.to_double();
+    const double T = position.days_to_expiry / 365.0;
+    const double sigma = position.implied_volatility;
+    const double Kc = position.call_strike.to_double();
+    const double Kp = position.put_strike.to_double();
+    position.delta = OptionsCalculator::calculate_delta(S, Kc, T, RISK_FREE_RATE, sigma, true) +
+                     OptionsCalculator::calculate_delta(S, Kp, T, RISK_FREE_RATE, sigma, false);
+    position.gamma = OptionsCalculator::calculate_gamma(S, Kc, T, RISK_FREE_RATE, sigma) +
+                     OptionsCalculator::calculate_gamma(S, Kp, T, RISK_FREE_RATE, sigma);
+    position.theta = OptionsCalculator::calculate_theta(S, Kc, T, RISK_FREE_RATE, sigma, true) +
+                     OptionsCalculator::calculate_theta(S, Kp, T, RISK_FREE_RATE, sigma, false);
+    position.vega = OptionsCalculator::calculate_vega(S, Kc, T, RISK_FREE_RATE, sigma) +
+                    OptionsCalculator::calculate_vega(S, Kp, T, RISK_FREE_RATE, sigma);
+}
+
+bool StraddleStrategy::should_close_position(const StraddlePosition& position) const {
+    return position.should_close();
+}
+
+// position must be an open slot of positions_. Without a router the slot
+// is free on return; with one the position waits EXIT_PENDING for its
+// send report
+void StraddleStrategy::close_position(StraddlePosition& position) {
+    if (!order_router_) {
+        realize_close(position);
+        return;
+    }
+
+    // Exit both legs at their marks; if the router is saturated the
+    // position stays open and is retried on the next update
+    const uint64_t pair_id = order_router_->submit_straddle(
+        execution::Side::SELL, position.call_symbol_id, position.current_call_price,
+        position.put_symbol_id, position.current_put_price, 1);
+    if (pair_id == 0) {
+        return;
+    }
+    positions_.modify(position, [pair_id](StraddlePosition& p) {
+        p.status = PositionStatus::EXIT_PENDING;
+        p.order_pair_id = pair_id;
+    });
+    process_order_reports();
+}
+
+void StraddleStrategy::realize_close(StraddlePosition& position) {
+    positions_.modify(position, [](StraddlePosition& p) {
+        p.realized_pnl = p.calculate_pnl();
+        p.unrealized_pnl = data::Price();
+    });
+
+    // Price and PnlCounter share a scale, so dollar P&L stays exact
+    const int64_t pnl = position.realized_pnl.value * static_cast<int64_t>(CONTRACT_MULTIPLIER);
+    total_trades_.fetch_add(1, std::memory_order_relaxed);
+    if (pnl > 0) {
+        winning_trades_.fetch_add(1, std::memory_order_relaxed);
+    }
+    total_pnl_.add(pnl);
+
+    // Running return moments for the Sharpe ratio (strategy thread is the only writer)
+    const double premium = position.total_premium_paid.to_double();
+    const double r = premium > 0.0 ? position.realized_pnl.to_double() / premium : 0.0;
+    trade_return_sum_.store(trade_return_sum_.load(std::memory_order_relaxed) + r, std::memory_order_relaxed);
+    trade_return_sq_sum_.store(trade_return_sq_sum_.load(std::memory_order_relaxed) + r * r,
+                               std::memory_order_relaxed);
+
+    log_trade_execution(position, data::JournalEvent::POSITION_CLOSE);
+    positions_.close(position);
+
+    update_performance_metrics();
+}
+
+// Send thread outcomes for pending entries and exits. Without a send
+// thread, poll() writes the queued pairs here first.
+void StraddleStrategy::process_order_reports() {
+    if (!order_router_) {
+        return;
+    }
+    order_router_->poll();
+    execution::SendReport reports[16];
+    for (size_t n; (n = order_router_->take_reports(reports, std::size(reports))) != 0;) {
+        for (size_t i = 0; i < n; ++i) {
+            apply_order_report(reports[i].submission_id, reports[i].result == execution::SendResult::SENT);
+        }
+    }
+}
+
+// A sent entry becomes ACTIVE and a sent exit is realized. An entry that
+// never reached the wire is rolled back; an exit goes back to ACTIVE and
+// is retried on the position's next update.
+void StraddleStrategy::apply_order_report(uint64_t pair_id, bool sent) {
+    positions_.for_each_active([&](StraddlePosition& position) {
+        if (position.order_pair_id != pair_id) {
+            return;
+        }
+        const uint32_t symbol_id = position.symbol_id;
+        if (position.status == PositionStatus::EXIT_PENDING && sent) {
+            realize_close(position);
+        } else if (position.status == PositionStatus::ENTRY_PENDING && !sent) {
+            positions_.discard(position);
+        } else {
+            const bool opened = position.status == PositionStatus::ENTRY_PENDING;
+            positions_.modify(position, [](StraddlePosition& p) {
+                p.status = PositionStatus::ACTIVE;
+                p.order_pair_id = 0;
+            });
+            if (opened) {
+                log_trade_execution(position, data::JournalEvent::POSITION_OPEN);
+            }
+        }
+        report_symbol_risk(symbol_id);
+    });
+}
+
+double StraddleStrategy::calculate_expected_profit(const StraddlePosition& position) const {
+    // Expected payoff at expiry if the underlying moves by the forecast volatility
+    const double S = position.current_underlying_price.to_double();
+    const double T = position.days_to_expiry / 365.0;
+    const double sigma = volatility_analyzer_ ? volatility_analyzer_->predict_volatility(position.symbol_id,
+                                                                                          position.days_to_expiry)
+                                              : 0.0;
+    const double vol = sigma > 0.0 ? sigma : position.implied_volatility;
+    const double value = OptionsCalculator::black_scholes_call(S, position.call_strike.to_double(), T, RISK_FREE_RATE, vol) +
+                         OptionsCalculator::black_scholes_put(S, position.put_strike.to_double(), T, RISK_FREE_RATE, vol);
+    return (value - position.total_premium_paid.to_double()) * CONTRACT_MULTIPLIER;
+}
+
+double StraddleStrategy::get_win_rate() const {
+    const uint64_t trades = total_trades_.load(std::memory_order_relaxed);
+    return trades ? static_cast<double>(winning_trades_.load(std::memory_order_relaxed)) / trades : 0.0;
+}
+
+double StraddleStrategy::get_average_trade_pnl() const {
+    const uint64_t trades = total_trades_.load(std::memory_order_relaxed);
+    return trades ? total_pnl_.to_double() / trades : 0.0;
+}
+
+// Per-trade Sharpe: mean over standard deviation of trade returns
+double StraddleStrategy::get_sharpe_ratio() const {
+    const uint64_t n = total_trades_.load(std::memory_order_relaxed);
+    if (n < 2) {
+        return 0.0;
+    }
+    const double sum = trade_return_sum_.load(std::memory_order_relaxed);
+    const double sum_sq = trade_return_sq_sum_.load(std::memory_order_relaxed);
+    const double mean = sum / n;
+    const double variance = (sum_sq - n * mean * mean) / (n - 1);
+    return variance > 0.0 ? mean / std::sqrt(variance) : 0.0;
+}
+
+size_t StraddleStrategy::get_active_positions_count() const {
+    return positions_.size();
+}
+
+size_t StraddleStrategy::snapshot_active_positions(StraddlePosition* out, size_t max) const {
+    return positions_.snapshot_active(out, max);
+}
+
+std::vector<StraddlePosition> StraddleStrategy::get_active_positions() const {
+    std::vector<StraddlePosition> positions(positions_.capacity());
+    positions.resize(positions_.snapshot_active(positions.data(), positions.size()));
+    return positions;
+}
+
+// The most recent closes still held by the journal, oldest first
+std::vector<StraddlePosition> StraddleStrategy::get_closed_positions() const {
+    const uint64_t closed = positions_.closed_count();
+    const uint64_t first = closed > positions_.journal_capacity() ? closed - positions_.journal_capacity() : 0;
+    std::vector<StraddlePosition> positions(static_cast<size_t>(closed - first));
+    positions.resize(positions_.read_closed(first, positions.data(), positions.size()));
+    return positions;
+}
+
+// Drawdown of realized P&L from its running peak (strategy thread only)
+void StraddleStrategy::update_performance_metrics() {
+    const int64_t pnl = total_pnl_.value();
+    peak_pnl_ = std::max(peak_pnl_, pnl);
+    const int64_t drawdown = peak_pnl_ - pnl;
+    if (drawdown > max_drawdown_.load(std::memory_order_relaxed)) {
+        max_drawdown_.store(drawdown, std::memory_order_relaxed);
+    }
+}
+
+bool StraddleStrategy::validate_position_parameters(const StraddlePosition& position) const {
+    return position.call_strike.value > 0 &&
+           position.put_strike.value > 0 &&
+           !(position.call_strike < position.put_strike) &&
+           position.total_premium_paid.value > 0 &&
+           position.implied_volatility > 0.0 &&
+           position.days_to_expiry > 0;
+}
+
+void StraddleStrategy::log_trade_execution(const StraddlePosition& position, data::JournalEvent event) {
+    if (!trade_journal_ && !config_.enable_trade_logging) {
+        return;
+    }
+    data::JournalRecord record;
+    record.timestamp_ns = position.last_update.nanoseconds_since_epoch;
+    record.position_id = position.position_id;
+    record.symbol_id = position.symbol_id;
+    record.event = event;
+    std::fill(std::begin(record.reserved), std::end(record.reserved), uint8_t{0});
+    record.call_strike = position.call_strike;
+    record.put_strike = position.put_strike;
+    record.premium = position.total_premium_paid;
+    record.value = position.calculate_position_value();
+    record.pnl.value = position.calculate_pnl().value * static_cast<int64_t>(CONTRACT_MULTIPLIER);
+
+    if (trade_journal_) {
+        trade_journal_->record(record);
+        return;
+    }
+    // No journal: format here, on the stack, and write in one call
+    char line[256];
+    const size_t length = data::format_record(record, line, sizeof(line) - 1);
+    line[length] = '\n';
+    std::clog.write(line, static_cast<std::streamsize>(length + 1));
+}
+
+} // namespace hft::strategy
@@ -0,0 +1,177 @@
+/*
+ * ===================================================================
+ *                        SYMBOL ID MAPPING
+ * ===================================================================
+ */
+
+#include "../include/symbol_mapper.h"
+#include <algorithm>
+
+namespace hft::data {
+
+std::string SymbolKey::to_string() const {
+    std::string symbol;
+    for (size_t i = 0; i < MAX_LENGTH; ++i) {
+        const char c = static_cast<char>((value >> (8 * i)) & 0xFF);
+        if (c == '\0') break;
+        symbol.push_back(c);
+    }
+    return symbol;
+}
+
+SymbolMapper::~SymbolMapper() = default;
+
+uint32_t SymbolMapper::find_in_table(uint64_t key) const {
+    size_t index = slot_index(key);
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        const Slot& slot = table_[index];
+        const uint64_t stored = slot.key.load(std::memory_order_acquire);
+        if (stored == key) {
+            return slot.id.load(std::memory_order_relaxed);
+        }
+        if (stored == 0) {
+            return 0;
+        }
+        index = (index + 1) & TABLE_MASK;
+    }
+    return 0;
+}
+
+uint32_t SymbolMapper::find_id(SymbolKey key) const {
+    if (!key.valid()) {
+        return 0;
+    }
+    if (const PerfectHash* frozen = frozen_.load(std::memory_order_acquire)) {
+        if (const uint32_t id = frozen->find(key.value)) {
+            return id;
+        }
+    }
+    return find_in_table(key.value);
+}
+
+uint32_t SymbolMapper::get_id(SymbolKey key) {
+    if (const uint32_t id = find_id(key)) {
+        return id;
+    }
+    if (!key.valid()) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(registration_mutex_);
+    return insert_locked(key);
+}
+
+uint32_t SymbolMapper::insert_locked(SymbolKey key) {
+    // Another thread may have registered it while we waited for the lock
+    if (const uint32_t id = find_in_table(key.value)) {
+        return id;
+    }
+
+    const uint32_t count = count_.load(std::memory_order_relaxed);
+    if (count >= MAX_IDS) {
+        return 0;  // Universe full
+    }
+    const uint32_t id = count + 1;
+
+    id_to_symbol_[id] = key.to_string();
+    id_to_key_[id].store(key.value, std::memory_order_relaxed);
+
+    size_t index = slot_index(key.value);
+    while (table_[index].key.load(std::memory_order_relaxed) != 0) {
+        index = (index + 1) & TABLE_MASK;
+    }
+    // Count first so an id found through the table always resolves in get_symbol
+    count_.store(id, std::memory_order_release);
+    table_[index].id.store(id, std::memory_order_relaxed);
+    table_[index].key.store(key.value, std::memory_order_release);
+    return id;
+}
+
+const std::string& SymbolMapper::get_symbol(uint32_t id) const {
+    static const std::string empty_string = "";
+    return id != 0 && id <= count_.load(std::memory_order_acquire) ? id_to_symbol_[id] : empty_string;
+}
+
+SymbolKey SymbolMapper::get_key(uint32_t id) const {
+    if (id == 0 || id > count_.load(std::memory_order_acquire)) {
+        return SymbolKey();
+    }
+    return SymbolKey(id_to_key_[id].load(std::memory_order_relaxed));
+}
+
+std::unique_ptr<SymbolMapper::PerfectHash> SymbolMapper::build_perfect_hash(
+        const std::vector<std::pair<uint64_t, uint32_t>>& entries) {
+    // Hash and displace: place the fullest buckets first, trying seeds
+    // until each bucket's keys all land in free slots. At two slots per
+    // key a seed is found within a few tries; the table only grows (by
+    // an eighth) if some bucket exhausts its seeds.
+    const size_t buckets = std::max<size_t>(1, (entries.size() + 3) / 4);
+    std::vector<std::vector<size_t>> members(buckets);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        members[reduce(mix(entries[i].first, 0), buckets)].push_back(i);
+    }
+    std::vector<size_t> order(buckets);
+    for (size_t b = 0; b < buckets; ++b) order[b] = b;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return members[a].size() > members[b].size(); });
+
+    constexpr uint32_t MAX_SEED = 1u << 16;
+    for (size_t slots = std::max<size_t>(8, 2 * entries.size());; slots += slots / 8) {
+        auto table = std::make_unique<PerfectHash>();
+        table->seeds.assign(buckets, 0);
+        table->keys.assign(slots, 0);
+        table->ids.assign(slots, 0);
+
+        bool placed_all = true;
+        std::vector<size_t> placed;
+        for (size_t b : order) {
+            if (members[b].empty()) break;
+            uint32_t seed = 1;
+            for (; seed < MAX_SEED; ++seed) {
+                placed.clear();
+                for (size_t i : members[b]) {
+                    const size_t slot = reduce(mix(entries[i].first, seed), slots);
+                    if (table->keys[slot] != 0 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                        break;
+                    }
+                    placed.push_back(slot);
+                }
+                if (placed.size() == members[b].size()) break;
+            }
+            if (seed == MAX_SEED) {
+                placed_all = false;
+                break;
+            }
+            table->seeds[b] = seed;
+            for (size_t k = 0; k < placed.size(); ++k) {
+                table->keys[placed[k]] = entries[members[b][k]].first;
+                table->ids[placed[k]] = entries[members[b][k]].second;
+            }
+        }
+        if (placed_all) {
+            return table;
+        }
+    }
+}
+
+bool SymbolMapper::freeze(const std::vector<std::string>& symbols) {
+    std::lock_guard<std::mutex> lock(registration_mutex_);
+    bool all_registered = true;
+    for (const auto& symbol : symbols) {
+        const SymbolKey key = SymbolKey::from(symbol);
+        all_registered = key.valid() && insert_locked(key) != 0 && all_registered;
+    }
+
+    const uint32_t count = count_.load(std::memory_order_relaxed);
+    std::vector<std::pair<uint64_t, uint32_t>> entries;
+    entries.reserve(count);
+    for (uint32_t id = 1; id <= count; ++id) {
+        entries.emplace_back(id_to_key_[id].load(std::memory_order_relaxed), id);
+    }
+
+    snapshots_.push_back(build_perfect_hash(entries));
+    frozen_.store(snapshots_.back().get(), std::memory_order_release);
+    return all_registered;
+}
+
+} // namespace hft::data
@@ -0,0 +1,696 @@
+/*
+ * ===================================================================
+ *                      TECH STOCK SELECTOR MODULE
+ * ===================================================================
+ */
+
+#include "../include/tech_stock_selector.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <thread>
+#include <utility>
+
+namespace hft::selection {
+
+namespace {
+
+// Quote fields that feed the scores; padding is never compared
+bool same_quote(const data::MarketTick& a, const data::MarketTick& b) {
+    return a.timestamp.nanoseconds_since_epoch == b.timestamp.nanoseconds_since_epoch &&
+           a.sequence_number == b.sequence_number &&
+           a.bid.value == b.bid.value && a.ask.value == b.ask.value && a.last.value == b.last.value &&
+           a.bid_size == b.bid_size && a.ask_size == b.ask_size && a.volume == b.volume;
+}
+
+bool same_options(const OptionsChainSnapshot& a, const OptionsChainSnapshot& b) {
+    return a.revision == b.revision && a.front_strikes == b.front_strikes &&
+           a.front_two_sided == b.front_two_sided && a.front_spread_pct == b.front_spread_pct;
+}
+
+// Front-expiry spread; fallback (the fundamentals average, same units as
+// Config::max_bid_ask_spread) when there are no two-sided front quotes
+double front_expiry_spread(const OptionsChainSnapshot* options, double fallback) {
+    return options && options->front_two_sided ? options->front_spread_pct : fallback;
+}
+
+double log10_floor(double v) {
+    return std::log10(std::max(v, 1.0));
+}
+
+} // namespace
+
+// Mean relative bid-ask spread over the two-sided quotes of the front expiry
+OptionsChainSnapshot OptionsChainSnapshot::of(const data::OptionsChain& chain) {
+    OptionsChainSnapshot snapshot;
+    snapshot.revision = chain.revision();
+    if (chain.expiry_count() == 0) {
+        return snapshot;
+    }
+    snapshot.front_strikes = chain.strike_count(0);
+    double sum = 0.0;
+    for (size_t i = 0; i < snapshot.front_strikes; ++i) {
+        for (uint8_t type : {data::OptionsChain::CALL, data::OptionsChain::PUT}) {
+            const data::OptionTick* q = chain.quote(0, i, type);
+            if (q && q->bid.value > 0 && q->ask.value > q->bid.value) {
+                sum += 2.0 * (q->ask.value - q->bid.value) / static_cast<double>(q->ask.value + q->bid.value);
+                ++snapshot.front_two_sided;
+            }
+        }
+    }
+    snapshot.front_spread_pct = snapshot.front_two_sided ? sum / snapshot.front_two_sided : 0.0;
+    return snapshot;
+}
+
+// ===================================================================
+//                        TECH STOCK UNIVERSE
+// ===================================================================
+
+TechStockUniverse::TechStockUniverse() {
+    initialize_universe();
+}
+
+void TechStockUniverse::initialize_universe() {
+    active_universe_ = get_all_stocks();
+}
+
+void TechStockUniverse::update_fundamentals(const std::string& symbol, const StockFundamentals& data) {
+    FundamentalsEntry& entry = fundamentals_[symbol];
+    entry.data = data;
+    entry.revision = ++revision_;
+}
+
+void TechStockUniverse::refresh_universe() {
+    // Predefined lists first, then every other symbol with fundamentals
+    active_universe_ = get_all_stocks();
+    std::vector<std::string> extra;
+    for (const auto& [symbol, entry] : fundamentals_) {
+        if (std::find(active_universe_.begin(), active_universe_.end(), symbol) == active_universe_.end()) {
+            extra.push_back(symbol);
+        }
+    }
+    std::sort(extra.begin(), extra.end());
+    active_universe_.insert(active_universe_.end(), extra.begin(), extra.end());
+}
+
+std::vector<std::string> TechStockUniverse::get_all_stocks() const {
+    std::vector<std::string> all;
+    for (const auto* list : {&mega_cap_stocks_, &large_cap_stocks_, &mid_cap_stocks_, &ai_ml_stocks_, &cloud_stocks_}) {
+        for (const std::string& symbol : *list) {
+            if (std::find(all.begin(), all.end(), symbol) == all.end()) {
+                all.push_back(symbol);
+            }
+        }
+    }
+    return all;
+}
+
+std::vector<std::string> TechStockUniverse::get_stocks_by_category(StockCategory category) const {
+    std::vector<std::string> stocks;
+    switch (category) {
+        case StockCategory::MEGA_CAP:  stocks = mega_cap_stocks_; break;
+        case StockCategory::LARGE_CAP: stocks = large_cap_stocks_; break;
+        case StockCategory::MID_CAP:   stocks = mid_cap_stocks_; break;
+        default: break;
+    }
+    std::vector<std::string> extra;
+    for (const auto& [symbol, entry] : fundamentals_) {
+        if (entry.data.category == category &&
+            std::find(stocks.begin(), stocks.end(), symbol) == stocks.end()) {
+            extra.push_back(symbol);
+        }
+    }
+    std::sort(extra.begin(), extra.end());
+    stocks.insert(stocks.end(), extra.begin(), extra.end());
+    return stocks;
+}
+
+bool TechStockUniverse::get_fundamentals(const std::string& symbol, StockFundamentals& data) const {
+    auto it = fundamentals_.find(symbol);
+    if (it == fundamentals_.end()) {
+        return false;
+    }
+    data = it->second.data;
+    return true;
+}
+
+const StockFundamentals* TechStockUniverse::find_fundamentals(const std::string& symbol, uint64_t& revision) const {
+    auto it = fundamentals_.find(symbol);
+    if (it == fundamentals_.end()) {
+        return nullptr;
+    }
+    revision = it->second.revision;
+    return &it->second.data;
+}
+
+double TechStockUniverse::get_average_market_cap() const {
+    double sum = 0.0;
+    for (const auto& [symbol, entry] : fundamentals_) sum += entry.data.market_cap;
+    return fundamentals_.empty() ? 0.0 : sum / fundamentals_.size();
+}
+
+double TechStockUniverse::get_average_volume() const {
+    double sum = 0.0;
+    for (const auto& [symbol, entry] : fundamentals_) sum += entry.data.avg_daily_volume_3m;
+    return fundamentals_.empty() ? 0.0 : sum / fundamentals_.size();
+}
+
+// ===================================================================
+//                        TECH STOCK SELECTOR
+// ===================================================================
+
+TechStockSelector::TechStockSelector(const Config& config)
+    : config_(config),
+      candidates_(constants::MAX_SYMBOLS) {}
+
+TechStockSelector::~TechStockSelector() {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        pool_stop_ = true;
+    }
+    pool_wake_.notify_all();
+    for (auto& thread : pool_) {
+        thread.join();
+    }
+}
+
+bool TechStockSelector::initialize() {
+    if (!universe_) {
+        universe_ = std::make_unique<TechStockUniverse>();
+    }
+    active_.reserve(constants::MAX_SYMBOLS);
+    dirty_.reserve(constants::MAX_SYMBOLS);
+    return config_.max_selections > 0;
+}
+
+void TechStockSelector::set_market_data_callback(std::function<bool(const std::string&, data::MarketTick&)> callback) {
+    market_data_callback_ = std::move(callback);
+}
+
+void TechStockSelector::set_options_chain_provider(OptionsChainProvider provider) {
+    options_chain_provider_ = std::move(provider);
+}
+
+// Pull one symbol's inputs and flag what changed since it was scored
+void TechStockSelector::gather_inputs(Candidate& c) {
+    uint64_t revision = 0;
+    const StockFundamentals* fundamentals = universe_->find_fundamentals(c.symbol, revision);
+    if (fundamentals && (!c.has_fundamentals || revision != c.fundamentals_revision)) {
+        c.fundamentals = *fundamentals;
+        c.fundamentals_revision = revision;
+        c.has_fundamentals = true;
+        c.changed |= FUNDAMENTALS_CHANGED;
+    } else if (!fundamentals && c.has_fundamentals) {
+        c.has_fundamentals = false;
+        c.changed |= FUNDAMENTALS_CHANGED;
+    }
+
+    data::MarketTick tick;
+    const bool has_tick = market_data_callback_ && market_data_callback_(c.symbol, tick);
+    if (has_tick != c.has_tick || (has_tick && !same_quote(tick, c.tick))) {
+        c.tick = tick;
+        c.has_tick = has_tick;
+        c.changed |= MARKET_CHANGED;
+    }
+
+    OptionsChainSnapshot options;
+    const bool has_options = options_chain_provider_ && options_chain_provider_(c.symbol, options);
+    if (has_options != c.has_options || (has_options && !same_options(options, c.options))) {
+        c.options = options;
+        c.has_options = has_options;
+        c.changed |= OPTIONS_CHANGED;
+    }
+
+    if (config_changed_) {
+        c.changed = ALL_CHANGED;
+    }
+    if (c.changed) {
+        dirty_.push_back(&c);
+    }
+}
+
+// Recompute only the components whose inputs changed
+void TechStockSelector::score(Candidate& c) const {
+    const StockFundamentals& f = c.fundamentals;
+    const bool fundamentals = c.has_fundamentals;
+
+    if (c.changed & (FUNDAMENTALS_CHANGED | MARKET_CHANGED)) {
+        const bool both = fundamentals && c.has_tick;
+        c.liquidity_score = both ? calculate_liquidity_score(f, c.tick) : 0.0;
+        c.passes_liquidity = both && passes_liquidity_filter(f, c.tick);
+    }
+    if (c.changed & FUNDAMENTALS_CHANGED) {
+        c.volatility_score = fundamentals ? calculate_volatility_score(f) : 0.0;
+        c.fundamental_score = fundamentals ? calculate_fundamental_score(f) : 0.0;
+        c.timing_score = fundamentals ? calculate_timing_score(f) : 0.0;
+        c.passes_volatility = fundamentals && passes_volatility_filter(f);
+        c.passes_timing = fundamentals && passes_timing_filter(f);
+    }
+    if (c.changed & (FUNDAMENTALS_CHANGED | OPTIONS_CHANGED)) {
+        const OptionsChainSnapshot* options = c.has_options ? &c.options : nullptr;
+        c.options_activity_score = fundamentals ? calculate_options_activity_score(f, options) : 0.0;
+        c.passes_options = fundamentals && passes_options_filter(f, options);
+    }
+    if (c.changed & MARKET_CHANGED) {
+        c.technical_score = c.has_tick ? calculate_technical_score(c.symbol, c.tick) : 0.0;
+    }
+    c.changed = 0;
+
+    c.total_score = config_.liquidity_weight * c.liquidity_score +
+                    config_.volatility_weight * c.volatility_score +
+                    config_.options_weight * c.options_activity_score +
+                    config_.fundamental_weight * c.fundamental_score +
+                    config_.technical_weight * c.technical_score +
+                    config_.timing_weight * c.timing_score;
+    c.is_tradeable = c.passes_liquidity && c.passes_options && c.passes_volatility && c.passes_timing &&
+                     c.total_score >= config_.min_total_score;
+}
+
+void TechStockSelector::score_dirty() {
+    const size_t count = dirty_.size();
+    size_t threads = config_.num_threads ? config_.num_threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, count / std::max<size_t>(config_.min_symbols_per_thread, 1));
+    if (threads <= 1) {
+        for (Candidate* c : dirty_) score(*c);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex_);
+        while (pool_.size() < threads - 1) {
+            pool_.emplace_back(&TechStockSelector::pool_worker, this, pool_.size());
+        }
+        next_dirty_.store(0, std::memory_order_relaxed);
+        pool_active_ = threads - 1;
+        pool_busy_ = threads - 1;
+        ++pool_round_;
+    }
+    pool_wake_.notify_all();
+    score_chunks();
+
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    pool_done_.wait(lock, [this] { return pool_busy_ == 0; });
+}
+
+// Small chunks off a shared cursor; candidates are disjoint, so the
+// threads only share the read-only config
+void TechStockSelector::score_chunks() {
+    constexpr size_t CHUNK = 16;
+    const size_t count = dirty_.size();
+    for (size_t begin; (begin = next_dirty_.fetch_add(CHUNK, std::memory_order_relaxed)) < count;) {
+        const size_t end = std::min(begin + CHUNK, count);
+        for (size_t i = begin; i < end; ++i) score(*dirty_[i]);
+    }
+}
+
+// Parked between rounds; sits a round out when the caller wants fewer workers
+void TechStockSelector::pool_worker(size_t index) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(pool_mutex_);
+    for (;;) {
+        pool_wake_.wait(lock, [&] { return pool_stop_ || pool_round_ != seen; });
+        if (pool_stop_) {
+            return;
+        }
+        seen = pool_round_;
+        if (index >= pool_active_) {
+            continue;
+        }
+        lock.unlock();
+        score_chunks();
+        lock.lock();
+        if (--pool_busy_ == 0) {
+            pool_done_.notify_one();
+        }
+    }
+}
+
+std::vector<SelectionScore> TechStockSelector::select_best_candidates() {
+    if (!universe_) {
+        return {};
+    }
+    ++cycle_;
+    active_.clear();
+    dirty_.clear();
+    for (const std::string& symbol : universe_->get_active_universe()) {
+        const uint32_t id = ids_.get_id(symbol);
+        if (id == 0) {
+            continue;   // Unmappable symbol or universe full
+        }
+        auto& slot = candidates_[id];
+        if (!slot) {
+            slot = std::make_unique<Candidate>();
+            slot->symbol = symbol;
+        }
+        if (slot->cycle == cycle_) {
+            continue;   // Listed twice
+        }
+        slot->cycle = cycle_;
+        active_.push_back(slot.get());
+        gather_inputs(*slot);
+    }
+    config_changed_ = false;
+    score_dirty();
+    symbols_rescored_ += dirty_.size();
+
+    // Top k tradeable by score; symbol breaks ties so the order is stable
+    std::vector<const Candidate*> ranked;
+    ranked.reserve(active_.size());
+    for (const Candidate* c : active_) {
+        if (c->is_tradeable) ranked.push_back(c);
+    }
+    const size_t k = std::min(config_.max_selections, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + k, ranked.end(),
+                      [](const Candidate* a, const Candidate* b) {
+                          return a->total_score != b->total_score ? a->total_score > b->total_score
+                                                                  : a->symbol < b->symbol;
+                      });
+
+    last_selection_.clear();
+    for (size_t i = 0; i < k; ++i) {
+        last_selection_.push_back(create_selection_score(*ranked[i], static_cast<int>(i + 1)));
+    }
+    last_selection_time_ = data::Timestamp::now();
+    selection_valid_.store(true);
+    return last_selection_;
+}
+
+// At most max_selections symbols, from the last selection (run if none)
+std::vector<std::string> TechStockSelector::get_top_symbols(size_t count) {
+    if (!selection_valid_.load()) {
+        select_best_candidates();
+    }
+    std::vector<std::string> symbols;
+    for (size_t i = 0; i < std::min(count, last_selection_.size()); ++i) {
+        symbols.push_back(last_selection_[i].symbol);
+    }
+    return symbols;
+}
+
+double TechStockSelector::calculate_liquidity_score(const StockFundamentals& stock,
+                                                    const data::MarketTick& market_data) const {
+    const double cap_floor = log10_floor(config_.min_market_cap);
+    const double cap = normalize_score(log10_floor(stock.market_cap), cap_floor, cap_floor + 2.0);
+    const double volume = normalize_score(stock.avg_daily_volume_3m, config_.min_avg_volume, 10.0 * config_.min_avg_volume);
+    const double dollar = normalize_score(stock.avg_daily_dollar_volume, config_.min_dollar_volume,
+                                          20.0 * config_.min_dollar_volume);
+    const double spread = normalize_score(-market_data.spread_pct(), -0.10, 0.0);   // 10bp or wider scores 0
+    return 0.30 * cap + 0.25 * volume + 0.25 * dollar + 0.20 * spread;
+}
+
+double TechStockSelector::calculate_volatility_score(const StockFundamentals& stock) const {
+    const double iv = stock.avg_implied_volatility;
+    const double cheapness = iv > 0.0 ? normalize_score(stock.historical_vol_30d / iv, 0.5, 1.5) : 0.0;
+    const double in_band = iv >= config_.min_implied_vol && iv <= config_.max_implied_vol ? 100.0 : 0.0;
+    const double vol_of_vol = normalize_score(stock.vol_of_vol, config_.min_vol_of_vol, 5.0 * config_.min_vol_of_vol);
+    const double realized_trend = stock.historical_vol_90d > 0.0
+        ? normalize_score(stock.historical_vol_30d / stock.historical_vol_90d, 0.8, 1.25)
+        : 50.0;
+    return 0.4 * cheapness + 0.2 * in_band + 0.2 * vol_of_vol + 0.2 * realized_trend;
+}
+
+double TechStockSelector::calculate_options_activity_score(const StockFundamentals& stock,
+                                                           const OptionsChainSnapshot* options) const {
+    const double volume_floor = log10_floor(config_.min_options_volume);
+    const double volume = normalize_score(log10_floor(stock.avg_options_volume), volume_floor, volume_floor + 2.0);
+    const double open_interest = normalize_score(log10_floor(stock.avg_options_open_int), volume_floor + 1.0,
+                                                 volume_floor + 3.0);
+    const double spread_pct = front_expiry_spread(options, stock.avg_bid_ask_spread_pct);
+    const double spread = normalize_score(config_.max_bid_ask_spread - spread_pct, 0.0, config_.max_bid_ask_spread);
+    const double depth = options && options->front_strikes
+        ? normalize_score(static_cast<double>(options->front_strikes), 5.0, 50.0)
+        : 0.0;
+    return 0.35 * volume + 0.20 * open_interest + 0.30 * spread + 0.15 * depth;
+}
+
+double TechStockSelector::calculate_fundamental_score(const StockFundamentals& stock) const {
+    const double cap_floor = log10_floor(config_.min_market_cap);
+    const double cap = normalize_score(log10_floor(stock.market_cap), cap_floor, cap_floor + 2.0);
+    const double float_ratio = stock.shares_outstanding > 0.0
+        ? normalize_score(stock.free_float / stock.shares_outstanding, 0.5, 1.0)
+        : 0.0;
+    const double beta = normalize_score(stock.beta, 0.8, 1.8);
+    return 0.4 * cap + 0.3 * float_ratio + 0.3 * beta;
+}
+
+double TechStockSelector::calculate_technical_score(const std::string&, const data::MarketTick& market_data) const {
+    // Balanced book and a last trade inside the quote
+    const double sizes = static_cast<double>(market_data.bid_size) + market_data.ask_size;
+    const double balance = sizes > 0.0
+        ? 100.0 * (1.0 - std::abs(static_cast<double>(market_data.bid_size) - market_data.ask_size) / sizes)
+        : 0.0;
+    const bool last_inside = market_data.last.value >= market_data.bid.value &&
+                             market_data.last.value <= market_data.ask.value;
+    return 0.6 * balance + (last_inside ? 40.0 : 0.0);
+}
+
+double TechStockSelector::calculate_timing_score(const StockFundamentals& stock) const {
+    // Best just outside the minimum lead time to earnings, fading to half
+    // at the maximum; too close means the event premium is already priced
+    const int days = stock.days_to_earnings;
+    double score;
+    if (days < config_.min_days_to_earnings) {
+        score = 0.0;
+    } else if (days > config_.max_days_to_earnings) {
+        score = 25.0;
+    } else {
+        score = 100.0 - 0.5 * normalize_score(days, config_.min_days_to_earnings, config_.max_days_to_earnings);
+    }
+    return std::min(100.0, score + (stock.has_upcoming_events ? 10.0 : 0.0));
+}
+
+bool TechStockSelector::passes_liquidity_filter(const StockFundamentals& stock,
+                                                const data::MarketTick& market_data) const {
+    return stock.market_cap >= config_.min_market_cap &&
+           stock.avg_daily_volume_3m >= config_.min_avg_volume &&
+           stock.avg_daily_dollar_volume >= config_.min_dollar_volume &&
+           market_data.bid.value > 0 && market_data.ask.value >= market_data.bid.value;
+}
+
+bool TechStockSelector::passes_options_filter(const StockFundamentals& stock,
+                                              const OptionsChainSnapshot* options) const {
+    return stock.avg_options_volume >= config_.min_options_volume &&
+           front_expiry_spread(options, stock.avg_bid_ask_spread_pct) <= config_.max_bid_ask_spread;
+}
+
+bool TechStockSelector::passes_volatility_filter(const StockFundamentals& stock) const {
+    return stock.avg_implied_volatility >= config_.min_implied_vol &&
+           stock.avg_implied_volatility <= config_.max_implied_vol &&
+           stock.historical_vol_30d >= config_.min_historical_vol &&
+           stock.historical_vol_30d <= config_.max_historical_vol;
+}
+
+bool TechStockSelector::passes_timing_filter(const StockFundamentals& stock) const {
+    return !(config_.avoid_earnings_week && is_earnings_week(stock));
+}
+
+bool TechStockSelector::is_earnings_week(const StockFundamentals& stock) const {
+    return stock.days_to_earnings >= 0 && stock.days_to_earnings <= 7;
+}
+
+double TechStockSelector::normalize_score(double value, double min_val, double max_val) const {
+    return max_val > min_val ? 100.0 * std::clamp((value - min_val) / (max_val - min_val), 0.0, 1.0) : 0.0;
+}
+
+SelectionScore TechStockSelector::create_selection_score(const Candidate& c, int rank) const {
+    SelectionScore score;
+    score.symbol = c.symbol;
+    score.total_score = c.total_score;
+    score.liquidity_score = c.liquidity_score;
+    score.volatility_score = c.volatility_score;
+    score.options_activity_score = c.options_activity_score;
+    score.fundamental_score = c.fundamental_score;
+    score.technical_score = c.technical_score;
+    score.timing_score = c.timing_score;
+    score.rank = rank;
+    score.is_tradeable = c.is_tradeable;
+
+    // Name the component contributing most to the total
+    const std::pair<double, const char*> components[] = {
+        {config_.liquidity_weight * c.liquidity_score, "liquidity"},
+        {config_.volatility_weight * c.volatility_score, "volatility"},
+        {config_.options_weight * c.options_activity_score, "options activity"},
+        {config_.fundamental_weight * c.fundamental_score, "fundamentals"},
+        {config_.technical_weight * c.technical_score, "technicals"},
+        {config_.timing_weight * c.timing_score, "timing"},
+    };
+    const auto* best = std::max_element(std::begin(components), std::end(components));
+    score.selection_reason = std::string("led by ") + best->second;
+    return score;
+}
+
+// ===================================================================
+//                        VOLATILITY RANKER
+// ===================================================================
+
+static_assert(VolatilityRanker::HISTORY_WINDOW >= VolatilityRanker::TREND_WINDOW,
+              "trend samples are read back from the IV window");
+
+VolatilityRanker::VolatilityRanker()
+    : history_(constants::MAX_SYMBOLS),
+      metrics_(constants::MAX_SYMBOLS) {}
+
+void VolatilityRanker::update_volatility_data(const std::string& symbol,
+                                              double implied_vol,
+                                              double historical_vol) {
+    if (!(implied_vol > 0.0) || !std::isfinite(implied_vol)) {
+        return;
+    }
+    const uint32_t id = ids_.get_id(symbol);
+    if (id == 0) {
+        return;   // Unmappable symbol or universe full
+    }
+    auto& slot = history_[id];
+    if (!slot) {
+        slot = std::make_unique<History>();
+        metrics_[id].symbol = symbol;
+    }
+    History& h = *slot;
+
+    add_trend_sample(h, implied_vol);
+    h.iv.push(implied_vol);
+    if (historical_vol > 0.0 && std::isfinite(historical_vol)) {
+        h.hv.push(historical_vol);
+    }
+    refresh_metrics(h, metrics_[id]);
+}
+
+// Slide the regression window before the new IV lands in the history
+void VolatilityRanker::add_trend_sample(History& h, double iv) {
+    const size_t n = std::min(h.iv.size(), TREND_WINDOW);
+    if (n < TREND_WINDOW) {
+        h.trend_sum += iv;
+        h.trend_xy_sum += n * iv;
+        return;
+    }
+
+    // Every retained sample moves one step left; the new one lands at W-1
+    const double old = h.iv.recent(TREND_WINDOW - 1);
+    h.trend_xy_sum += (TREND_WINDOW - 1) * iv - (h.trend_sum - old);
+    h.trend_sum += iv - old;
+
+    if (h.trend_resync.due()) {
+        h.trend_sum = iv;
+        h.trend_xy_sum = (TREND_WINDOW - 1) * iv;
+        for (size_t x = 0; x + 1 < TREND_WINDOW; ++x) {
+            const double y = h.iv.recent(TREND_WINDOW - 2 - x);
+            h.trend_sum += y;
+            h.trend_xy_sum += x * y;
+        }
+    }
+}
+
+double VolatilityRanker::trend_slope(const History& h) {
+    const double n = static_cast<double>(std::min(h.iv.size(), TREND_WINDOW));
+    if (n < 2.0) {
+        return 0.0;
+    }
+    const double sum_x = n * (n - 1.0) / 2.0;
+    const double sum_xx = (n - 1.0) * n * (2.0 * n - 1.0) / 6.0;
+    return (n * h.trend_xy_sum - sum_x * h.trend_sum) / (n * sum_xx - sum_x * sum_x);
+}
+
+void VolatilityRanker::refresh_metrics(const History& h, VolatilityMetrics& m) const {
+    m.current_iv = h.iv.newest();
+    m.iv_percentile = 100.0 * h.iv.rank_of(m.current_iv);
+    const double range = h.iv.max() - h.iv.min();
+    m.iv_rank = range > 0.0 ? 100.0 * (m.current_iv - h.iv.min()) / range : 50.0;
+    m.volatility_trend = trend_slope(h);
+
+    if (!h.hv.empty()) {
+        m.hv_current = h.hv.newest();
+        m.hv_percentile = 100.0 * h.hv.rank_of(m.hv_current);
+        m.iv_hv_ratio = m.current_iv / m.hv_current;
+    }
+
+    m.is_low_vol_regime = h.iv.size() >= TREND_WINDOW && m.iv_percentile <= LOW_VOL_PERCENTILE;
+
+    // Cheap against its own history and against realized vol means more
+    // room to expand; the realized term runs from 0 with HV at half of IV
+    // to 100 with HV at twice IV
+    const double realized_premium = m.iv_hv_ratio > 0.0
+        ? std::clamp(100.0 * (1.0 / m.iv_hv_ratio - 0.5) / 1.5, 0.0, 100.0)
+        : 0.0;
+    m.vol_expansion_potential = 0.4 * (100.0 - m.iv_percentile) +
+                                0.3 * (100.0 - m.iv_rank) +
+                                0.3 * realized_premium;
+}
+
+const VolatilityRanker::VolatilityMetrics* VolatilityRanker::find(const std::string& symbol) const {
+    const uint32_t id = ids_.find_id(symbol);
+    return id != 0 && history_[id] ? &metrics_[id] : nullptr;
+}
+
+bool VolatilityRanker::get_volatility_metrics(const std::string& symbol, VolatilityMetrics& metrics) const {
+    const VolatilityMetrics* m = find(symbol);
+    if (!m) {
+        return false;
+    }
+    metrics = *m;
+    return true;
+}
+
+bool VolatilityRanker::is_good_entry(const VolatilityMetrics& m) const {
+    return m.is_low_vol_regime &&
+           m.iv_hv_ratio > 0.0 && m.iv_hv_ratio <= MAX_ENTRY_IV_HV_RATIO &&
+           m.volatility_trend >= 0.0;
+}
+
+bool VolatilityRanker::is_good_straddle_entry(const std::string& symbol) const {
+    const VolatilityMetrics* m = find(symbol);
+    return m && is_good_entry(*m);
+}
+
+double VolatilityRanker::calculate_vol_expansion_probability(const std::string& symbol) const {
+    const VolatilityMetrics* m = find(symbol);
+    return m ? m->vol_expansion_potential / 100.0 : 0.0;
+}
+
+// Gather (key, id) for the requested symbols off the flat metrics array,
+// then one sort; ties keep the caller's order
+template<typename Key, typename Filter>
+std::vector<std::string> VolatilityRanker::rank(const std::vector<std::string>& symbols,
+                                                Key key, Filter filter) const {
+    struct Entry {
+        decltype(key(std::declval<const VolatilityMetrics&>())) value;
+        uint32_t id;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(symbols.size());
+    for (const std::string& symbol : symbols) {
+        const uint32_t id = ids_.find_id(symbol);
+        if (id != 0 && history_[id] && filter(metrics_[id])) {
+            entries.push_back({key(metrics_[id]), id});
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const Entry& a, const Entry& b) { return a.value < b.value; });
+
+    std::vector<std::string> ranked;
+    ranked.reserve(entries.size());
+    for (const Entry& e : entries) {
+        ranked.push_back(metrics_[e.id].symbol);
+    }
+    return ranked;
+}
+
+std::vector<std::string> VolatilityRanker::rank_by_low_volatility(const std::vector<std::string>& symbols) const {
+    // Percentile first, rank to break ties
+    return rank(symbols,
+                [](const VolatilityMetrics& m) { return std::make_pair(m.iv_percentile, m.iv_rank); },
+                [](const VolatilityMetrics&) { return true; });
+}
+
+std::vector<std::string> VolatilityRanker::rank_by_vol_expansion_potential(const std::vector<std::string>& symbols) const {
+    return rank(symbols,
+                [](const VolatilityMetrics& m) { return -m.vol_expansion_potential; },
+                [](const VolatilityMetrics&) { return true; });
+}
+
+std::vector<std::string> VolatilityRanker::get_optimal_straddle_candidates(const std::vector<std::string>& symbols) const {
+    return rank(symbols,
+                [](const VolatilityMetrics& m) { return -m.vol_expansion_potential; },
+                [this](const VolatilityMetrics& m) { return is_good_entry(m); });
+}
+
+} // namespace hft::selection
@@ -0,0 +1,431 @@
+/*
+ * ===================================================================
+ *                  COLUMNAR TICK ARCHIVE (ON DISK)
+ * ===================================================================
+ */
+
+#include "../include/tick_archive.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hft::data {
+
+namespace {
+
+using namespace archive_format;
+
+inline uint64_t zigzag_encode(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzag_decode(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline void put_varint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+// Bounds-checked reader; sets failed_ instead of reading past end
+class VarintReader {
+public:
+    VarintReader(const uint8_t* p, const uint8_t* end) : p_(p), end_(end) {}
+
+    uint64_t next() {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (p_ == end_) {
+                failed_ = true;
+                return 0;
+            }
+            const uint8_t byte = *p_++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        failed_ = true;
+        return 0;
+    }
+
+    bool failed() const { return failed_; }
+
+private:
+    const uint8_t* p_;
+    const uint8_t* end_;
+    bool failed_ = false;
+};
+
+void encode_block(const MarketTick* ticks, size_t n, std::vector<uint8_t>& out) {
+    uint64_t prev_ts = ticks[0].timestamp.nanoseconds_since_epoch;
+    for (size_t i = 0; i < n; ++i) {
+        put_varint(out, ticks[i].timestamp.nanoseconds_since_epoch - prev_ts);
+        prev_ts = ticks[i].timestamp.nanoseconds_since_epoch;
+    }
+
+    auto put_price_column = [&](Price MarketTick::*field) {
+        int64_t prev = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const int64_t value = (ticks[i].*field).value;
+            put_varint(out, zigzag_encode(value - prev));
+            prev = value;
+        }
+    };
+    put_price_column(&MarketTick::bid);
+    put_price_column(&MarketTick::ask);
+    put_price_column(&MarketTick::last);
+
+    for (size_t i = 0; i < n; ++i) put_varint(out, ticks[i].bid_size);
+    for (size_t i = 0; i < n; ++i) put_varint(out, ticks[i].ask_size);
+    for (size_t i = 0; i < n; ++i) put_varint(out, ticks[i].volume);
+
+    int64_t prev_seq = 0;
+    for (size_t i = 0; i < n; ++i) {
+        put_varint(out, zigzag_encode(static_cast<int64_t>(ticks[i].sequence_number) - prev_seq));
+        prev_seq = ticks[i].sequence_number;
+    }
+    for (size_t i = 0; i < n; ++i) put_varint(out, ticks[i].exchange_id);
+}
+
+template<typename T>
+void append_struct(std::vector<uint8_t>& out, const T& value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void pad_to_8(std::vector<uint8_t>& out) {
+    while (out.size() % 8) out.push_back(0);
+}
+
+} // namespace
+
+// ===================================================================
+// TickArchive
+// ===================================================================
+
+TickArchive::~TickArchive() {
+    if (data_) {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+}
+
+std::unique_ptr<TickArchive> TickArchive::open(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(FileHeader)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::unique_ptr<TickArchive> archive(new TickArchive());
+    archive->data_ = static_cast<const uint8_t*>(mapped);
+    archive->size_ = size;
+
+    // Validate every offset once so queries never need to
+    const auto* header = reinterpret_cast<const FileHeader*>(archive->data_);
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->version != VERSION ||
+        header->directory_offset % 8 != 0 ||
+        header->directory_offset > size ||
+        (size - header->directory_offset) / sizeof(SymbolEntry) < header->symbol_count) {
+        return nullptr;
+    }
+
+    archive->directory_ = reinterpret_cast<const SymbolEntry*>(archive->data_ + header->directory_offset);
+    archive->symbol_count_ = header->symbol_count;
+
+    for (size_t s = 0; s < archive->symbol_count_; ++s) {
+        const SymbolEntry& entry = archive->directory_[s];
+        if (entry.index_offset % 8 != 0 || entry.index_offset > size ||
+            (size - entry.index_offset) / sizeof(BlockIndex) < entry.block_count) {
+            return nullptr;
+        }
+        const BlockIndex* blocks = archive->blocks(entry);
+        for (size_t b = 0; b < entry.block_count; ++b) {
+            if (blocks[b].data_offset > size || size - blocks[b].data_offset < blocks[b].data_size ||
+                blocks[b].tick_count == 0 || blocks[b].tick_count > BLOCK_TICKS) {
+                return nullptr;
+            }
+        }
+    }
+
+    madvise(mapped, size, MADV_RANDOM);
+    return archive;
+}
+
+bool TickArchive::write(const std::string& path, const std::vector<ArchiveSeries>& series) {
+    std::vector<uint8_t> file(sizeof(FileHeader), 0);
+    std::vector<SymbolEntry> directory;
+    std::vector<std::vector<BlockIndex>> indexes;
+
+    for (const auto& s : series) {
+        const SymbolKey key = SymbolKey::from(s.symbol);
+        if (!key.valid()) {
+            return false;
+        }
+
+        std::vector<BlockIndex> index;
+        for (size_t first = 0; first < s.count; first += BLOCK_TICKS) {
+            const size_t n = std::min<size_t>(BLOCK_TICKS, s.count - first);
+            BlockIndex block{};
+            block.first_timestamp = s.ticks[first].timestamp.nanoseconds_since_epoch;
+            block.last_timestamp = s.ticks[first + n - 1].timestamp.nanoseconds_since_epoch;
+            block.data_offset = file.size();
+            block.tick_count = static_cast<uint32_t>(n);
+            encode_block(s.ticks + first, n, file);
+            block.data_size = static_cast<uint32_t>(file.size() - block.data_offset);
+            index.push_back(block);
+        }
+
+        SymbolEntry entry{};
+        entry.key = key.value;
+        entry.tick_count = s.count;
+        entry.block_count = index.size();
+        directory.push_back(entry);
+        indexes.push_back(std::move(index));
+    }
+
+    for (size_t i = 0; i < directory.size(); ++i) {
+        pad_to_8(file);
+        directory[i].index_offset = file.size();
+        for (const auto& block : indexes[i]) {
+            append_struct(file, block);
+        }
+    }
+
+    pad_to_8(file);
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.symbol_count = static_cast<uint32_t>(directory.size());
+    header.directory_offset = file.size();
+    for (const auto& entry : directory) {
+        append_struct(file, entry);
+    }
+    std::memcpy(file.data(), &header, sizeof(header));
+
+    // Write beside the target and rename so readers never map a partial file
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()))) {
+            return false;
+        }
+    }
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+const SymbolEntry* TickArchive::find(SymbolKey key) const {
+    for (size_t i = 0; i < symbol_count_; ++i) {
+        if (directory_[i].key == key.value) {
+            return directory_ + i;
+        }
+    }
+    return nullptr;
+}
+
+const BlockIndex* TickArchive::blocks(const SymbolEntry& entry) const {
+    return reinterpret_cast<const BlockIndex*>(data_ + entry.index_offset);
+}
+
+size_t TickArchive::decode_block(const BlockIndex& block, uint32_t symbol_id, MarketTick* out) const {
+    const size_t n = block.tick_count;
+    VarintReader in(data_ + block.data_offset, data_ + block.data_offset + block.data_size);
+
+    uint64_t ts = block.first_timestamp;
+    for (size_t i = 0; i < n; ++i) {
+        ts += in.next();
+        out[i].timestamp = Timestamp(ts);
+        out[i].symbol_id = symbol_id;
+        out[i].padding = 0;
+    }
+
+    auto read_price_column = [&](Price MarketTick::*field) {
+        int64_t value = 0;
+        for (size_t i = 0; i < n; ++i) {
+            value += zigzag_decode(in.next());
+            (out[i].*field).value = value;
+        }
+    };
+    read_price_column(&MarketTick::bid);
+    read_price_column(&MarketTick::ask);
+    read_price_column(&MarketTick::last);
+
+    for (size_t i = 0; i < n; ++i) out[i].bid_size = static_cast<uint32_t>(in.next());
+    for (size_t i = 0; i < n; ++i) out[i].ask_size = static_cast<uint32_t>(in.next());
+    for (size_t i = 0; i < n; ++i) out[i].volume = static_cast<uint32_t>(in.next());
+
+    int64_t seq = 0;
+    for (size_t i = 0; i < n; ++i) {
+        seq += zigzag_decode(in.next());
+        out[i].sequence_number = static_cast<uint32_t>(seq);
+    }
+    for (size_t i = 0; i < n; ++i) out[i].exchange_id = static_cast<uint32_t>(in.next());
+
+    return in.failed() ? 0 : n;
+}
+
+// ===================================================================
+// TickRange
+// ===================================================================
+
+namespace {
+
+// Decode block and clip it to [start, end]; false when nothing is left
+bool clip_block(const TickArchive& archive, const BlockIndex& block, uint32_t symbol_id,
+                uint64_t start, uint64_t end, MarketTick* buffer,
+                const MarketTick*& first, const MarketTick*& last) {
+    const size_t n = archive.decode_block(block, symbol_id, buffer);
+
+    first = buffer;
+    last = buffer + n;
+    if (block.first_timestamp < start) {
+        first = std::lower_bound(first, last, start,
+            [](const MarketTick& t, uint64_t ts) { return t.timestamp.nanoseconds_since_epoch < ts; });
+    }
+    if (block.last_timestamp > end) {
+        last = std::upper_bound(first, last, end,
+            [](uint64_t ts, const MarketTick& t) { return ts < t.timestamp.nanoseconds_since_epoch; });
+    }
+    return first != last;
+}
+
+} // namespace
+
+TickRange::iterator::iterator(const iterator& other)
+    : current_(other.current_), chunk_end_(other.chunk_end_), archive_(other.archive_),
+      next_block_(other.next_block_), last_block_(other.last_block_), symbol_id_(other.symbol_id_),
+      start_(other.start_), end_(other.end_) {
+    if (other.buffer_) {
+        buffer_.reset(new MarketTick[BLOCK_TICKS]);
+        if (current_) {
+            // Same position in our own copy of the block
+            const MarketTick* first = other.buffer_.get();
+            std::copy(first, other.chunk_end_, buffer_.get());
+            current_ = buffer_.get() + (other.current_ - first);
+            chunk_end_ = buffer_.get() + (other.chunk_end_ - first);
+        }
+    }
+}
+
+TickRange::iterator& TickRange::iterator::operator=(const iterator& other) {
+    if (this != &other) {
+        iterator copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+void TickRange::iterator::next_chunk() {
+    current_ = nullptr;
+    chunk_end_ = nullptr;
+    if (!archive_) {
+        return;
+    }
+    while (next_block_ != last_block_) {
+        const BlockIndex* block = next_block_++;
+        if (clip_block(*archive_, *block, symbol_id_, start_, end_, buffer_.get(), current_, chunk_end_)) {
+            return;
+        }
+    }
+    current_ = nullptr;
+    chunk_end_ = nullptr;
+}
+
+TickRange::TickRange(const MarketTick* begin, const MarketTick* end)
+    : memory_begin_(begin), memory_end_(end) {}
+
+TickRange::TickRange(const TickArchive* archive, const SymbolEntry* entry,
+                     uint32_t symbol_id, Timestamp start, Timestamp end)
+    : archive_(archive), symbol_id_(symbol_id),
+      start_(start.nanoseconds_since_epoch), end_(end.nanoseconds_since_epoch) {
+    const BlockIndex* blocks = archive->blocks(*entry);
+    const BlockIndex* blocks_end = blocks + entry->block_count;
+
+    // Time index: first block ending at/after start, first block starting after end
+    first_block_ = std::lower_bound(blocks, blocks_end, start_,
+        [](const BlockIndex& b, uint64_t ts) { return b.last_timestamp < ts; });
+    last_block_ = std::upper_bound(first_block_, blocks_end, end_,
+        [](uint64_t ts, const BlockIndex& b) { return ts < b.first_timestamp; });
+}
+
+TickRange::iterator TickRange::begin() const {
+    iterator it;
+    if (!archive_) {
+        if (memory_begin_ != memory_end_) {
+            it.current_ = memory_begin_;
+            it.chunk_end_ = memory_end_;
+        }
+        return it;
+    }
+    if (first_block_ == last_block_) {
+        return it;
+    }
+
+    it.archive_ = archive_;
+    it.next_block_ = first_block_;
+    it.last_block_ = last_block_;
+    it.symbol_id_ = symbol_id_;
+    it.start_ = start_;
+    it.end_ = end_;
+    it.buffer_.reset(new MarketTick[BLOCK_TICKS]);
+    it.next_chunk();
+    return it;
+}
+
+size_t TickRange::count_ticks(size_t limit) const {
+    if (!archive_) {
+        return std::min(limit, static_cast<size_t>(memory_end_ - memory_begin_));
+    }
+
+    // Interior blocks come straight from the index; only the edges are
+    // decoded, into scratch space of our own
+    size_t total = 0;
+    std::unique_ptr<MarketTick[]> scratch;
+    for (const BlockIndex* block = first_block_; block != last_block_ && total < limit; ++block) {
+        if (block->first_timestamp >= start_ && block->last_timestamp <= end_) {
+            total += block->tick_count;
+            continue;
+        }
+        if (!scratch) {
+            scratch.reset(new MarketTick[BLOCK_TICKS]);
+        }
+        const MarketTick* first = nullptr;
+        const MarketTick* last = nullptr;
+        if (clip_block(*archive_, *block, symbol_id_, start_, end_, scratch.get(), first, last)) {
+            total += static_cast<size_t>(last - first);
+        }
+    }
+    return std::min(total, limit);
+}
+
+std::vector<MarketTick> TickRange::to_vector() const {
+    std::vector<MarketTick> ticks;
+    for (const auto& tick : *this) {
+        ticks.push_back(tick);
+    }
+    return ticks;
+}
+
+} // namespace hft::data
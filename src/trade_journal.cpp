@@ -0,0 +1,164 @@
+/*
+ * ===================================================================
+ *                    BINARY TRADE JOURNAL
+ * ===================================================================
+ */
+
+#include "../include/trade_journal.h"
+#include "../include/cpu_topology.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hft::data {
+
+const char* to_string(JournalEvent event) {
+    switch (event) {
+        case JournalEvent::POSITION_OPEN:  return "OPEN";
+        case JournalEvent::POSITION_CLOSE: return "CLOSE";
+    }
+    return "UNKNOWN";
+}
+
+size_t format_record(const JournalRecord& record, char* out, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    const int length = std::snprintf(
+        out, size,
+        "[TRADE] %s id=%u symbol=%u t=%llu call=%.4f put=%.4f premium=%.4f value=%.4f pnl=%.2f",
+        to_string(record.event), record.position_id, record.symbol_id,
+        static_cast<unsigned long long>(record.timestamp_ns),
+        record.call_strike.to_double(), record.put_strike.to_double(), record.premium.to_double(),
+        record.value.to_double(), record.pnl.to_double());
+    if (length < 0) {
+        out[0] = '\0';
+        return 0;
+    }
+    return std::min(static_cast<size_t>(length), size - 1);
+}
+
+bool decode_journal(const std::string& path, std::vector<JournalRecord>& out) {
+    std::ifstream file(path, std::ios::binary);
+    JournalHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != JournalHeader::MAGIC || header.version != JournalHeader::VERSION ||
+        header.record_size != sizeof(JournalRecord)) {
+        return false;
+    }
+    JournalRecord record;
+    while (file.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        out.push_back(record);   // A torn final record is ignored
+    }
+    return true;
+}
+
+TradeJournal::TradeJournal(const Config& config)
+    : config_(config),
+      queue_(config.use_hugepages, CpuTopology::instance().node_of_cpu(config.writer_cpu)) {}
+
+TradeJournal::~TradeJournal() {
+    stop();
+    flush();
+    close();
+}
+
+bool TradeJournal::open() {
+    if (fd_ >= 0) {
+        return true;
+    }
+    fd_ = ::open(config_.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        return false;
+    }
+    const JournalHeader header;
+    if (!write_all(&header, sizeof(header))) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TradeJournal::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool TradeJournal::start() {
+    if (!open() || running_.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    writer_thread_ = std::thread(&TradeJournal::write_loop, this);
+    pin_thread(writer_thread_, config_.writer_cpu);
+    return true;
+}
+
+void TradeJournal::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (writer_thread_.joinable()) {
+        writer_thread_.join();
+    }
+    close();
+}
+
+void TradeJournal::write_loop() {
+    const auto idle = std::chrono::microseconds(config_.idle_sleep_us);
+    while (running_.load(std::memory_order_acquire)) {
+        if (drain() == 0) {
+            std::this_thread::sleep_for(idle);
+        }
+    }
+    // Records queued before stop() still reach the file
+    while (drain() != 0) {
+    }
+}
+
+size_t TradeJournal::flush() {
+    if (is_running() || fd_ < 0) {
+        return 0;
+    }
+    size_t total = 0;
+    while (const size_t n = drain()) {
+        total += n;
+    }
+    return total;
+}
+
+size_t TradeJournal::drain() {
+    JournalRecord batch[WRITE_BATCH];
+    const size_t n = queue_.pop_n(batch, WRITE_BATCH);
+    if (n == 0) {
+        return 0;
+    }
+    if (write_all(batch, n * sizeof(JournalRecord))) {
+        records_written_.fetch_add(n, std::memory_order_relaxed);
+    } else {
+        write_failures_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return n;
+}
+
+bool TradeJournal::write_all(const void* data, size_t length) {
+    const char* p = static_cast<const char*>(data);
+    while (length > 0) {
+        const ssize_t written = ::write(fd_, p, length);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p += written;
+        length -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // namespace hft::data
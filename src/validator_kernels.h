@@ -0,0 +1,85 @@
+/*
+ * ===================================================================
+ *                  BATCH TICK VALIDATION KERNELS
+ * ===================================================================
+ *
+ * Internal interface between DataValidator's batch mode and the
+ * per-instruction-set kernels (the AVX2 one lives in its own
+ * translation unit, compiled with -mavx2).
+ *
+ * Every rule is an integer comparison on fixed-point prices and
+ * basis-point thresholds. MAX_QUOTE and MAX_THRESHOLD_BP keep every
+ * product below 2^53, so the SIMD kernel can compare in double lanes
+ * and still give exactly the integer result.
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "../include/data_ingestion.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace hft::data::detail {
+
+// Ticks in caller memory: tick i at base + i * stride, checked when bit
+// i of eligible is set (count <= DataValidator::BATCH_SIZE)
+struct TickView {
+    const uint8_t* base;
+    size_t stride;
+    size_t count;
+    uint64_t eligible;
+};
+
+constexpr uint8_t OPTION_CALL = 0;   // OptionTick::option_type
+
+// Reference path, also the fallback for groups the SIMD kernel cannot
+// take (a symbol repeated within one group)
+uint64_t validate_quotes_scalar(const TickView& view, const DataValidator::Thresholds& limits,
+                                int64_t* last_good);
+uint64_t validate_options_scalar(const TickView& view, const DataValidator::Thresholds& limits,
+                                 const int64_t* last_good);
+
+#ifdef HFT_SIMD_KERNELS
+// 4 ticks per step (requires AVX2)
+uint64_t validate_quotes_avx2(const TickView& view, const DataValidator::Thresholds& limits,
+                              int64_t* last_good);
+uint64_t validate_options_avx2(const TickView& view, const DataValidator::Thresholds& limits,
+                               const int64_t* last_good);
+#endif
+
+// Scalar rules. Anonymous so each translation unit keeps a copy compiled
+// for its own instruction set.
+namespace {
+
+// prev: bid + ask of the symbol's last accepted quote, 0 = none
+inline bool quote_ok(int64_t bid, int64_t ask, uint32_t volume, int64_t prev,
+                     const DataValidator::Thresholds& limits) {
+    if (!(bid > 0 && ask >= bid && ask <= DataValidator::MAX_QUOTE)) {
+        return false;
+    }
+    const int64_t sum = ask + bid;                  // Twice the midpoint
+    const int64_t jump = sum >= prev ? sum - prev : prev - sum;
+    return (ask - bid) * 20000 <= limits.max_spread_bp * sum &&
+           bid * 10000 >= limits.min_ratio_bp * ask &&
+           volume >= limits.min_volume && volume <= limits.max_volume &&
+           (prev == 0 || jump * 10000 <= limits.max_jump_bp * prev);
+}
+
+// underlying: bid + ask of the underlying's quote. Option spreads are
+// not bounded; the bid may not exceed what the option can be worth
+// (the underlying for a call, the strike for a put).
+inline bool option_ok(int64_t bid, int64_t ask, int64_t strike, uint8_t type, uint32_t volume,
+                      int64_t underlying, const DataValidator::Thresholds& limits) {
+    if (!(bid >= 0 && ask >= bid && ask > 0 && ask <= DataValidator::MAX_QUOTE &&
+          strike > 0 && strike <= DataValidator::MAX_QUOTE && underlying > 0)) {
+        return false;
+    }
+    const int64_t bound = type == OPTION_CALL ? underlying : 2 * strike;
+    return 2 * bid <= bound && volume <= limits.max_volume;
+}
+
+} // namespace
+
+} // namespace hft::data::detail
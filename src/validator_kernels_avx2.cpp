@@ -0,0 +1,212 @@
+/*
+ * ===================================================================
+ *                  AVX2 BATCH TICK VALIDATION KERNEL
+ * ===================================================================
+ *
+ * Compiled with -mavx2. Only reached through DataValidator when the
+ * CPU reports AVX2.
+ *
+ * Four ticks per step: the caller's (strided) ticks are loaded and
+ * transposed into one register per field, checked against the rules as
+ * exact integers held in double lanes, and the pass/fail bits come out
+ * of one movemask. Steps where a symbol repeats go through the scalar
+ * rules so each tick still sees the previous tick of its symbol.
+ *
+ * ===================================================================
+ */
+
+#include "validator_kernels.h"
+#include <immintrin.h>
+#include <cstddef>
+
+namespace hft::data::detail {
+namespace {
+
+constexpr size_t WIDTH = 4;
+
+// Ticks are read as two 32-byte rows each and transposed, so the
+// kernel depends on where the checked fields sit
+static_assert(offsetof(MarketTick, bid) == 8 && offsetof(MarketTick, ask) == 16, "MarketTick row 0 layout");
+static_assert(offsetof(MarketTick, symbol_id) == 32 && offsetof(MarketTick, volume) == 44, "MarketTick row 1 layout");
+static_assert(offsetof(OptionTick, underlying_id) == 12 && offsetof(OptionTick, strike) == 16 &&
+              offsetof(OptionTick, bid) == 24, "OptionTick row 0 layout");
+static_assert(offsetof(OptionTick, ask) == 32 && offsetof(OptionTick, option_type) == 54 &&
+              offsetof(OptionTick, volume) == 56, "OptionTick row 1 layout");
+
+// Row (0 or 1) of the (up to) four ticks of step i as four columns of
+// 64-bit words: column c holds word c of each tick. Missing lanes repeat
+// tick i and are never eligible.
+struct Columns {
+    __m256i word[4];
+};
+
+Columns load_columns(const TickView& view, size_t i, size_t row) {
+    const auto at = [&](size_t k) {
+        const size_t tick = i + k < view.count ? i + k : i;
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(view.base + tick * view.stride + row * 32));
+    };
+    const __m256i r0 = at(0), r1 = at(1), r2 = at(2), r3 = at(3);
+    const __m256i lo01 = _mm256_unpacklo_epi64(r0, r1), hi01 = _mm256_unpackhi_epi64(r0, r1);
+    const __m256i lo23 = _mm256_unpacklo_epi64(r2, r3), hi23 = _mm256_unpackhi_epi64(r2, r3);
+    return Columns{{_mm256_permute2x128_si256(lo01, lo23, 0x20), _mm256_permute2x128_si256(hi01, hi23, 0x20),
+                    _mm256_permute2x128_si256(lo01, lo23, 0x31), _mm256_permute2x128_si256(hi01, hi23, 0x31)}};
+}
+
+__m256i low32(__m256i v) { return _mm256_and_si256(v, _mm256_set1_epi64x(0xFFFFFFFFLL)); }
+
+// Exact for integers in [-2^51, 2^51]
+__m256d to_double(__m256i v) {
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);   // 2^52 + 2^51
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(v, _mm256_castpd_si256(magic))), magic);
+}
+
+__m256d le(__m256d a, __m256d b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+__m256d as_pd(__m256i m) { return _mm256_castsi256_pd(m); }
+
+// Lanes of step i that are eligible, as bits 0-3
+unsigned step_lanes(const TickView& view, size_t i) {
+    const uint64_t in_view = view.count - i >= WIDTH ? 0xF : (uint64_t(1) << (view.count - i)) - 1;
+    return static_cast<unsigned>((view.eligible >> i) & in_view);
+}
+
+// All-ones in the 64-bit lanes whose bit is set in lanes
+__m256i lane_mask(unsigned lanes) {
+    const __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(lanes), bits), bits);
+}
+
+// Gather index into last_good, and all-ones where the id is in range
+__m256i table_index(__m256i ids, __m256i& known) {
+    known = _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(constants::MAX_SYMBOLS)), ids);
+    return _mm256_and_si256(ids, known);
+}
+
+// 0 < bid <= ask <= MAX_QUOTE, all-ones per lane
+__m256i quote_in_range(__m256i bid, __m256i ask, bool bid_may_be_zero) {
+    const __m256i max_quote = _mm256_set1_epi64x(DataValidator::MAX_QUOTE);
+    const __m256i floor = _mm256_set1_epi64x(bid_may_be_zero ? -1 : 0);
+    __m256i ok = _mm256_cmpgt_epi64(bid, floor);
+    ok = _mm256_andnot_si256(_mm256_cmpgt_epi64(bid, ask), ok);
+    ok = _mm256_andnot_si256(_mm256_cmpgt_epi64(ask, max_quote), ok);
+    return _mm256_and_si256(ok, _mm256_cmpgt_epi64(ask, _mm256_setzero_si256()));
+}
+
+} // namespace
+
+uint64_t validate_quotes_avx2(const TickView& view, const DataValidator::Thresholds& limits, int64_t* last_good) {
+    const __m256d spread_bp = _mm256_set1_pd(static_cast<double>(limits.max_spread_bp));
+    const __m256d ratio_bp = _mm256_set1_pd(static_cast<double>(limits.min_ratio_bp));
+    const __m256d jump_bp = _mm256_set1_pd(static_cast<double>(limits.max_jump_bp));
+    const __m256d min_volume = _mm256_set1_pd(static_cast<double>(limits.min_volume));
+    const __m256d max_volume = _mm256_set1_pd(static_cast<double>(limits.max_volume));
+    const __m256d bp = _mm256_set1_pd(10000.0);
+    const __m256d bp2 = _mm256_set1_pd(20000.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d sign = _mm256_set1_pd(-0.0);
+
+    uint64_t rejected = 0;
+    for (size_t i = 0; i < view.count; i += WIDTH) {
+        const unsigned lanes = step_lanes(view, i);
+        if (lanes == 0) {
+            continue;
+        }
+        const Columns row0 = load_columns(view, i, 0);
+        const Columns row1 = load_columns(view, i, 1);
+        const __m256i ids = low32(row1.word[0]);
+
+        // A symbol twice in one step: its second tick must see the first
+        const __m256i eligible = lane_mask(lanes);
+        const __m256i unique = _mm256_blendv_epi8(_mm256_setr_epi64x(-1, -2, -3, -4), ids, eligible);
+        const __m256i repeats = _mm256_or_si256(
+            _mm256_cmpeq_epi64(unique, _mm256_permute4x64_epi64(unique, _MM_SHUFFLE(0, 3, 2, 1))),
+            _mm256_cmpeq_epi64(unique, _mm256_permute4x64_epi64(unique, _MM_SHUFFLE(1, 0, 3, 2))));
+        if (!_mm256_testz_si256(repeats, repeats)) {
+            const TickView step{view.base + i * view.stride, view.stride,
+                                view.count - i < WIDTH ? view.count - i : WIDTH, lanes};
+            rejected |= validate_quotes_scalar(step, limits, last_good) << i;
+            continue;
+        }
+
+        const __m256i bid = row0.word[1];
+        const __m256i ask = row0.word[2];
+        const __m256i volume = _mm256_srli_epi64(row1.word[1], 32);
+        __m256i known;
+        const __m256i index = table_index(ids, known);
+        const __m256i prev_i = _mm256_and_si256(
+            _mm256_i64gather_epi64(reinterpret_cast<const long long*>(last_good), index, 8), known);
+        const __m256i sum_i = _mm256_add_epi64(bid, ask);
+
+        const __m256d b = to_double(bid);
+        const __m256d a = to_double(ask);
+        const __m256d sum = to_double(sum_i);
+        const __m256d prev = to_double(prev_i);
+        const __m256d vol = to_double(volume);
+        const __m256d jump = _mm256_andnot_pd(sign, _mm256_sub_pd(sum, prev));
+
+        __m256d ok = as_pd(_mm256_and_si256(quote_in_range(bid, ask, false), known));
+        ok = _mm256_and_pd(ok, le(_mm256_mul_pd(_mm256_sub_pd(a, b), bp2), _mm256_mul_pd(spread_bp, sum)));
+        ok = _mm256_and_pd(ok, le(_mm256_mul_pd(ratio_bp, a), _mm256_mul_pd(b, bp)));
+        ok = _mm256_and_pd(ok, _mm256_and_pd(le(min_volume, vol), le(vol, max_volume)));
+        ok = _mm256_and_pd(ok, _mm256_or_pd(_mm256_cmp_pd(prev, zero, _CMP_EQ_OQ),
+                                            le(_mm256_mul_pd(jump, bp), _mm256_mul_pd(jump_bp, prev))));
+
+        const unsigned passed = static_cast<unsigned>(_mm256_movemask_pd(ok)) & lanes;
+        rejected |= static_cast<uint64_t>(lanes & ~passed) << i;
+        if (passed != 0) {
+            alignas(32) long long id_lane[WIDTH];
+            alignas(32) long long sum_lane[WIDTH];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(id_lane), ids);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(sum_lane), sum_i);
+            for (unsigned bits = passed; bits != 0; bits &= bits - 1) {
+                const unsigned k = static_cast<unsigned>(__builtin_ctz(bits));
+                last_good[id_lane[k]] = sum_lane[k];
+            }
+        }
+    }
+    return rejected;
+}
+
+uint64_t validate_options_avx2(const TickView& view, const DataValidator::Thresholds& limits,
+                               const int64_t* last_good) {
+    const __m256d max_volume = _mm256_set1_pd(static_cast<double>(limits.max_volume));
+    const __m256i max_quote = _mm256_set1_epi64x(DataValidator::MAX_QUOTE);
+    const __m256i zero_i = _mm256_setzero_si256();
+
+    uint64_t rejected = 0;
+    for (size_t i = 0; i < view.count; i += WIDTH) {
+        const unsigned lanes = step_lanes(view, i);
+        if (lanes == 0) {
+            continue;
+        }
+        const Columns row0 = load_columns(view, i, 0);
+        const Columns row1 = load_columns(view, i, 1);
+        const __m256i underlying_id = _mm256_srli_epi64(row0.word[1], 32);
+        const __m256i strike = row0.word[2];
+        const __m256i bid = row0.word[3];
+        const __m256i ask = row1.word[0];
+        const __m256i type = _mm256_and_si256(_mm256_srli_epi64(row1.word[2], 48), _mm256_set1_epi64x(0xFF));
+        const __m256i volume = low32(row1.word[3]);
+
+        __m256i known;
+        const __m256i index = table_index(underlying_id, known);
+        const __m256i underlying = _mm256_and_si256(
+            _mm256_i64gather_epi64(reinterpret_cast<const long long*>(last_good), index, 8), known);
+
+        __m256i valid = _mm256_and_si256(quote_in_range(bid, ask, true), known);
+        valid = _mm256_and_si256(valid, _mm256_cmpgt_epi64(strike, zero_i));
+        valid = _mm256_andnot_si256(_mm256_cmpgt_epi64(strike, max_quote), valid);
+        valid = _mm256_and_si256(valid, _mm256_cmpgt_epi64(underlying, zero_i));
+
+        // Calls: bid <= underlying midpoint; puts: bid <= strike (both doubled)
+        const __m256i is_call = _mm256_cmpeq_epi64(type, _mm256_set1_epi64x(OPTION_CALL));
+        const __m256i bound = _mm256_blendv_epi8(_mm256_add_epi64(strike, strike), underlying, is_call);
+        __m256d ok = as_pd(_mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_add_epi64(bid, bid), bound), valid));
+        ok = _mm256_and_pd(ok, le(to_double(volume), max_volume));
+
+        const unsigned passed = static_cast<unsigned>(_mm256_movemask_pd(ok)) & lanes;
+        rejected |= static_cast<uint64_t>(lanes & ~passed) << i;
+    }
+    return rejected;
+}
+
+} // namespace hft::data::detail
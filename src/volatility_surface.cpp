@@ -0,0 +1,178 @@
+/*
+ * ===================================================================
+ *                    IMPLIED VOLATILITY SURFACE
+ * ===================================================================
+ */
+
+#include "../include/volatility_surface.h"
+#include "../include/expiry_slots.h"
+#include <algorithm>
+#include <cmath>
+
+namespace hft::data {
+
+namespace {
+
+constexpr uint8_t CALL = 0;
+
+double strike_iv(float call, float put) {
+    if (call > 0.0f && put > 0.0f) return 0.5 * (static_cast<double>(call) + put);
+    return call > 0.0f ? call : put;
+}
+
+} // namespace
+
+VolatilitySurface::VolatilitySurface(uint32_t underlying_id) : underlying_id_(underlying_id) {
+    slices_.reserve(MAX_EXPIRIES);
+}
+
+bool VolatilitySurface::update(const OptionTick& tick) {
+    if (tick.underlying_id != underlying_id_) {
+        return false;
+    }
+    Slice* slice = expiry_slot(slices_, tick.expiration_date, MAX_EXPIRIES);
+    if (!slice) {
+        return false;
+    }
+    slice->days_to_expiry = tick.days_to_expiry;
+
+    auto it = std::lower_bound(slice->strikes.begin(), slice->strikes.end(), tick.strike.value);
+    const size_t i = static_cast<size_t>(it - slice->strikes.begin());
+    if (it == slice->strikes.end() || *it != tick.strike.value) {
+        slice->strikes.insert(it, tick.strike.value);
+        slice->call_iv.insert(slice->call_iv.begin() + i, 0.0f);
+        slice->put_iv.insert(slice->put_iv.begin() + i, 0.0f);
+    }
+
+    const bool call = tick.option_type == CALL;
+    if (tick.implied_volatility > 0.0) {
+        float& iv = call ? slice->call_iv[i] : slice->put_iv[i];
+        const float value = static_cast<float>(tick.implied_volatility);
+        if (iv != value) {
+            iv = value;
+            slice->dirty = true;
+        }
+    }
+    return true;
+}
+
+// Natural cubic spline through (ln K, IV), resampled on the grid
+void VolatilitySurface::refit(const Slice& slice) const {
+    slice.dirty = false;
+    ++refits_;
+
+    std::vector<double>& x = scratch_x_;
+    std::vector<double>& y = scratch_y_;
+    std::vector<double>& m = scratch_m_;
+    std::vector<double>& c = scratch_c_;
+    x.clear();
+    y.clear();
+    for (size_t i = 0; i < slice.strikes.size(); ++i) {
+        const double iv = strike_iv(slice.call_iv[i], slice.put_iv[i]);
+        if (iv > 0.0 && slice.strikes[i] > 0) {
+            x.push_back(std::log(static_cast<double>(slice.strikes[i])));
+            y.push_back(iv);
+        }
+    }
+    const size_t n = x.size();
+    slice.fitted = n > 0;
+    if (n == 0) {
+        return;
+    }
+    slice.x_min = x[0];
+    if (n == 1) {
+        slice.inv_step = 0.0;
+        slice.grid.fill(y[0]);
+        return;
+    }
+
+    // Second derivatives, natural boundary (m[0] = m[n-1] = 0), Thomas algorithm
+    m.assign(n, 0.0);
+    c.assign(n, 0.0);
+    for (size_t i = 1; i + 1 < n; ++i) {
+        const double h0 = x[i] - x[i - 1];
+        const double h1 = x[i + 1] - x[i];
+        const double d = 6.0 * ((y[i + 1] - y[i]) / h1 - (y[i] - y[i - 1]) / h0);
+        const double b = 2.0 * (h0 + h1) - h0 * c[i - 1];
+        c[i] = h1 / b;
+        m[i] = (d - h0 * m[i - 1]) / b;
+    }
+    for (size_t i = n - 2; i >= 1; --i) {
+        m[i] -= c[i] * m[i + 1];
+    }
+
+    const double step = (x[n - 1] - x[0]) / (GRID_POINTS - 1);
+    slice.inv_step = 1.0 / step;
+    size_t j = 0;
+    for (size_t g = 0; g < GRID_POINTS; ++g) {
+        const double xg = g + 1 == GRID_POINTS ? x[n - 1] : x[0] + g * step;
+        while (j + 2 < n && xg > x[j + 1]) ++j;
+        const double h = x[j + 1] - x[j];
+        const double A = (x[j + 1] - xg) / h;
+        const double B = 1.0 - A;
+        const double value = A * y[j] + B * y[j + 1] +
+                             ((A * A * A - A) * m[j] + (B * B * B - B) * m[j + 1]) * h * h / 6.0;
+        slice.grid[g] = std::max(value, MIN_VOLATILITY);
+    }
+}
+
+double VolatilitySurface::evaluate(const Slice& slice, double log_strike) const {
+    if (slice.dirty) {
+        refit(slice);
+    }
+    if (!slice.fitted) {
+        return 0.0;
+    }
+    if (slice.inv_step == 0.0) {
+        return slice.grid[0];
+    }
+    const double t = std::clamp((log_strike - slice.x_min) * slice.inv_step, 0.0, double(GRID_POINTS - 1));
+    const size_t i = std::min(static_cast<size_t>(t), GRID_POINTS - 2);
+    const double frac = t - i;
+    return slice.grid[i] + frac * (slice.grid[i + 1] - slice.grid[i]);
+}
+
+double VolatilitySurface::implied_volatility(Price strike, uint32_t expiration_date) const {
+    const size_t slice = find_expiry(expiration_date);
+    if (slice == NO_SLICE || strike.value <= 0) {
+        return 0.0;
+    }
+    return evaluate(slices_[slice], std::log(static_cast<double>(strike.value)));
+}
+
+double VolatilitySurface::implied_volatility(Price strike, double days_to_expiry) const {
+    if (strike.value <= 0) {
+        return 0.0;
+    }
+    const double log_strike = std::log(static_cast<double>(strike.value));
+
+    // Fitted slices bracketing the maturity
+    double t0 = 0.0, iv0 = 0.0;
+    for (const Slice& slice : slices_) {
+        const double iv = evaluate(slice, log_strike);
+        if (iv <= 0.0) continue;
+        const double t1 = slice.days_to_expiry;
+        if (t1 >= days_to_expiry) {
+            if (iv0 <= 0.0 || t1 <= t0) {
+                return iv;
+            }
+            const double w0 = iv0 * iv0 * t0;
+            const double w1 = iv * iv * t1;
+            const double w = w0 + (w1 - w0) * (days_to_expiry - t0) / (t1 - t0);
+            return days_to_expiry > 0.0 ? std::sqrt(std::max(w, 0.0) / days_to_expiry) : iv0;
+        }
+        t0 = t1;
+        iv0 = iv;
+    }
+    return iv0;
+}
+
+size_t VolatilitySurface::find_expiry(uint32_t expiration_date) const {
+    auto it = std::lower_bound(slices_.begin(), slices_.end(), expiration_date,
+                               [](const Slice& s, uint32_t expiry) { return s.expiration_date < expiry; });
+    return it != slices_.end() && it->expiration_date == expiration_date
+        ? static_cast<size_t>(it - slices_.begin())
+        : NO_SLICE;
+}
+
+} // namespace hft::data
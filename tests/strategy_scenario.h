@@ -0,0 +1,102 @@
+/*
+ * ===================================================================
+ *                 SHARED STRADDLE STRATEGY TEST SCENARIO
+ * ===================================================================
+ *
+ * Tick and option factories plus the one market the strategy tests
+ * replay: a choppy then calm underlying (symbol 0), a flat 1.9/2.0
+ * chain quoted at the start, and a later rally in the 102 call that
+ * closes the straddle opened in the calm stretch
+ *
+ * ===================================================================
+ */
+
+#pragma once
+
+#include "../include/backtest_engine.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace hft::scenario {
+
+using data::MarketTick;
+using data::OptionTick;
+using data::Timestamp;
+
+constexpr uint64_t MINUTE = 60ull * 1000000000ull;
+constexpr uint64_t START = 1640995200000000000ull;  // 2022-01-01
+
+inline MarketTick make_tick(uint32_t symbol_id, uint64_t ts, double price) {
+    MarketTick tick{};
+    tick.timestamp = Timestamp(ts);
+    tick.symbol_id = symbol_id;
+    tick.bid.value = std::llround(price * 10000) - 100;
+    tick.ask.value = std::llround(price * 10000) + 100;
+    tick.last.value = std::llround(price * 10000);
+    tick.volume = 100;
+    return tick;
+}
+
+inline OptionTick make_option(uint32_t underlying_id, uint64_t ts, double strike, uint8_t type,
+                              double bid, double ask) {
+    OptionTick option{};
+    option.timestamp = Timestamp(ts);
+    option.underlying_id = underlying_id;
+    option.strike.value = std::llround(strike * 10000);
+    option.bid.value = std::llround(bid * 10000);
+    option.ask.value = std::llround(ask * 10000);
+    option.expiration_date = 20220201;
+    option.days_to_expiry = 30;
+    option.option_type = type;
+    option.implied_volatility = 0.30;
+    return option;
+}
+
+// One pass of the scenario starting at `base`, one underlying tick every
+// ten minutes. Streaming tests drive the strategy bar by bar with the
+// static helpers; replay tests use the materialised ticks and options.
+struct StrategyScenario {
+    static constexpr int BARS = 240;
+    static constexpr int CALM_FROM = 100;     // Choppy before, calm after
+    static constexpr int RALLY_BAR = 200;     // Rally lands just after this bar
+    static constexpr double RALLY_STRIKE = 102.0;
+    static constexpr std::array<double, 5> STRIKES{95.0, 98.0, 100.0, 102.0, 105.0};
+
+    static constexpr uint64_t bar_time(uint64_t base, int bar) {
+        return base + static_cast<uint64_t>(bar) * 10 * MINUTE;
+    }
+    static constexpr uint64_t rally_time(uint64_t base) { return bar_time(base, RALLY_BAR) + 1; }
+
+    static double price(int bar) {
+        return bar < CALM_FROM ? (bar % 2 ? 101.0 : 99.0) : (bar % 2 ? 100.01 : 100.0);
+    }
+    static OptionTick quote(uint64_t ts, double strike, uint8_t type) {
+        return make_option(0, ts, strike, type, 1.9, 2.0);
+    }
+    static OptionTick rally(uint64_t base, double strike = RALLY_STRIKE) {
+        return make_option(0, rally_time(base), strike, 0, 3.0, 3.1);
+    }
+
+    std::vector<MarketTick> ticks;
+    std::vector<OptionTick> options;
+
+    explicit StrategyScenario(uint64_t base = START) {
+        for (int i = 0; i < BARS; ++i) {
+            ticks.push_back(make_tick(0, bar_time(base, i), price(i)));
+        }
+        for (double strike : STRIKES) {
+            options.push_back(quote(base, strike, 0));
+            options.push_back(quote(base, strike, 1));
+        }
+        options.push_back(rally(base));
+    }
+
+    bool load(analytics::BacktestEngine& engine) const {
+        engine.add_market_data(data::TickRange(ticks.data(), ticks.data() + ticks.size()));
+        return engine.add_options_data(options);
+    }
+};
+
+} // namespace hft::scenario
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "../include/backtest_engine.h"
+#include "../include/order_router.h"
+#include "strategy_scenario.h"
+#include <tuple>
+
+using namespace hft::data;
+using namespace hft::analytics;
+using hft::strategy::StraddleStrategy;
+using namespace hft::scenario;
+
+namespace {
+
+struct Recorder {
+    const BacktestEngine* engine = nullptr;
+    std::vector<std::tuple<uint64_t, int, uint32_t>> events;  // ts, kind, symbol
+    bool clock_matches = true;
+
+    void on_market_data(const MarketTick& tick) {
+        clock_matches &= engine->now().nanoseconds_since_epoch == tick.timestamp.nanoseconds_since_epoch;
+        events.emplace_back(tick.timestamp.nanoseconds_since_epoch, 0, tick.symbol_id);
+    }
+    void on_options_data(const OptionTick& tick) {
+        clock_matches &= engine->now().nanoseconds_since_epoch == tick.timestamp.nanoseconds_since_epoch;
+        events.emplace_back(tick.timestamp.nanoseconds_since_epoch, 1, tick.underlying_id);
+    }
+};
+
+} // namespace
+
+TEST(BacktestEngineTest, MergesStreamsInTimestampOrder) {
+    std::vector<MarketTick> a{make_tick(1, 10, 100), make_tick(1, 30, 100), make_tick(1, 50, 100)};
+    std::vector<MarketTick> b{make_tick(2, 20, 50), make_tick(2, 30, 50), make_tick(2, 60, 50)};
+    std::vector<OptionTick> options{make_option(1, 40, 100, 0, 1, 2), make_option(1, 5, 100, 0, 1, 2),
+                                    make_option(2, 30, 50, 1, 1, 2)};
+
+    BacktestEngine engine;
+    engine.add_market_data(TickRange(a.data(), a.data() + a.size()));
+    engine.add_market_data(TickRange(b.data(), b.data() + b.size()));
+    ASSERT_TRUE(engine.add_options_data(options));
+
+    Recorder recorder;
+    recorder.engine = &engine;
+    const BacktestStats stats = engine.replay(recorder);
+
+    const std::vector<std::tuple<uint64_t, int, uint32_t>> expected{
+        {5, 1, 1}, {10, 0, 1}, {20, 0, 2}, {30, 0, 1}, {30, 0, 2}, {30, 1, 2},
+        {40, 1, 1}, {50, 0, 1}, {60, 0, 2}};
+    EXPECT_EQ(recorder.events, expected);
+    EXPECT_TRUE(recorder.clock_matches);
+    EXPECT_EQ(stats.market_ticks, 6u);
+    EXPECT_EQ(stats.option_ticks, 3u);
+    EXPECT_EQ(stats.first_event.nanoseconds_since_epoch, 5u);
+    EXPECT_EQ(stats.last_event.nanoseconds_since_epoch, 60u);
+
+    std::vector<OptionTick> chain;
+    ASSERT_TRUE(engine.options_chain(1, chain));
+    EXPECT_EQ(chain.size(), 1u);  // Same contract quoted twice
+    EXPECT_EQ(chain[0].timestamp.nanoseconds_since_epoch, 40u);
+}
+
+TEST(BacktestEngineTest, WindowFiltersOptionSources) {
+    BacktestEngine::Config config;
+    config.start = Timestamp(10);
+    config.end = Timestamp(20);
+    BacktestEngine engine(config);
+    ASSERT_TRUE(engine.add_options_data({make_option(0, 5, 100, 0, 1, 2), make_option(0, 15, 100, 0, 1, 2),
+                                         make_option(0, 25, 100, 0, 1, 2)}));
+
+    Recorder recorder;
+    recorder.engine = &engine;
+    EXPECT_EQ(engine.replay(recorder).option_ticks, 1u);
+
+    OptionTick bad{};
+    bad.timestamp = Timestamp(15);
+    bad.underlying_id = hft::constants::MAX_SYMBOLS;
+    EXPECT_FALSE(engine.add_options_data({bad}));
+}
+
+TEST(BacktestEngineTest, DrivesStraddleStrategyOnSimulatedClock) {
+    const StrategyScenario scenario;
+    BacktestEngine engine;
+    scenario.load(engine);
+
+    StraddleStrategy strategy;
+    const BacktestStats stats = engine.run(strategy);
+    EXPECT_EQ(stats.market_ticks, scenario.ticks.size());
+    EXPECT_GT(stats.ticks_per_second(), 0.0);
+
+    ASSERT_EQ(strategy.get_total_trades_count(), 1u);
+    EXPECT_DOUBLE_EQ(strategy.get_win_rate(), 1.0);
+    const auto closed = strategy.get_closed_positions();
+    ASSERT_EQ(closed.size(), 1u);
+    EXPECT_EQ(closed[0].call_strike.value, 1020000);
+    EXPECT_EQ(closed[0].put_strike.value, 980000);
+
+    // Entry waits for the calm regime; exit is the call rally, both in event time
+    EXPECT_GE(closed[0].entry_time.nanoseconds_since_epoch, START + 100 * 10 * MINUTE);
+    EXPECT_EQ(closed[0].last_update.nanoseconds_since_epoch, START + 200 * 10 * MINUTE + 1);
+    EXPECT_NEAR(strategy.get_total_pnl(), (3.0 + 1.9 - 4.0) * StraddleStrategy::CONTRACT_MULTIPLIER, 1e-6);
+}
+
+TEST(BacktestEngineTest, ReplayIsDeterministic) {
+    const StrategyScenario scenario;
+    BacktestEngine engine;
+    scenario.load(engine);
+
+    StraddleStrategy first;
+    StraddleStrategy second;
+    engine.run(first);
+    engine.run(second);  // Same sources, replayed again
+
+    const auto a = first.get_closed_positions();
+    const auto b = second.get_closed_positions();
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].entry_time.nanoseconds_since_epoch, b[i].entry_time.nanoseconds_since_epoch);
+        EXPECT_EQ(a[i].realized_pnl.value, b[i].realized_pnl.value);
+    }
+    EXPECT_DOUBLE_EQ(first.get_total_pnl(), second.get_total_pnl());
+}
+
+TEST(BacktestEngineTest, RoutesEntryAndExitAsLegPairs) {
+    const StrategyScenario scenario;
+    BacktestEngine engine;
+    scenario.load(engine);
+
+    std::vector<std::vector<uint8_t>> writes;
+    hft::execution::OrderRouter router([&writes](const uint8_t* data, size_t length) {
+        writes.emplace_back(data, data + length);
+        return true;
+    });
+    StraddleStrategy strategy;
+    strategy.set_order_router(&router);
+    engine.run(strategy);
+    router.poll();
+
+    // One round trip, plus the entry of any position still open
+    ASSERT_EQ(strategy.get_total_trades_count(), 1u);
+    ASSERT_EQ(writes.size(), 2u + strategy.get_active_positions_count());
+    const hft::execution::Side sides[] = {hft::execution::Side::BUY, hft::execution::Side::SELL};
+    const int64_t call_prices[] = {20000, 30000};
+    const int64_t put_prices[] = {20000, 19000};
+    for (size_t i = 0; i < 2; ++i) {
+        ASSERT_EQ(writes[i].size(), 2 * hft::execution::wire::ENTER_ORDER_SIZE);
+        hft::execution::wire::EnterOrder call, put;
+        ASSERT_TRUE(hft::execution::wire::decode_enter_order(writes[i].data(), writes[i].size(), call));
+        ASSERT_TRUE(hft::execution::wire::decode_enter_order(
+            writes[i].data() + hft::execution::wire::ENTER_ORDER_SIZE,
+            hft::execution::wire::ENTER_ORDER_SIZE, put));
+        EXPECT_EQ(call.side, sides[i]);
+        EXPECT_EQ(put.side, sides[i]);
+        EXPECT_EQ(call.price.value, call_prices[i]);
+        EXPECT_EQ(put.price.value, put_prices[i]);
+        EXPECT_EQ(call.pair_id, call.order_id);
+        EXPECT_EQ(put.pair_id, call.order_id);
+    }
+}
+
+TEST(BacktestEngineTest, UnsentEntriesAreRolledBack) {
+    const StrategyScenario scenario;
+    BacktestEngine engine;
+    scenario.load(engine);
+
+    hft::execution::OrderRouter router([](const uint8_t*, size_t) { return false; });
+    StraddleStrategy strategy;
+    strategy.set_order_router(&router);
+    engine.run(strategy);
+
+    EXPECT_GT(router.write_failures(), 0u);
+    EXPECT_EQ(strategy.get_active_positions_count(), 0u);
+    EXPECT_EQ(strategy.get_total_trades_count(), 0u);
+    EXPECT_EQ(strategy.get_portfolio_exposure().positions, 0u);
+}
+
+TEST(BacktestEngineTest, UnsentExitLeavesPositionOpen) {
+    const StrategyScenario scenario;
+    BacktestEngine engine;
+    scenario.load(engine);
+
+    size_t writes = 0;
+    hft::execution::OrderRouter router([&writes](const uint8_t*, size_t) { return writes++ == 0; });
+    StraddleStrategy strategy;
+    strategy.set_order_router(&router);
+    engine.run(strategy);
+
+    // The entry went out; every exit attempt failed, so nothing is realized
+    EXPECT_GT(router.write_failures(), 0u);
+    EXPECT_EQ(strategy.get_total_trades_count(), 0u);
+    ASSERT_EQ(strategy.get_active_positions_count(), 1u);
+    EXPECT_EQ(strategy.get_active_positions()[0].status, hft::strategy::PositionStatus::ACTIVE);
+}
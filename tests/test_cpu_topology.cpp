@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "../include/cpu_topology.h"
+#include "../include/data_ingestion.h"
+#include "../include/page_buffer.h"
+#include <chrono>
+#include <sched.h>
+
+using namespace hft::data;
+
+namespace {
+
+// First CPU this process may run on
+int allowed_cpu() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    sched_getaffinity(0, sizeof(set), &set);
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &set)) return cpu;
+    }
+    return -1;
+}
+
+} // namespace
+
+TEST(CpuTopologyTest, ParsesCpuLists) {
+    EXPECT_EQ(CpuTopology::parse_cpu_list("0-3,8,10-11\n"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(CpuTopology::parse_cpu_list("5"), (std::vector<int>{5}));
+    EXPECT_TRUE(CpuTopology::parse_cpu_list("\n").empty());
+    EXPECT_TRUE(CpuTopology::parse_cpu_list("3-1").empty());
+    EXPECT_TRUE(CpuTopology::parse_cpu_list("1,x").empty());
+}
+
+TEST(CpuTopologyTest, MapsCpusToNodesAndPrefersIsolatedCores) {
+    const CpuTopology topology({{0, 1, 2, 3}, {4, 5, 6, 7}}, {2, 6});
+    EXPECT_TRUE(topology.is_numa());
+    EXPECT_EQ(topology.node_of_cpu(5), 1);
+    EXPECT_EQ(topology.node_of_cpu(9), -1);
+    EXPECT_EQ(topology.cpus_of_node(0).size(), 4u);
+    EXPECT_TRUE(topology.cpus_of_node(3).empty());
+
+    EXPECT_TRUE(topology.is_isolated(6));
+    EXPECT_FALSE(topology.is_isolated(5));
+
+    // Filtered by this process's affinity: isolated first, then highest id
+    const std::vector<int> picked = topology.select_cpus(3, 1);
+    EXPECT_LE(picked.size(), 3u);
+    bool seen_shared = false;
+    for (size_t i = 0; i < picked.size(); ++i) {
+        EXPECT_EQ(topology.node_of_cpu(picked[i]), 1);
+        EXPECT_FALSE(seen_shared && topology.is_isolated(picked[i]));
+        seen_shared |= !topology.is_isolated(picked[i]);
+        if (i > 0 && seen_shared && !topology.is_isolated(picked[i - 1])) {
+            EXPECT_GT(picked[i - 1], picked[i]);
+        }
+    }
+}
+
+TEST(CpuTopologyTest, DetectsThisMachine) {
+    const CpuTopology& topology = CpuTopology::instance();
+    ASSERT_GE(topology.cpu_count(), 1u);
+    ASSERT_GE(topology.node_count(), 1u);
+    const int cpu = allowed_cpu();
+    ASSERT_GE(cpu, 0);
+    EXPECT_GE(topology.node_of_cpu(cpu), 0);
+    EXPECT_FALSE(topology.select_cpus(1).empty());
+}
+
+TEST(CpuTopologyTest, PinsThreads) {
+    const int cpu = allowed_cpu();
+    int ran_on = -2;
+    bool pinned = false;
+    std::thread thread([&] {
+        pinned = pin_current_thread(cpu);
+        ran_on = current_cpu();
+    });
+    thread.join();
+    ASSERT_TRUE(pinned);
+    EXPECT_EQ(ran_on, cpu);
+
+    std::thread idle([] {});
+    EXPECT_FALSE(pin_thread(idle, -1));
+    idle.join();
+    EXPECT_FALSE(pin_current_thread(-1));
+}
+
+TEST(CpuTopologyTest, PlacesBuffersOnTheConsumerNode) {
+    const int cpu = allowed_cpu();
+    const int node = CpuTopology::instance().node_of_cpu(cpu);
+
+    PageBuffer unplaced(1 << 20, false);
+    EXPECT_EQ(unplaced.numa_node(), -1);
+
+    // The kernel may lack NUMA support entirely; then nothing is placed
+    PageBuffer placed(1 << 20, false, node);
+    if (bind_memory_to_node(unplaced.data(), unplaced.size(), node)) {
+        EXPECT_EQ(placed.numa_node(), node);
+    }
+    PageBuffer moved(std::move(placed));
+    EXPECT_EQ(placed.numa_node(), -1);
+
+    DataIngestionEngine::Config config;
+    config.num_worker_threads = 2;
+    config.worker_cpus = {cpu};
+    config.busy_poll = true;
+    config.tech_symbols = {"AAPL"};
+    DataIngestionEngine engine(config);
+    EXPECT_EQ(engine.get_buffer_node(), moved.numa_node());
+    engine.initialize();
+    engine.start();
+
+    MarketTick tick{};
+    tick.symbol_id = engine.get_symbol_mapper().find_id("AAPL");
+    tick.bid = Price(100.0);
+    tick.ask = Price(100.1);
+    ASSERT_TRUE(engine.publish_event(DataEvent(DataEventType::MARKET_TICK, tick)));
+    // Workers pin themselves as they start; wait for both
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((engine.get_events_processed() == 0 || engine.get_pinned_workers() < 2) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(engine.get_events_processed(), 1u);
+    EXPECT_EQ(engine.get_pinned_workers(), 2u);
+    engine.stop();
+    EXPECT_EQ(engine.get_pinned_workers(), 0u);
+}
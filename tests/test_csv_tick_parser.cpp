@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "../include/csv_tick_parser.h"
+#include <cstring>
+#include <random>
+#include <string>
+
+using namespace hft::data;
+
+namespace {
+
+int64_t price_of(const char* text) {
+    int64_t value = 0;
+    EXPECT_TRUE(CsvTickParser::parse_price(text, text + std::strlen(text), value)) << text;
+    return value;
+}
+
+bool price_rejected(const char* text) {
+    int64_t value = 0;
+    return !CsvTickParser::parse_price(text, text + std::strlen(text), value);
+}
+
+} // namespace
+
+TEST(CsvTickParserTest, FixedPointPrices) {
+    EXPECT_EQ(price_of("150"), 1500000);
+    EXPECT_EQ(price_of("150.25"), 1502500);
+    EXPECT_EQ(price_of("0.0001"), 1);
+    EXPECT_EQ(price_of(".5"), 5000);
+    EXPECT_EQ(price_of("-2.5"), -25000);
+    EXPECT_EQ(price_of("1.23455"), 12346);   // Half-up on the fifth decimal
+    EXPECT_EQ(price_of("1.234549"), 12345);
+
+    EXPECT_TRUE(price_rejected(""));
+    EXPECT_TRUE(price_rejected("-"));
+    EXPECT_TRUE(price_rejected("1.2.3"));
+    EXPECT_TRUE(price_rejected("12a"));
+    EXPECT_TRUE(price_rejected("1e5"));
+}
+
+TEST(CsvTickParserTest, HeaderCrlfAndMissingTrailingNewline) {
+    const std::string csv =
+        "timestamp,bid,ask,last,bid_size,ask_size,volume\r\n"
+        "1000,10.00,10.02,10.01,100,200,300\r\n"
+        "\r\n"
+        "2000,10.01,10.03,10.02,150,250,350,7,2";
+
+    std::vector<MarketTick> ticks;
+    const CsvParseResult result = CsvTickParser::parse(csv.data(), csv.size(), 5, ticks);
+
+    EXPECT_EQ(result.rows, 2u);
+    EXPECT_EQ(result.rejected, 1u);
+    EXPECT_TRUE(result.first_line_rejected);
+    ASSERT_EQ(ticks.size(), 2u);
+
+    EXPECT_EQ(ticks[0].timestamp.nanoseconds_since_epoch, 1000u);
+    EXPECT_EQ(ticks[0].bid.value, 100000);
+    EXPECT_EQ(ticks[0].ask.value, 100200);
+    EXPECT_EQ(ticks[0].volume, 300u);
+    EXPECT_EQ(ticks[0].symbol_id, 5u);
+    EXPECT_EQ(ticks[0].sequence_number, 0u);
+
+    EXPECT_EQ(ticks[1].last.value, 100200);
+    EXPECT_EQ(ticks[1].ask_size, 250u);
+    EXPECT_EQ(ticks[1].sequence_number, 7u);
+    EXPECT_EQ(ticks[1].exchange_id, 2u);
+}
+
+TEST(CsvTickParserTest, RejectsMalformedRows) {
+    const std::string csv =
+        "1000,10,10,10,1,1,1\n"
+        "2000,10,10,10,1,1\n"             // Too few fields
+        "3000,10,10,10,1,1,1,1,1,1\n"     // Too many fields
+        "4000,10,x,10,1,1,1\n"
+        "5000,10,10,10,1,1,99999999999\n" // Volume overflows uint32
+        "6000,10,10,10,1,1,1\n";
+
+    std::vector<MarketTick> ticks;
+    const CsvParseResult result = CsvTickParser::parse(csv.data(), csv.size(), 0, ticks);
+
+    EXPECT_EQ(result.rows, 2u);
+    EXPECT_EQ(result.rejected, 4u);
+    EXPECT_FALSE(result.first_line_rejected);
+    ASSERT_EQ(ticks.size(), 2u);
+    EXPECT_EQ(ticks[1].timestamp.nanoseconds_since_epoch, 6000u);
+}
+
+TEST(CsvTickParserTest, ParallelMatchesSingleThreaded) {
+    std::mt19937 rng(3);
+    std::string csv = "timestamp,bid,ask,last,bid_size,ask_size,volume\n";
+    for (int i = 0; i < 20000; ++i) {
+        const int mid = 1000000 + static_cast<int>(rng() % 5000);
+        csv += std::to_string(1000 + i) + "," +
+               std::to_string(mid / 10000) + "." + std::to_string(mid % 10000) + "," +
+               std::to_string(mid / 10000 + 1) + ",";
+        csv += std::to_string(mid / 10000) + "," + std::to_string(rng() % 1000) + "," +
+               std::to_string(rng() % 1000) + "," + std::to_string(i);
+        if (i % 97 == 0) csv += ",12,3";
+        if (i % 1013 == 0) csv += ",bad";  // Rejected wherever it lands
+        csv += "\n";
+    }
+
+    CsvTickParser::Config single;
+    single.num_threads = 1;
+    CsvTickParser::Config parallel;
+    parallel.num_threads = 4;
+    parallel.min_chunk_bytes = 1024;
+
+    std::vector<MarketTick> expected;
+    std::vector<MarketTick> actual(3);  // Appends after existing contents
+    const CsvParseResult a = CsvTickParser::parse(csv.data(), csv.size(), 1, expected, single);
+    const CsvParseResult b = CsvTickParser::parse(csv.data(), csv.size(), 1, actual, parallel);
+
+    EXPECT_EQ(a.rows, b.rows);
+    EXPECT_EQ(a.rejected, b.rejected);
+    EXPECT_TRUE(b.first_line_rejected);
+    ASSERT_EQ(actual.size(), expected.size() + 3);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(std::memcmp(&expected[i], &actual[i + 3], sizeof(MarketTick)), 0) << i;
+    }
+}
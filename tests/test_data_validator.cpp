@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+#include "../include/data_ingestion.h"
+#include <algorithm>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+
+namespace {
+
+MarketTick quote(uint32_t symbol_id, double bid, double ask, uint32_t volume = 100) {
+    MarketTick tick{};
+    tick.symbol_id = symbol_id;
+    tick.bid = Price(bid);
+    tick.ask = Price(ask);
+    tick.volume = volume;
+    return tick;
+}
+
+OptionTick option(uint32_t underlying_id, uint8_t type, double strike, double bid, double ask) {
+    OptionTick tick{};
+    tick.underlying_id = underlying_id;
+    tick.option_type = type;
+    tick.strike = Price(strike);
+    tick.bid = Price(bid);
+    tick.ask = Price(ask);
+    tick.volume = 10;
+    return tick;
+}
+
+// Mostly good quotes around 100 on a few symbols, with every kind of
+// bad tick mixed in and symbols repeated within blocks
+std::vector<MarketTick> random_quotes(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> kind(0, 19);
+    std::uniform_int_distribution<uint32_t> symbol(1, 6);
+    std::uniform_real_distribution<double> drift(-3.0, 3.0);
+    std::vector<MarketTick> ticks;
+    for (size_t i = 0; i < count; ++i) {
+        const double mid = 100.0 + drift(rng);
+        MarketTick tick = quote(symbol(rng), mid - 0.05, mid + 0.05);
+        switch (kind(rng)) {
+            case 0: tick.ask = Price(mid * 1.2); break;              // Wide spread
+            case 1: std::swap(tick.bid, tick.ask); break;            // Crossed
+            case 2: tick.volume = 0; break;
+            case 3: tick.bid = Price(mid * 1.5); tick.ask = Price(mid * 1.5 + 0.1); break;   // Jump
+            case 4: tick.bid.value = 0; break;
+            case 5: tick.symbol_id = 5000; break;                    // Unknown symbol
+            case 6: tick.ask.value = DataValidator::MAX_QUOTE + 1; break;
+            default: break;
+        }
+        ticks.push_back(tick);
+    }
+    return ticks;
+}
+
+} // namespace
+
+TEST(DataValidatorTest, RulesInBasisPoints) {
+    DataValidator validator;
+    const DataValidator::Thresholds& limits = validator.get_thresholds();
+    EXPECT_EQ(limits.max_spread_bp, 500);
+    EXPECT_EQ(limits.max_jump_bp, 2000);
+    EXPECT_EQ(limits.min_ratio_bp, 100);
+
+    const MarketTick good = quote(1, 100.00, 100.10);
+    EXPECT_TRUE(validator.validate_market_tick(good));
+    EXPECT_FALSE(validator.validate_market_tick(quote(1, 100.10, 100.00)));      // Crossed
+    EXPECT_FALSE(validator.validate_market_tick(quote(1, 97.0, 103.0)));         // 6% spread
+    EXPECT_TRUE(validator.validate_market_tick(quote(1, 97.5, 102.5)));          // Exactly 5%
+    EXPECT_FALSE(validator.validate_market_tick(quote(1, 100.0, 100.1, 0)));     // Volume
+    EXPECT_FALSE(validator.validate_market_tick(quote(1, 0.0, 100.1)));
+
+    const MarketTick jumped = quote(1, 125.0, 125.1);
+    EXPECT_FALSE(validator.validate_market_tick(jumped, &good));                 // +25%
+    EXPECT_TRUE(validator.validate_market_tick(quote(1, 119.0, 119.1), &good));  // +19%
+
+    EXPECT_EQ(validator.get_validated_count(), 8u);
+    EXPECT_EQ(validator.get_rejected_count(), 5u);
+    EXPECT_DOUBLE_EQ(validator.get_rejection_rate(), 5.0 / 8.0);
+
+    DataValidator::ValidationRules rules;
+    rules.min_bid_ask_ratio = 0.9;
+    rules.max_spread_pct = 100.0;
+    DataValidator strict(rules);
+    EXPECT_FALSE(strict.validate_market_tick(quote(1, 80.0, 100.0)));            // 0.8 < 0.9
+    EXPECT_TRUE(strict.validate_market_tick(quote(1, 90.0, 100.0)));
+}
+
+TEST(DataValidatorTest, BatchTracksLastGoodQuotePerSymbol) {
+    DataValidator validator;
+    const MarketTick block[] = {
+        quote(1, 100.0, 100.1),
+        quote(2, 50.0, 50.1),
+        quote(1, 130.0, 130.1),     // Jump from symbol 1's first quote
+        quote(1, 110.0, 110.1),     // Fine against it: the rejected tick is not remembered
+        quote(2, 55.0, 55.1),
+    };
+    EXPECT_EQ(validator.validate_market_batch(block, 5), 0b00100u);
+    EXPECT_EQ(validator.last_good_quote(1), Price(110.0).value + Price(110.1).value);
+    EXPECT_EQ(validator.last_good_quote(2), Price(55.0).value + Price(55.1).value);
+    EXPECT_EQ(validator.last_good_quote(3), 0);
+
+    // The next block continues from the table
+    const MarketTick next[] = {quote(1, 140.0, 140.1), quote(3, 10.0, 10.01)};
+    EXPECT_EQ(validator.validate_market_batch(next, 2), 0b01u);
+    EXPECT_EQ(validator.get_validated_count(), 7u);
+    EXPECT_EQ(validator.get_rejected_count(), 2u);
+}
+
+TEST(DataValidatorTest, VectorizedMatchesScalar) {
+    const std::vector<MarketTick> ticks = random_quotes(4096, 7);
+    DataValidator scalar;
+    DataValidator vectorized;
+    EXPECT_FALSE(scalar.is_vectorized());
+    vectorized.set_vectorized(true);
+    if (!vectorized.is_vectorized()) {
+        GTEST_SKIP() << "No AVX2 on this CPU";
+    }
+
+    size_t rejected = 0;
+    for (size_t offset = 0; offset < ticks.size();) {
+        const size_t n = std::min<size_t>(1 + offset % DataValidator::BATCH_SIZE, ticks.size() - offset);
+        const uint64_t expected = scalar.validate_market_batch(ticks.data() + offset, n);
+        ASSERT_EQ(vectorized.validate_market_batch(ticks.data() + offset, n), expected) << "block at " << offset;
+        rejected += static_cast<size_t>(__builtin_popcountll(expected));
+        offset += n;
+    }
+    EXPECT_GT(rejected, ticks.size() / 5);
+    EXPECT_LT(rejected, ticks.size() / 2);
+    for (uint32_t id = 0; id < 8; ++id) {
+        EXPECT_EQ(vectorized.last_good_quote(id), scalar.last_good_quote(id));
+    }
+
+    // Options against the final underlying table
+    std::vector<OptionTick> options;
+    for (size_t i = 0; i < 64; ++i) {
+        const uint8_t type = static_cast<uint8_t>(i % 2);
+        options.push_back(option(static_cast<uint32_t>(1 + i % 8), type, 95.0 + i % 10, 0.5 * (i % 13), 0.5 * (i % 13) + 1.0));
+    }
+    options[3].bid = Price(150.0);
+    options[3].ask = Price(151.0);
+    const uint64_t option_rejects = scalar.validate_option_batch(options.data(), options.size());
+    EXPECT_EQ(vectorized.validate_option_batch(options.data(), options.size()), option_rejects);
+    EXPECT_NE(option_rejects, 0u);
+    EXPECT_NE(option_rejects, ~uint64_t(0));
+}
+
+TEST(DataValidatorTest, OptionsBoundedByUnderlying) {
+    DataValidator validator;
+    const MarketTick underlying = quote(1, 100.0, 100.2);
+    ASSERT_EQ(validator.validate_market_batch(&underlying, 1), 0u);
+
+    const OptionTick block[] = {
+        option(1, 0, 100.0, 3.0, 3.2),      // Call
+        option(1, 1, 100.0, 0.0, 0.05),     // Put, no bid
+        option(1, 0, 50.0, 101.0, 102.0),   // Call bid above the underlying
+        option(1, 1, 90.0, 91.0, 92.0),     // Put bid above the strike
+        option(2, 0, 100.0, 3.0, 3.2),      // Underlying never quoted
+        option(1, 0, 100.0, 3.2, 3.0),      // Crossed
+    };
+    EXPECT_EQ(validator.validate_option_batch(block, 6), 0b111100u);
+
+    EXPECT_TRUE(validator.validate_option_tick(block[0], underlying));
+    EXPECT_FALSE(validator.validate_option_tick(block[2], underlying));
+    EXPECT_FALSE(validator.validate_option_tick(block[0], MarketTick{}));
+}
+
+TEST(DataValidatorTest, RingBatchesValidateByEventType) {
+    DataValidator validator;
+    std::vector<DataEvent> events;
+    events.emplace_back(DataEventType::MARKET_TICK, quote(1, 100.0, 100.1));
+    events.emplace_back(DataEventType::OPTION_TICK, option(1, 0, 100.0, 2.0, 2.1));
+    events.emplace_back(DataEventType::TRADE, quote(1, 0.0, 0.0));                 // Not checked
+    events.emplace_back(DataEventType::MARKET_TICK, quote(1, 100.1, 100.0));       // Crossed
+    events.emplace_back(DataEventType::OPTION_TICK, option(1, 0, 100.0, 120.0, 121.0));
+    EXPECT_EQ(validator.validate_events(events.data(), events.size()), 0b11000u);
+    EXPECT_EQ(validator.get_validated_count(), 4u);
+}
+
+TEST(DataValidatorTest, EngineDropsRejectedTicks) {
+    DataIngestionEngine::Config config;
+    config.num_worker_threads = 1;
+    config.tech_symbols = {"AAPL"};
+    config.validate_data = true;
+    DataIngestionEngine engine(config);
+    std::vector<uint32_t> volumes;
+    engine.subscribe_to_events([&](const DataEvent& event) { volumes.push_back(event.market_tick.volume); });
+    engine.initialize();
+    const uint32_t id = engine.get_symbol_mapper().find_id("AAPL");
+
+    engine.start();
+    for (uint32_t i = 1; i <= 100; ++i) {
+        const MarketTick tick = i % 10 == 0 ? quote(id, 100.1, 100.0, i) : quote(id, 100.0, 100.1, i);
+        EXPECT_EQ(engine.publish_event(DataEvent(DataEventType::MARKET_TICK, tick)), i % 10 != 0);
+    }
+    engine.stop();
+
+    EXPECT_EQ(engine.get_events_processed(), 90u);   // Rejected ticks never enter the ring
+    EXPECT_EQ(engine.get_events_validated(), 100u);
+    EXPECT_EQ(engine.get_events_rejected(), 10u);
+    ASSERT_EQ(volumes.size(), 90u);
+    for (size_t i = 1; i < volumes.size(); ++i) {
+        EXPECT_LT(volumes[i - 1], volumes[i]);      // Order kept
+        EXPECT_NE(volumes[i] % 10, 0u);
+    }
+}
+
+TEST(DataValidatorTest, EngineJumpRejectionsAreDeterministic) {
+    // Per symbol and publisher: 100, 150 (jump), 101, 130 (jump), 102.
+    // Volume encodes (publisher, symbol, step) so survivors are known.
+    const double mids[5] = {100.0, 150.0, 101.0, 130.0, 102.0};
+    constexpr uint32_t PUBLISHERS = 3;
+
+    for (int run = 0; run < 5; ++run) {
+        DataIngestionEngine::Config config;
+        config.num_worker_threads = 4;
+        config.validate_data = true;
+        DataIngestionEngine engine(config);
+        std::mutex mutex;
+        std::vector<uint32_t> accepted;
+        engine.subscribe_to_events([&](const DataEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex);
+            accepted.push_back(event.market_tick.volume);
+        });
+        engine.initialize();
+        std::vector<uint32_t> ids;
+        for (const auto& symbol : config.tech_symbols) {
+            ids.push_back(engine.get_symbol_mapper().find_id(symbol));
+        }
+        auto events_for = [&](uint32_t publisher) {
+            std::vector<DataEvent> events;
+            for (uint32_t step = 0; step < 5; ++step) {
+                for (uint32_t s = 0; s < ids.size(); ++s) {
+                    const uint32_t volume = 1 + publisher * 1000 + s * 10 + step;
+                    events.emplace_back(DataEventType::MARKET_TICK,
+                                        quote(ids[s], mids[step], mids[step] + 0.1, volume), Timestamp(1));
+                }
+            }
+            return events;
+        };
+
+        engine.start();
+        std::vector<std::thread> threads;
+        for (uint32_t publisher = 0; publisher < PUBLISHERS; ++publisher) {
+            threads.emplace_back([&, publisher] {
+                const std::vector<DataEvent> events = events_for(publisher);
+                if (publisher == 0) {
+                    for (const DataEvent& event : events) engine.publish_event(event);
+                } else if (publisher == 1) {
+                    engine.publish_events(events.data(), events.size());
+                } else {
+                    engine.publish_in_place(events.size(), [&](DataEvent& slot, size_t i) { slot = events[i]; });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        engine.stop();
+
+        const size_t per_publisher = 5 * ids.size();
+        EXPECT_EQ(engine.get_events_validated(), PUBLISHERS * per_publisher);
+        EXPECT_EQ(engine.get_events_rejected(), PUBLISHERS * 2 * ids.size());
+        std::sort(accepted.begin(), accepted.end());
+        ASSERT_EQ(accepted.size(), PUBLISHERS * 3 * ids.size());
+        for (uint32_t volume : accepted) {
+            const uint32_t step = (volume - 1) % 10;
+            EXPECT_TRUE(step == 0 || step == 2 || step == 4) << "run " << run << " volume " << volume;
+        }
+    }
+}
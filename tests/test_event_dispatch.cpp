@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include "../include/event_dispatch.h"
+#include <atomic>
+#include <memory>
+
+using namespace hft::data;
+
+namespace {
+
+struct MarketCounter {
+    uint64_t ticks = 0;
+    int64_t last_bid = 0;
+    void on_market_data(const MarketTick& tick) {
+        ++ticks;
+        last_bid = tick.bid.value;
+    }
+};
+
+struct OptionsCounter {
+    uint64_t options = 0;
+    void on_options_data(const OptionTick&) { ++options; }
+};
+
+struct BothCounter {
+    std::atomic<uint64_t> ticks{0};
+    std::atomic<uint64_t> options{0};
+    void on_market_data(const MarketTick&) { ticks.fetch_add(1, std::memory_order_relaxed); }
+    void on_options_data(const OptionTick&) { options.fetch_add(1, std::memory_order_relaxed); }
+};
+
+} // namespace
+
+class EventDispatchTest : public ::testing::Test {
+protected:
+    static DataEvent market_event(uint32_t symbol_id, double bid, DataEventType type = DataEventType::MARKET_TICK) {
+        MarketTick tick{};
+        tick.symbol_id = symbol_id;
+        tick.bid = Price(bid);
+        return DataEvent(type, tick, Timestamp(1));
+    }
+
+    // Options route on their underlying, whatever the contract id
+    static DataEvent option_event(uint32_t underlying_id, uint32_t contract_id = 90001) {
+        OptionTick tick{};
+        tick.symbol_id = contract_id;
+        tick.underlying_id = underlying_id;
+        return DataEvent(DataEventType::OPTION_TICK, tick, Timestamp(1));
+    }
+};
+
+TEST_F(EventDispatchTest, HandlerTraitsDetectMethods) {
+    EXPECT_TRUE(detail::handles_market_data<MarketCounter>::value);
+    EXPECT_FALSE(detail::handles_options_data<MarketCounter>::value);
+    EXPECT_TRUE(detail::handles_options_data<OptionsCounter>::value);
+    EXPECT_TRUE(detail::handles_market_data<BothCounter>::value);
+}
+
+TEST_F(EventDispatchTest, RoutesByEventType) {
+    MarketCounter market;
+    OptionsCounter options;
+    BothCounter both;
+    EventPipeline<MarketCounter, OptionsCounter, BothCounter> pipeline(market, options, both);
+
+    pipeline.dispatch(market_event(1, 100.0));
+    pipeline.dispatch(market_event(1, 101.0, DataEventType::TRADE));
+    pipeline.dispatch(option_event(1));
+    pipeline.dispatch(market_event(1, 102.0, DataEventType::NEWS));  // Not market data
+
+    EXPECT_EQ(market.ticks, 2u);
+    EXPECT_EQ(market.last_bid, Price(101.0).value);
+    EXPECT_EQ(options.options, 1u);
+    EXPECT_EQ(both.ticks.load(), 2u);
+    EXPECT_EQ(both.options.load(), 1u);
+}
+
+TEST_F(EventDispatchTest, RoutesBySymbol) {
+    MarketCounter all_symbols;
+    MarketCounter aapl_only;
+    EventPipeline<MarketCounter, MarketCounter> pipeline(all_symbols, aapl_only);
+    pipeline.route_only<1>({3});
+
+    const DataEvent events[] = {market_event(3, 1.0), market_event(4, 1.0), market_event(3, 1.0),
+                                market_event(static_cast<uint32_t>(hft::constants::MAX_SYMBOLS), 1.0)};
+    pipeline.dispatch(events, 4);
+
+    EXPECT_EQ(all_symbols.ticks, 3u);  // Out-of-range id is dropped
+    EXPECT_EQ(aapl_only.ticks, 2u);
+
+    pipeline.route<1>(4, true);
+    pipeline.route<0>(3, false);
+    pipeline.dispatch(events, 3);
+    EXPECT_EQ(all_symbols.ticks, 4u);
+    EXPECT_EQ(aapl_only.ticks, 5u);
+}
+
+TEST_F(EventDispatchTest, OptionsRouteOnUnderlying) {
+    OptionsCounter all_symbols;
+    OptionsCounter aapl_only;
+    EventPipeline<OptionsCounter, OptionsCounter> pipeline(all_symbols, aapl_only);
+    pipeline.route_only<1>({3});
+
+    pipeline.dispatch(option_event(3, 4));         // Contract id collides with another symbol
+    pipeline.dispatch(option_event(4, 3));
+    pipeline.dispatch(option_event(3, 0xFFFFFFF0u));   // Hashed contract id, far out of range
+    EXPECT_EQ(all_symbols.options, 3u);
+    EXPECT_EQ(aapl_only.options, 2u);
+}
+
+TEST_F(EventDispatchTest, EngineDeliversBatchesThroughSink) {
+    BothCounter handler;
+    EventPipeline<BothCounter> pipeline(handler);
+
+    // Handlers are single-threaded: the sink needs a one-worker engine
+    EXPECT_FALSE(std::make_unique<DataIngestionEngine>()->set_event_sink(pipeline.sink()));
+
+    DataIngestionEngine::Config config;
+    config.num_worker_threads = 1;
+    auto engine = std::make_unique<DataIngestionEngine>(config);
+    ASSERT_TRUE(engine->set_event_sink(pipeline.sink()));
+    engine->start();
+    EXPECT_FALSE(engine->set_event_sink(pipeline.sink()));   // Not while running
+    for (int i = 0; i < 1000; ++i) {
+        engine->publish_event(i % 4 == 0 ? option_event(2) : market_event(2, 50.0));
+    }
+    engine->stop();
+
+    EXPECT_EQ(handler.ticks.load(), 750u);
+    EXPECT_EQ(handler.options.load(), 250u);
+}
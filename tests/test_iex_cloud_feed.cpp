@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include "../include/data_ingestion.h"
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace hft::data;
+
+namespace {
+
+const char* const QUOTE_BODY = R"({
+    "symbol": "AAPL", "companyName": "Apple Inc.", "primaryExchange": "NASDAQ",
+    "latestPrice": 231.37, "latestSource": "IEX real time price", "latestUpdate": 1760443200123,
+    "iexBidPrice": 231.35, "iexBidSize": 100, "iexAskPrice": 231.4, "iexAskSize": 300,
+    "latestVolume": 48211734, "extendedPrice": null, "week52High": 260.1,
+    "tags": ["tech", {"nested": "}"}], "isUSMarketOpen": true
+})";
+
+const char* const CHAIN_BODY = R"([
+    {"symbol":"AAPL","id":"AAPL20261120C00230000","expirationDate":"20261120","contractSize":100,
+     "strikePrice":230,"closingPrice":9.1,"side":"call","type":"equity","volume":1520,"openInterest":15600,
+     "bid":9.05,"ask":9.2,"lastUpdated":"2026-10-14","isAdjusted":false,"impliedVolatility":0.284},
+    {"symbol":"AAPL","id":"AAPL20261120P00230000","expirationDate":20261120,"strikePrice":230.0,
+     "side":"put","volume":980,"openInterest":12001,"bid":7.8,"ask":7.95,"impliedVolatility":null},
+    {"symbol":"AAPL","id":"AAPL20261120X","expirationDate":"20261120","strikePrice":null,"side":"call"}
+])";
+
+} // namespace
+
+TEST(IEXCloudFeedTest, ParsesQuoteInPlace) {
+    MarketTick tick{};
+    tick.symbol_id = 9;
+    ASSERT_TRUE(IEXCloudFeed::parse_quote(QUOTE_BODY, tick));
+    EXPECT_EQ(tick.symbol_id, 9u);
+    EXPECT_EQ(tick.last.value, 2313700);
+    EXPECT_EQ(tick.bid.value, 2313500);
+    EXPECT_EQ(tick.ask.value, 2314000);
+    EXPECT_EQ(tick.bid_size, 100u);
+    EXPECT_EQ(tick.ask_size, 300u);
+    EXPECT_EQ(tick.volume, 48211734u);
+    EXPECT_EQ(tick.timestamp.nanoseconds_since_epoch, 1760443200123000000ull);
+
+    MarketTick rejected{};
+    EXPECT_FALSE(IEXCloudFeed::parse_quote(R"({"latestPrice":null})", rejected));
+    const std::string truncated(QUOTE_BODY, 120);
+    EXPECT_FALSE(IEXCloudFeed::parse_quote(truncated, rejected));
+}
+
+TEST(IEXCloudFeedTest, ParsesOptionsChainIntoReusedStorage) {
+    std::vector<OptionTick> chain;
+    ASSERT_TRUE(IEXCloudFeed::parse_options_chain(CHAIN_BODY, 4, 20261014, chain));
+    ASSERT_EQ(chain.size(), 2u);   // Third contract has no strike
+
+    const OptionTick& call = chain[0];
+    EXPECT_EQ(call.underlying_id, 4u);
+    EXPECT_EQ(call.option_type, 0);
+    EXPECT_EQ(call.strike.value, 2300000);
+    EXPECT_EQ(call.bid.value, 90500);
+    EXPECT_EQ(call.ask.value, 92000);
+    EXPECT_EQ(call.last.value, 91000);
+    EXPECT_EQ(call.expiration_date, 20261120u);
+    EXPECT_EQ(call.days_to_expiry, 37);
+    EXPECT_EQ(call.volume, 1520u);
+    EXPECT_EQ(call.open_interest, 15600u);
+    EXPECT_DOUBLE_EQ(call.implied_volatility, 0.284);
+
+    const OptionTick& put = chain[1];
+    EXPECT_EQ(put.option_type, 1);
+    EXPECT_EQ(put.expiration_date, 20261120u);
+    EXPECT_EQ(put.implied_volatility, 0.0);
+    EXPECT_NE(put.symbol_id, call.symbol_id);
+    // Published events carry the underlying, the contract stays on the tick
+    const DataEvent event(DataEventType::OPTION_TICK, call, Timestamp(1));
+    EXPECT_EQ(event.symbol_id, 4u);
+    EXPECT_EQ(event.option_tick.symbol_id, call.symbol_id);
+
+    // Same storage on the next snapshot
+    const OptionTick* storage = chain.data();
+    const size_t capacity = chain.capacity();
+    ASSERT_TRUE(IEXCloudFeed::parse_options_chain(CHAIN_BODY, 4, 20261014, chain));
+    EXPECT_EQ(chain.data(), storage);
+    EXPECT_EQ(chain.capacity(), capacity);
+
+    EXPECT_FALSE(IEXCloudFeed::parse_options_chain(R"([{"strikePrice":1,)", 4, 20261014, chain));
+    EXPECT_FALSE(IEXCloudFeed::parse_options_chain(R"({"error":"unknown symbol"})", 4, 20261014, chain));
+}
+
+TEST(IEXCloudFeedTest, FactoryRequiresToken) {
+    EXPECT_EQ(DataFeedFactory::create_feed(DataFeedFactory::FeedType::IEX_CLOUD, "url=http://127.0.0.1:1"),
+              nullptr);
+#ifdef HAS_CURL
+    EXPECT_NE(DataFeedFactory::create_feed(DataFeedFactory::FeedType::IEX_CLOUD, "token=pk_test;options=202611"),
+              nullptr);
+#endif
+}
+
+#ifdef HAS_CURL
+
+namespace {
+
+// Minimal HTTP/1.1 keep-alive server answering quote requests
+class QuoteServer {
+public:
+    QuoteServer() {
+        listener_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(listener_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(listener_, 16);
+        socklen_t length = sizeof(address);
+        getsockname(listener_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+        thread_ = std::thread(&QuoteServer::run, this);
+    }
+
+    ~QuoteServer() {
+        stop_ = true;
+        thread_.join();
+        close(listener_);
+    }
+
+    uint16_t port() const { return port_; }
+    size_t connections() const { return connections_.load(); }
+
+    std::vector<std::string> paths() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return paths_;
+    }
+
+private:
+    void run() {
+        std::vector<pollfd> fds{{listener_, POLLIN, 0}};
+        std::map<int, std::string> pending;
+        while (!stop_) {
+            if (poll(fds.data(), fds.size(), 10) <= 0) continue;
+            if (fds[0].revents & POLLIN) {
+                const int client = accept(listener_, nullptr, nullptr);
+                if (client >= 0) {
+                    ++connections_;
+                    fds.push_back({client, POLLIN, 0});
+                }
+            }
+            for (size_t i = 1; i < fds.size(); ++i) {
+                if (!(fds[i].revents & (POLLIN | POLLHUP))) continue;
+                char buffer[4096];
+                const ssize_t n = recv(fds[i].fd, buffer, sizeof(buffer), 0);
+                if (n <= 0) {
+                    close(fds[i].fd);
+                    pending.erase(fds[i].fd);
+                    fds.erase(fds.begin() + static_cast<ptrdiff_t>(i--));
+                    continue;
+                }
+                std::string& data = pending[fds[i].fd];
+                data.append(buffer, static_cast<size_t>(n));
+                for (size_t end; (end = data.find("\r\n\r\n")) != std::string::npos;) {
+                    respond(fds[i].fd, data.substr(0, end));
+                    data.erase(0, end + 4);
+                }
+            }
+        }
+        for (size_t i = 1; i < fds.size(); ++i) close(fds[i].fd);
+    }
+
+    void respond(int fd, const std::string& request) {
+        const size_t start = request.find(' ') + 1;
+        const std::string path = request.substr(start, request.find(' ', start) - start);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            paths_.push_back(path);
+        }
+        const std::string body = path.find("/MSFT/") != std::string::npos
+                               ? R"({"latestPrice":415.02,"iexBidPrice":415,"iexAskPrice":415.05})"
+                               : R"({"latestPrice":231.37,"iexBidPrice":231.35,"iexAskPrice":231.4})";
+        const std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                                     "Connection: keep-alive\r\nContent-Length: " +
+                                     std::to_string(body.size()) + "\r\n\r\n" + body;
+        send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+    }
+
+    int listener_ = -1;
+    uint16_t port_ = 0;
+    std::atomic<bool> stop_{false};
+    std::atomic<size_t> connections_{0};
+    std::mutex mutex_;
+    std::vector<std::string> paths_;
+    std::thread thread_;
+};
+
+} // namespace
+
+TEST(IEXCloudFeedTest, PollsEverySymbolOverOneKeptAliveConnection) {
+    QuoteServer server;
+    IEXCloudFeed::Config config;
+    config.base_url = "http://127.0.0.1:" + std::to_string(server.port()) + "/stable";
+    config.poll_interval_ms = 5;
+    IEXCloudFeed feed("pk_test", config);
+
+    std::mutex mutex;
+    std::vector<MarketTick> ticks;
+    feed.set_market_callback([&](const MarketTick& tick) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ticks.push_back(tick);
+    });
+    feed.subscribe_symbol("AAPL");
+    feed.subscribe_symbol("MSFT");
+    feed.subscribe_symbol("AAPL");   // Ignored
+    ASSERT_TRUE(feed.connect());
+    feed.start_feed();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (feed.get_responses() < 6 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    feed.stop_feed();
+
+    EXPECT_GE(feed.get_responses(), 6u);
+    EXPECT_GE(feed.get_poll_cycles(), 3u);
+    EXPECT_EQ(feed.get_request_failures(), 0u);
+    EXPECT_EQ(feed.get_parse_failures(), 0u);
+    EXPECT_EQ(server.connections(), 1u);
+
+    const std::vector<std::string> paths = server.paths();
+    ASSERT_GE(paths.size(), 2u);
+    EXPECT_EQ(paths[0], "/stable/stock/AAPL/quote?token=pk_test");
+    EXPECT_EQ(paths[1], "/stable/stock/MSFT/quote?token=pk_test");
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_GE(ticks.size(), 2u);
+    for (const MarketTick& tick : ticks) {
+        EXPECT_NE(tick.symbol_id, 0u);
+        EXPECT_GT(tick.ask, tick.bid);
+    }
+}
+
+#endif
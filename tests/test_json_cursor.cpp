@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "../include/json_cursor.h"
+#include <string>
+
+using namespace hft::data;
+
+namespace {
+
+JsonCursor cursor(const std::string& text) {
+    return JsonCursor(text.data(), text.size());
+}
+
+} // namespace
+
+TEST(JsonCursorTest, ReadsSelectedFieldsAndSkipsTheRest) {
+    const std::string text =
+        R"({"name":"A\"B\\", "nested":{"x":[1,{"y":"]}"}],"z":null}, "price":123.45678,)"
+        R"( "size":250, "flag":true, "list":["a","b"], "ratio":-1.5e-3})";
+    JsonCursor json = cursor(text);
+    ASSERT_TRUE(json.enter_object());
+
+    std::string_view key;
+    std::string_view name;
+    Price price;
+    uint64_t size = 0;
+    bool flag = false;
+    double ratio = 0;
+    size_t keys = 0;
+    while (json.next_key(key)) {
+        ++keys;
+        if (key == "name") EXPECT_TRUE(json.read_string(name));
+        else if (key == "price") EXPECT_TRUE(json.read_price(price));
+        else if (key == "size") EXPECT_TRUE(json.read_uint(size));
+        else if (key == "flag") EXPECT_TRUE(json.read_bool(flag));
+        else if (key == "ratio") EXPECT_TRUE(json.read_double(ratio));
+        else EXPECT_TRUE(json.skip());
+    }
+    EXPECT_TRUE(json.ok());
+    EXPECT_TRUE(json.at_end());
+    EXPECT_EQ(keys, 7u);
+    EXPECT_EQ(name, R"(A\"B\\)");          // Escapes stay in the view
+    EXPECT_EQ(price.value, 1234568);       // Fifth decimal rounds half-up
+    EXPECT_EQ(size, 250u);
+    EXPECT_TRUE(flag);
+    EXPECT_DOUBLE_EQ(ratio, -0.0015);
+}
+
+TEST(JsonCursorTest, NullsAndTypeMismatchesAreNotErrors) {
+    const std::string text = R"([null, "12.5", 3.9, 1e2, []])";
+    JsonCursor json = cursor(text);
+    ASSERT_TRUE(json.enter_array());
+
+    Price price = Price::from_basis_points(7);
+    uint64_t count = 0;
+    ASSERT_TRUE(json.next_element());
+    EXPECT_FALSE(json.read_price(price));  // null
+    ASSERT_TRUE(json.next_element());
+    EXPECT_FALSE(json.read_price(price));  // String, not a number
+    EXPECT_EQ(price.value, 7);
+    ASSERT_TRUE(json.next_element());
+    EXPECT_TRUE(json.read_uint(count));
+    EXPECT_EQ(count, 3u);                  // Truncated
+    ASSERT_TRUE(json.next_element());
+    EXPECT_TRUE(json.read_price(price));
+    EXPECT_EQ(price.value, 1000000);
+    ASSERT_TRUE(json.next_element());
+    EXPECT_FALSE(json.read_uint(count));   // Array
+    EXPECT_FALSE(json.next_element());
+    EXPECT_TRUE(json.ok());
+}
+
+TEST(JsonCursorTest, RejectsMalformedInput) {
+    for (const std::string text : {R"({"a":1,})", R"({"a" 1})", R"({"a":"open)", R"({"a":[1,2})", R"([1,])",
+                                   R"({"a":nul})"}) {
+        JsonCursor json = cursor(text);
+        std::string_view key;
+        bool structure = text[0] == '{' ? json.enter_object() : json.enter_array();
+        ASSERT_TRUE(structure) << text;
+        if (text[0] == '{') {
+            while (json.next_key(key)) json.skip();
+        } else {
+            while (json.next_element()) json.skip();
+        }
+        EXPECT_FALSE(json.ok()) << text;
+    }
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include "../include/latency_tracker.h"
+#include "../include/data_ingestion.h"
+#include "../include/straddle_strategy.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace hft::data;
+
+namespace {
+
+uint64_t stage_total(LatencyStage stage) {
+    return LatencyTracker::snapshot(stage).total();
+}
+
+} // namespace
+
+TEST(LatencyTrackerTest, BucketsCoverValuesWithBoundedError) {
+    size_t previous = 0;
+    for (uint64_t value = 0; value < (1ull << 20); value = value < 1000 ? value + 1 : value + value / 7) {
+        const size_t bucket = LatencyHistogram::bucket_of(value);
+        ASSERT_LT(bucket, LatencyHistogram::BUCKETS);
+        EXPECT_GE(bucket, previous);
+        EXPECT_LE(LatencyHistogram::lowest_in(bucket), value);
+        EXPECT_GE(LatencyHistogram::highest_in(bucket), value);
+        const uint64_t width = LatencyHistogram::highest_in(bucket) - LatencyHistogram::lowest_in(bucket) + 1;
+        EXPECT_LE(static_cast<double>(width), 1.0 + static_cast<double>(value) / LatencyHistogram::SUB_COUNT);
+        previous = bucket;
+    }
+    EXPECT_EQ(LatencyHistogram::bucket_of(127), 127u);   // Exact range
+    EXPECT_EQ(LatencyHistogram::bucket_of(UINT64_MAX), LatencyHistogram::BUCKETS - 1);
+    EXPECT_EQ(LatencyHistogram::bucket_of(1ull << 40), LatencyHistogram::BUCKETS - 1);
+}
+
+TEST(LatencyTrackerTest, PercentilesOfKnownDistribution) {
+    auto histogram = std::make_unique<LatencyHistogram>();
+    for (uint64_t value = 1; value <= 10000; ++value) {
+        histogram->record(value);
+    }
+    HistogramSnapshot snapshot;
+    EXPECT_EQ(snapshot.percentile(0.5), 0u);
+    snapshot.add(*histogram);
+
+    EXPECT_EQ(snapshot.total(), 10000u);
+    EXPECT_EQ(snapshot.max(), 10000u);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.50)), 5000.0, 5000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.99)), 9900.0, 9900.0 / 64);
+    EXPECT_NEAR(static_cast<double>(snapshot.percentile(0.999)), 9990.0, 9990.0 / 64);
+    EXPECT_EQ(snapshot.percentile(1.0), 10000u);
+    EXPECT_EQ(snapshot.percentile(0.0), 1u);
+}
+
+TEST(LatencyTrackerTest, MergesThreadsAndKeepsCountsAcrossThreadExit) {
+    const uint64_t before = stage_total(LatencyStage::ORDER_SUBMIT);
+    auto work = [] {
+        for (int i = 0; i < 1000; ++i) {
+            LatencyTracker::record(LatencyStage::ORDER_SUBMIT, 100 + i);
+        }
+    };
+    std::thread a(work), b(work);
+    a.join();
+    b.join();
+    std::thread c(work);   // May take over a slot left behind by a or b
+    c.join();
+
+    const HistogramSnapshot merged = LatencyTracker::snapshot(LatencyStage::ORDER_SUBMIT);
+    EXPECT_EQ(merged.total(), before + 3000);
+    EXPECT_GE(merged.max(), 1099u);
+}
+
+TEST(LatencyTrackerTest, RegisteredThreadRecordsIntoItsSlot) {
+    LatencyHistogram* registered = nullptr;
+    LatencyHistogram* recorded = nullptr;
+    std::thread worker([&] {
+        if (LatencyTracker::register_thread()) {
+            registered = LatencyTracker::local(LatencyStage::FEED_RECEIVE);
+        }
+        LatencyTracker::record(LatencyStage::FEED_RECEIVE, 250);
+        recorded = LatencyTracker::local(LatencyStage::FEED_RECEIVE);
+    });
+    worker.join();
+    ASSERT_NE(registered, nullptr);
+    EXPECT_EQ(recorded, registered);
+}
+
+TEST(LatencyTrackerTest, TscClockIsCalibratedAgainstTimestamp) {
+    const uint64_t tsc = TscClock::now();
+    const uint64_t now = Timestamp::now().nanoseconds_since_epoch;
+    const int64_t skew = static_cast<int64_t>(TscClock::to_epoch_ns(tsc)) - static_cast<int64_t>(now);
+    EXPECT_LT(std::llabs(skew), 1000000);   // Within 1 ms
+
+    const uint64_t start = TscClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    const uint64_t elapsed = TscClock::to_nanoseconds(TscClock::now() - start);
+    EXPECT_GE(elapsed, 4500000u);
+    EXPECT_LT(elapsed, 500000000u);
+}
+
+TEST(LatencyTrackerTest, HotPathStagesAreTraced) {
+    DataIngestionEngine::Config config;
+    config.num_worker_threads = 1;
+    config.tech_symbols = {"AAPL"};
+    DataIngestionEngine engine(config);
+    engine.subscribe_to_events([](const DataEvent&) {});
+    engine.initialize();
+
+    const uint64_t batches = stage_total(LatencyStage::PROCESS_BATCH);
+    const uint64_t distributed = stage_total(LatencyStage::DISTRIBUTE_EVENT);
+    const uint64_t ticks = stage_total(LatencyStage::STRATEGY_TICK);
+
+    engine.start();
+    MarketTick tick{};
+    tick.symbol_id = engine.get_symbol_mapper().find_id("AAPL");
+    tick.bid = Price(100.0);
+    tick.ask = Price(100.1);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(engine.publish_event(DataEvent(DataEventType::MARKET_TICK, tick)));
+    }
+    engine.stop();   // Drains the ring
+    ASSERT_EQ(engine.get_events_processed(), 10u);
+
+    LatencyReport report;
+    engine.get_latency_report(report);
+    const auto& process = report[static_cast<size_t>(LatencyStage::PROCESS_BATCH)];
+    EXPECT_GT(process.count, batches);
+    EXPECT_GE(process.p99_ns, process.p50_ns);
+    EXPECT_GE(process.max_ns, process.p999_ns);
+    EXPECT_EQ(report[static_cast<size_t>(LatencyStage::DISTRIBUTE_EVENT)].count, distributed + 10);
+
+    hft::strategy::StraddleStrategy strategy;
+    ASSERT_TRUE(strategy.initialize());
+    strategy.on_market_data(tick);
+    EXPECT_EQ(stage_total(LatencyStage::STRATEGY_TICK), ticks + 1);
+
+    LatencyTracker::set_enabled(false);
+    strategy.on_market_data(tick);
+    LatencyTracker::set_enabled(true);
+    EXPECT_EQ(stage_total(LatencyStage::STRATEGY_TICK), ticks + 1);
+}
+
+TEST(LatencyTrackerTest, ReporterDumpsPeriodically) {
+    LatencyTracker::record(LatencyStage::ENTRY_ANALYSIS, 250);
+
+    std::mutex mutex;
+    std::string last;
+    LatencyReporter reporter(5, [&](const std::string& text) {
+        std::lock_guard<std::mutex> lock(mutex);
+        last = text;
+    });
+    ASSERT_TRUE(reporter.start());
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (reporter.reports_written() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    reporter.stop();
+    EXPECT_GE(reporter.reports_written(), 2u);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_NE(last.find("[LATENCY] entry_analysis"), std::string::npos);
+    EXPECT_NE(last.find("p99.9="), std::string::npos);
+
+    LatencyTracker::reset();
+    LatencyReport report;
+    LatencyTracker::report(report);
+    for (const StageLatency& stage : report) {
+        EXPECT_EQ(stage.count, 0u);
+    }
+    EXPECT_TRUE(LatencyTracker::format_report(report).empty());
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "../include/market_data.h"
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+
+class MarketAggregatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        aggregator_ = std::make_unique<MarketDataAggregator>();
+
+        std::mt19937_64 rng(7);
+        std::normal_distribution<double> step(0.0, 0.002);
+        std::uniform_int_distribution<uint32_t> size(1, 5000);
+        double mid = 150.0;
+        for (size_t i = 0; i < NUM_TICKS; ++i) {
+            mid *= std::exp(step(rng));
+            MarketTick tick{};
+            tick.timestamp = Timestamp(1000 + i);
+            tick.symbol_id = SYMBOL;
+            tick.bid = Price(mid - 0.01);
+            tick.ask = Price(mid + 0.01);
+            tick.last = Price(mid);
+            tick.volume = size(rng);
+            ticks_.push_back(tick);
+            aggregator_->add_tick(tick);
+        }
+    }
+
+    double brute_vwap(size_t window) const {
+        double notional = 0.0, volume = 0.0;
+        for (size_t i = ticks_.size() - window; i < ticks_.size(); ++i) {
+            notional += ticks_[i].last.to_double() * ticks_[i].volume;
+            volume += ticks_[i].volume;
+        }
+        return notional / volume;
+    }
+
+    double brute_volatility(size_t window) const {
+        std::vector<double> returns;
+        for (size_t i = ticks_.size() - window; i < ticks_.size(); ++i) {
+            const double prev = (ticks_[i - 1].bid.to_double() + ticks_[i - 1].ask.to_double()) / 2;
+            const double cur = (ticks_[i].bid.to_double() + ticks_[i].ask.to_double()) / 2;
+            returns.push_back(std::log(cur / prev));
+        }
+        double mean = 0.0;
+        for (double r : returns) mean += r;
+        mean /= returns.size();
+        double ss = 0.0;
+        for (double r : returns) ss += (r - mean) * (r - mean);
+        return std::sqrt(ss / (returns.size() - 1));
+    }
+
+    static constexpr uint32_t SYMBOL = 42;
+    static constexpr size_t NUM_TICKS = SymbolTickSeries::HISTORY_SIZE * 2 + 123;
+    std::unique_ptr<MarketDataAggregator> aggregator_;
+    std::vector<MarketTick> ticks_;
+};
+
+TEST_F(MarketAggregatorTest, VwapMatchesBruteForce) {
+    for (size_t window : {1u, 20u, 500u, 4096u}) {
+        EXPECT_NEAR(aggregator_->calculate_vwap(SYMBOL, window), brute_vwap(window), 1e-8) << window;
+    }
+    // Windows beyond the retained history clamp to it
+    EXPECT_NEAR(aggregator_->calculate_vwap(SYMBOL, 1u << 20),
+                brute_vwap(SymbolTickSeries::HISTORY_SIZE), 1e-8);
+}
+
+TEST_F(MarketAggregatorTest, VolatilityMatchesBruteForce) {
+    for (size_t window : {2u, 20u, 1000u, 4096u}) {
+        EXPECT_NEAR(aggregator_->calculate_volatility(SYMBOL, window), brute_volatility(window), 1e-9) << window;
+    }
+    EXPECT_EQ(aggregator_->calculate_volatility(SYMBOL, 1), 0.0);
+}
+
+TEST_F(MarketAggregatorTest, LatestTickAndHistory) {
+    MarketTick latest;
+    ASSERT_TRUE(aggregator_->get_latest_tick(SYMBOL, latest));
+    EXPECT_EQ(latest.timestamp.nanoseconds_since_epoch, ticks_.back().timestamp.nanoseconds_since_epoch);
+    EXPECT_EQ(aggregator_->get_tick_count(SYMBOL), NUM_TICKS);
+
+    const auto history = aggregator_->get_price_history(SYMBOL, 10);
+    ASSERT_EQ(history.size(), 10u);
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(history[i].value, ticks_[NUM_TICKS - 10 + i].last.value);
+    }
+    EXPECT_EQ(aggregator_->get_price_history(SYMBOL, 1u << 20).size(), SymbolTickSeries::HISTORY_SIZE);
+}
+
+TEST_F(MarketAggregatorTest, UnknownAndOutOfRangeSymbols) {
+    MarketTick tick;
+    EXPECT_FALSE(aggregator_->get_latest_tick(SYMBOL + 1, tick));
+    EXPECT_EQ(aggregator_->calculate_vwap(SYMBOL + 1, 20), 0.0);
+    EXPECT_TRUE(aggregator_->get_price_history(SYMBOL + 1, 20).empty());
+
+    tick.symbol_id = static_cast<uint32_t>(hft::constants::MAX_SYMBOLS);
+    aggregator_->add_tick(tick);  // Ignored, no out-of-bounds write
+    EXPECT_EQ(aggregator_->get_tick_count(tick.symbol_id), 0u);
+}
+
+TEST_F(MarketAggregatorTest, ConcurrentWritersAndReaders) {
+    constexpr uint32_t SHARED = 7;
+    constexpr int WRITERS = 3;
+    constexpr int TICKS_PER_WRITER = 20000;
+    std::atomic<bool> done{false};
+
+    std::thread reader([&] {
+        MarketTick tick;
+        while (!done.load()) {
+            // Every tick has last == 100, so any consistent snapshot has VWAP 100
+            const double vwap = aggregator_->calculate_vwap(SHARED, 64);
+            if (vwap != 0.0) {
+                ASSERT_NEAR(vwap, 100.0, 1e-9);
+            }
+            if (aggregator_->get_latest_tick(SHARED, tick)) {
+                ASSERT_EQ(tick.last.value, Price(100.0).value);
+            }
+        }
+    });
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; ++w) {
+        writers.emplace_back([&] {
+            MarketTick tick{};
+            tick.symbol_id = SHARED;
+            tick.last = Price(100.0);
+            tick.volume = 10;
+            for (int i = 0; i < TICKS_PER_WRITER; ++i) {
+                aggregator_->add_tick(tick);
+            }
+        });
+    }
+    for (auto& t : writers) t.join();
+    done.store(true);
+    reader.join();
+
+    EXPECT_EQ(aggregator_->get_tick_count(SHARED), uint64_t(WRITERS) * TICKS_PER_WRITER);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "../include/memory_arena.h"
+#include "../include/straddle_strategy.h"
+#include "strategy_scenario.h"
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+using namespace hft::data;
+using hft::strategy::RiskManager;
+using hft::strategy::StraddleStrategy;
+using namespace hft::scenario;
+
+// ---- Heap allocation counter (only on threads that ask for it) ----
+
+namespace {
+
+thread_local bool g_counting = false;
+thread_local size_t g_allocations = 0;
+
+void* counted_alloc(size_t size, size_t alignment) {
+    if (g_counting) ++g_allocations;
+    size = size ? size : 1;
+    void* p = alignment > alignof(std::max_align_t)
+        ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+        : std::malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+} // namespace
+
+void* operator new(size_t size) { return counted_alloc(size, 0); }
+void* operator new[](size_t size) { return counted_alloc(size, 0); }
+void* operator new(size_t size, std::align_val_t a) { return counted_alloc(size, static_cast<size_t>(a)); }
+void* operator new[](size_t size, std::align_val_t a) { return counted_alloc(size, static_cast<size_t>(a)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+// Discards everything without buffering
+struct NullBuffer : std::streambuf {
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+} // namespace
+
+TEST(MemoryArenaTest, BumpAllocatesAlignedAndRewinds) {
+    MonotonicArena arena(4096);
+    ASSERT_GE(arena.capacity(), 4096u);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 64);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0u);
+    EXPECT_EQ(arena.used(), 72u);
+
+    const size_t mark = arena.mark();
+    {
+        ArenaScope scope(arena);
+        const Span<Price> prices = arena.allocate_array<Price>(16);
+        ASSERT_EQ(prices.size(), 16u);
+        EXPECT_EQ(arena.used(), mark + 16 * sizeof(Price));
+    }
+    EXPECT_EQ(arena.used(), mark);
+    EXPECT_EQ(arena.high_water(), mark + 16 * sizeof(Price));
+
+    arena.reset();
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(arena.allocate(8, 1), a);   // Same storage next cycle
+}
+
+TEST(MemoryArenaTest, ExhaustionFailsWithoutFallingBack) {
+    MonotonicArena arena(4096);
+    EXPECT_TRUE(arena.allocate_array<Price>(arena.capacity() / sizeof(Price) + 1).empty());
+    EXPECT_EQ(arena.allocate(arena.capacity() + 1), nullptr);
+    EXPECT_EQ(arena.failed_allocations(), 2u);
+    EXPECT_EQ(arena.used(), 0u);
+
+    EXPECT_NE(arena.allocate(arena.capacity(), 1), nullptr);
+    EXPECT_EQ(arena.allocate(1, 1), nullptr);
+}
+
+TEST(MemoryArenaTest, ObjectPoolRecyclesFixedSlots) {
+    ObjectPool<MarketTick> pool(3);
+    ASSERT_EQ(pool.capacity(), 3u);
+
+    MarketTick* a = pool.acquire();
+    MarketTick* b = pool.acquire();
+    MarketTick* c = pool.acquire();
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % alignof(MarketTick), 0u);
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_EQ(pool.in_use(), 3u);
+    EXPECT_TRUE(pool.owns(b));
+
+    MarketTick outside;
+    EXPECT_FALSE(pool.owns(&outside));
+
+    pool.release(b);
+    EXPECT_EQ(pool.available(), 1u);
+    EXPECT_EQ(pool.acquire(), b);   // Most recently released first
+}
+
+TEST(MemoryArenaTest, HotPathViewsMatchVectorApis) {
+    MarketDataAggregator aggregator;
+    for (int i = 0; i < 50; ++i) {
+        aggregator.add_tick(make_tick(3, START + i, 100.0 + i));
+    }
+
+    MonotonicArena arena(1 << 16);
+    const Span<Price> history = aggregator.get_price_history(3, 20, arena);
+    const std::vector<Price> expected = aggregator.get_price_history(3, 20);
+    ASSERT_EQ(history.size(), expected.size());
+    for (size_t i = 0; i < history.size(); ++i) {
+        EXPECT_EQ(history[i].value, expected[i].value);
+    }
+    EXPECT_TRUE(aggregator.get_price_history(4, 20, arena).empty());
+
+    RiskManager risk;
+    risk.update_daily_pnl(-10000.0);
+    risk.set_portfolio_value(100000.0);
+    const Span<RiskManager::Alert> alerts = risk.get_risk_alerts(arena);
+    const std::vector<std::string> messages = risk.get_risk_alerts();
+    ASSERT_EQ(alerts.size(), messages.size());
+    ASSERT_FALSE(alerts.empty());
+    EXPECT_EQ(alerts[0].kind, RiskManager::Alert::Kind::DAILY_LOSS);
+    EXPECT_DOUBLE_EQ(alerts[0].value, -10000.0);
+    EXPECT_EQ(RiskManager::describe(alerts[0]), messages[0]);
+}
+
+TEST(MemoryArenaTest, SteadyStateTickDoesNotTouchTheHeap) {
+    StraddleStrategy::Config config;
+    config.enable_trade_logging = true;
+    StraddleStrategy strategy(config);
+    ASSERT_TRUE(strategy.initialize());
+    strategy.start();
+
+    MarketDataAggregator aggregator;
+    RiskManager risk;
+    risk.set_portfolio_value(1000000.0);
+    MonotonicArena arena(1 << 20);
+
+    NullBuffer sink;
+    std::streambuf* saved = std::clog.rdbuf(&sink);
+
+    // One pass of StrategyScenario streamed bar by bar, with the rally in
+    // every call so it closes the straddle (and prices the chain out of a
+    // re-entry until the next pass)
+    size_t allocations = 0;
+    auto run_pass = [&](uint64_t base, bool count) {
+        for (int i = 0; i < StrategyScenario::BARS; ++i) {
+            if (count) g_counting = true;
+            {
+                ArenaScope cycle(arena);
+                const uint64_t ts = StrategyScenario::bar_time(base, i);
+                if (i == 0) {
+                    for (double strike : StrategyScenario::STRIKES) {
+                        strategy.on_options_data(StrategyScenario::quote(ts, strike, 0));
+                        strategy.on_options_data(StrategyScenario::quote(ts, strike, 1));
+                    }
+                }
+                if (i == StrategyScenario::RALLY_BAR + 1) {
+                    for (double strike : StrategyScenario::STRIKES) {
+                        strategy.on_options_data(StrategyScenario::rally(base, strike));
+                    }
+                }
+                const MarketTick tick = make_tick(0, ts, StrategyScenario::price(i));
+                aggregator.add_tick(tick);
+                strategy.on_market_data(tick);
+
+                const Span<Price> history = aggregator.get_price_history(0, 64, arena);
+                EXPECT_FALSE(history.empty());
+                risk.update_symbol_risk(0, strategy.get_portfolio_exposure());   // One symbol: book == symbol
+                const Span<RiskManager::Alert> alerts = risk.get_risk_alerts(arena);
+                (void)alerts;
+            }
+            if (count) {
+                allocations += g_allocations;
+                g_allocations = 0;
+                g_counting = false;
+            }
+        }
+    };
+
+    run_pass(START, false);                       // Warm-up: series, surfaces, chain slots
+    const size_t trades_before = strategy.get_total_trades_count();
+    run_pass(StrategyScenario::bar_time(START, StrategyScenario::BARS), true);
+    std::clog.rdbuf(saved);
+    strategy.stop();
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(strategy.get_total_trades_count(), trades_before + 1);   // Open and close were covered
+    EXPECT_EQ(arena.used(), 0u);
+}
@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+#include "../include/multicast_feed.h"
+#include "../include/event_dispatch.h"
+#include "../include/straddle_strategy.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace hft::data;
+
+namespace {
+
+using Verdict = SequenceArbiter::Verdict;
+
+// Datagram with consecutive messages starting at sequence
+class PacketBuilder {
+public:
+    explicit PacketBuilder(uint64_t sequence) {
+        feed_format::PacketHeader header{};
+        header.sequence = sequence;
+        append(&header, sizeof(header));
+    }
+
+    PacketBuilder& quote(const char* symbol, int64_t bid, int64_t ask, uint8_t type = feed_format::QUOTE) {
+        feed_format::QuoteMessage m{};
+        m.length = sizeof(m);
+        m.type = type;
+        m.exchange_id = 7;
+        m.symbol = SymbolKey::from(symbol).value;
+        m.timestamp = 1000;
+        m.bid = bid;
+        m.ask = ask;
+        m.last = (bid + ask) / 2;
+        m.bid_size = 100;
+        m.ask_size = 200;
+        m.volume = 300;
+        return message(&m, sizeof(m));
+    }
+
+    PacketBuilder& option(const char* underlying, uint32_t contract_id, int64_t strike) {
+        feed_format::OptionQuoteMessage m{};
+        m.length = sizeof(m);
+        m.type = feed_format::OPTION_QUOTE;
+        m.option_type = 1;
+        m.days_to_expiry = 30;
+        m.underlying = SymbolKey::from(underlying).value;
+        m.contract_id = contract_id;
+        m.expiration_date = 20261120;
+        m.strike = strike;
+        m.bid = 500;
+        m.ask = 510;
+        m.implied_volatility = 0.25;
+        return message(&m, sizeof(m));
+    }
+
+    Datagram datagram() const { return Datagram{bytes_.data(), bytes_.size(), Timestamp(42)}; }
+    const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+private:
+    PacketBuilder& message(const void* data, size_t length) {
+        append(data, length);
+        uint16_t count;
+        std::memcpy(&count, bytes_.data() + offsetof(feed_format::PacketHeader, message_count), sizeof(count));
+        ++count;
+        std::memcpy(bytes_.data() + offsetof(feed_format::PacketHeader, message_count), &count, sizeof(count));
+        return *this;
+    }
+
+    void append(const void* data, size_t length) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        bytes_.insert(bytes_.end(), p, p + length);
+    }
+
+    std::vector<uint8_t> bytes_;
+};
+
+struct Capture {
+    std::mutex mutex;
+    std::vector<DataEvent> events;
+
+    static void dispatch(void* context, const DataEvent* events, size_t count) {
+        Capture* self = static_cast<Capture*>(context);
+        std::lock_guard<std::mutex> lock(self->mutex);
+        self->events.insert(self->events.end(), events, events + count);
+    }
+};
+
+DataIngestionEngine::Config engine_config() {
+    DataIngestionEngine::Config config;
+    config.num_worker_threads = 1;
+    config.tech_symbols = {"AAPL", "MSFT"};
+    return config;
+}
+
+} // namespace
+
+TEST(SequenceArbiterTest, DropsDuplicatesAndRecoversGaps) {
+    SequenceArbiter arbiter;
+    uint64_t first = 0, count = 0;
+
+    EXPECT_EQ(arbiter.accept(100, first, count), Verdict::NEW);
+    EXPECT_EQ(arbiter.accept(101, first, count), Verdict::NEW);
+    EXPECT_EQ(arbiter.accept(101, first, count), Verdict::DUPLICATE);   // Line B copy
+    EXPECT_EQ(arbiter.accept(99, first, count), Verdict::DUPLICATE);    // Before the session start
+    EXPECT_EQ(count, 0u);
+
+    EXPECT_EQ(arbiter.accept(105, first, count), Verdict::NEW);
+    EXPECT_EQ(first, 102u);
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(arbiter.gaps(), 1u);
+    EXPECT_EQ(arbiter.outstanding(), 3u);
+
+    EXPECT_EQ(arbiter.accept(103, first, count), Verdict::RECOVERED);
+    EXPECT_EQ(arbiter.accept(103, first, count), Verdict::DUPLICATE);
+    EXPECT_EQ(arbiter.outstanding(), 2u);
+    EXPECT_EQ(arbiter.recovered(), 1u);
+    EXPECT_EQ(arbiter.next_expected(), 106u);
+
+    // Heartbeat announcing 110: 106..109 went missing
+    arbiter.observe_next(110, first, count);
+    EXPECT_EQ(first, 106u);
+    EXPECT_EQ(count, 4u);
+    EXPECT_EQ(arbiter.outstanding(), 6u);
+    EXPECT_EQ(arbiter.lost(), 0u);
+}
+
+TEST(SequenceArbiterTest, MissingSequencesLeavingTheWindowAreLost) {
+    SequenceArbiter arbiter;
+    uint64_t first = 0, count = 0;
+    arbiter.accept(0, first, count);
+    arbiter.accept(3, first, count);                  // 1, 2 missing
+
+    for (uint64_t s = 4; s < SequenceArbiter::WINDOW + 2; ++s) {
+        arbiter.accept(s, first, count);
+    }
+    EXPECT_EQ(arbiter.lost(), 1u);                    // 1 slid out, 2 still recoverable
+    EXPECT_EQ(arbiter.accept(2, first, count), Verdict::RECOVERED);
+    EXPECT_EQ(arbiter.accept(1, first, count), Verdict::DUPLICATE);
+    EXPECT_EQ(arbiter.outstanding(), 0u);
+
+    // A jump past the whole window loses everything in between
+    const uint64_t next = arbiter.next_expected();
+    arbiter.accept(next + 3 * SequenceArbiter::WINDOW, first, count);
+    EXPECT_EQ(count, 3 * SequenceArbiter::WINDOW);
+    EXPECT_EQ(arbiter.lost() + arbiter.outstanding(), 1 + 3 * SequenceArbiter::WINDOW);
+    EXPECT_EQ(arbiter.outstanding(), SequenceArbiter::WINDOW - 1);
+}
+
+TEST(MulticastFeedTest, ArbitratesLinesAndDecodesIntoTheRing) {
+    DataIngestionEngine engine(engine_config());
+    Capture capture;
+    engine.set_event_sink(EventSink{&Capture::dispatch, &capture});
+
+    auto owned = std::make_unique<MulticastFeed>(nullptr, nullptr);
+    MulticastFeed* feed = owned.get();
+    std::vector<std::pair<uint64_t, uint64_t>> gaps;
+    feed->set_gap_callback([&gaps](uint64_t first, uint64_t count) { gaps.emplace_back(first, count); });
+    engine.add_feed(std::move(owned));
+    ASSERT_TRUE(engine.initialize());
+    const uint32_t aapl = engine.get_symbol_mapper().find_id("AAPL");
+
+    PacketBuilder a1(1);
+    a1.quote("AAPL", 1000000, 1000100).quote("GOOG", 1, 2).option("AAPL", 555, 1050000);
+    PacketBuilder a2(5);                                   // 4 lost on line A
+    a2.quote("MSFT", 2000000, 2000200, feed_format::TRADE);
+    PacketBuilder b1(1);                                   // Line B: same messages plus 4
+    b1.quote("AAPL", 1000000, 1000100).quote("GOOG", 1, 2).option("AAPL", 555, 1050000)
+      .quote("AAPL", 1000200, 1000300);
+    PacketBuilder bad(6);
+    bad.quote("AAPL", 1, 2);
+    std::vector<uint8_t> truncated = bad.bytes();
+    truncated.resize(truncated.size() - 8);
+
+    const Datagram line_a[] = {a1.datagram(), a2.datagram(),
+                               Datagram{truncated.data(), truncated.size(), Timestamp(42)}};
+    const Datagram line_b[] = {b1.datagram()};
+    EXPECT_EQ(feed->process(line_a, 3, 0), 3u);            // GOOG is not subscribed
+    EXPECT_EQ(feed->process(line_b, 1, 1), 1u);            // Only the recovered 4
+
+    EXPECT_EQ(feed->packets_received(0), 3u);
+    EXPECT_EQ(feed->packets_received(1), 1u);
+    EXPECT_EQ(feed->duplicates(), 3u);
+    EXPECT_EQ(feed->malformed(), 1u);
+    EXPECT_EQ(feed->gaps(), 1u);
+    EXPECT_EQ(feed->recovered(), 1u);
+    EXPECT_EQ(feed->messages_published(), 4u);
+    ASSERT_EQ(gaps.size(), 1u);
+    EXPECT_EQ(gaps[0], std::make_pair(uint64_t(4), uint64_t(1)));
+
+    engine.start();
+    engine.stop();
+
+    std::lock_guard<std::mutex> lock(capture.mutex);
+    ASSERT_EQ(capture.events.size(), 4u);
+    const DataEvent& quote = capture.events[0];
+    EXPECT_EQ(quote.type, DataEventType::MARKET_TICK);
+    EXPECT_EQ(quote.symbol_id, aapl);
+    EXPECT_EQ(quote.timestamp.nanoseconds_since_epoch, 42u);
+    EXPECT_EQ(quote.market_tick.bid.value, 1000000);
+    EXPECT_EQ(quote.market_tick.ask.value, 1000100);
+    EXPECT_EQ(quote.market_tick.ask_size, 200u);
+    EXPECT_EQ(quote.market_tick.sequence_number, 1u);
+    EXPECT_EQ(quote.market_tick.exchange_id, 7u);
+
+    const DataEvent& option = capture.events[1];
+    ASSERT_TRUE(option.is_option());
+    EXPECT_EQ(option.symbol_id, aapl);
+    EXPECT_EQ(option.option_tick.symbol_id, 555u);
+    EXPECT_EQ(option.option_tick.underlying_id, aapl);
+    EXPECT_EQ(option.option_tick.strike.value, 1050000);
+    EXPECT_EQ(option.option_tick.option_type, 1);
+    EXPECT_DOUBLE_EQ(option.option_tick.implied_volatility, 0.25);
+
+    EXPECT_EQ(capture.events[2].type, DataEventType::TRADE);
+    EXPECT_EQ(capture.events[2].market_tick.sequence_number, 5u);
+    EXPECT_EQ(capture.events[3].market_tick.sequence_number, 4u);
+    EXPECT_EQ(capture.events[3].market_tick.bid.value, 1000200);
+}
+
+TEST(MulticastFeedTest, OptionQuotesReachTheStrategyThroughThePipeline) {
+    hft::strategy::StraddleStrategy strategy;
+    ASSERT_TRUE(strategy.initialize());
+    EventPipeline<hft::strategy::StraddleStrategy> pipeline(strategy);
+    DataIngestionEngine engine(engine_config());
+    ASSERT_TRUE(engine.set_event_sink(pipeline.sink()));
+
+    auto owned = std::make_unique<MulticastFeed>(nullptr, nullptr);
+    MulticastFeed* feed = owned.get();
+    engine.add_feed(std::move(owned));
+    ASSERT_TRUE(engine.initialize());
+    const uint32_t aapl = engine.get_symbol_mapper().find_id("AAPL");
+    const uint32_t msft = engine.get_symbol_mapper().find_id("MSFT");
+
+    // Raw exchange contract ids, well past MAX_SYMBOLS
+    PacketBuilder packet(1);
+    packet.option("AAPL", 7000001, 1050000).option("AAPL", 7000002, 1100000).option("MSFT", 7000003, 2000000);
+    const Datagram datagrams[] = {packet.datagram()};
+    ASSERT_EQ(feed->process(datagrams, 1, 0), 3u);
+    engine.start();
+    engine.stop();
+
+    const OptionsChain* chain = strategy.get_options_chain(aapl);
+    ASSERT_NE(chain, nullptr);
+    EXPECT_EQ(chain->contract_count(), 2u);
+    EXPECT_NE(chain->find(20261120, Price::from_basis_points(1100000), 1), nullptr);
+    ASSERT_NE(strategy.get_options_chain(msft), nullptr);
+    EXPECT_EQ(strategy.get_options_chain(msft)->contract_count(), 1u);
+}
+
+TEST(MulticastFeedTest, UdpSourceReceivesBatches) {
+    UdpMulticastSource source("127.0.0.1:0", "", 1 << 20);
+    ASSERT_TRUE(source.open());
+    ASSERT_TRUE(source.open());                            // Idempotent
+    ASSERT_NE(source.bound_port(), 0);
+
+    const int sender = socket(AF_INET, SOCK_DGRAM, 0);
+    ASSERT_GE(sender, 0);
+    sockaddr_in target{};
+    target.sin_family = AF_INET;
+    target.sin_port = htons(source.bound_port());
+    target.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    constexpr size_t PACKETS = 10;
+    for (size_t i = 0; i < PACKETS; ++i) {
+        PacketBuilder packet(i + 1);
+        packet.quote("AAPL", 100, 200);
+        ASSERT_EQ(sendto(sender, packet.bytes().data(), packet.bytes().size(), 0,
+                         reinterpret_cast<const sockaddr*>(&target), sizeof(target)),
+                  static_cast<ssize_t>(packet.bytes().size()));
+    }
+    close(sender);
+
+    Datagram batch[UdpMulticastSource::BATCH];
+    std::vector<uint64_t> sequences;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sequences.size() < PACKETS && std::chrono::steady_clock::now() < deadline) {
+        const size_t n = source.receive(batch, UdpMulticastSource::BATCH);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(batch[i].length, sizeof(feed_format::PacketHeader) + sizeof(feed_format::QuoteMessage));
+            feed_format::PacketHeader header;
+            std::memcpy(&header, batch[i].data, sizeof(header));
+            sequences.push_back(header.sequence);
+        }
+        if (n == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(sequences.size(), PACKETS);
+    EXPECT_EQ(sequences.front(), 1u);
+    EXPECT_EQ(sequences.back(), PACKETS);
+
+    source.close();
+    EXPECT_EQ(source.receive(batch, UdpMulticastSource::BATCH), 0u);
+}
+
+TEST(MulticastFeedTest, FactoryParsesLineParameters) {
+    EXPECT_NE(DataFeedFactory::create_feed(DataFeedFactory::FeedType::MULTICAST,
+                                           "a=239.1.1.1:30001;b=239.1.1.2:30001;rcvbuf=1048576"),
+              nullptr);
+    EXPECT_EQ(DataFeedFactory::create_feed(DataFeedFactory::FeedType::MULTICAST, "b=239.1.1.2:30001"), nullptr);
+
+    auto feed = DataFeedFactory::create_feed(DataFeedFactory::FeedType::MULTICAST, "a=not-an-address:1");
+    ASSERT_NE(feed, nullptr);
+    EXPECT_FALSE(feed->connect());
+    EXPECT_FALSE(feed->is_connected());
+
+    const std::vector<std::string> feeds = DataFeedFactory::get_available_feeds();
+    EXPECT_NE(std::find(feeds.begin(), feeds.end(), "MULTICAST"), feeds.end());
+}
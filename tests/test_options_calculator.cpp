@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "../include/straddle_strategy.h"
+#include <random>
+#include <vector>
+
+using namespace hft::strategy;
+
+class OptionsCalculatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937_64 rng(42);
+        std::uniform_real_distribution<double> moneyness(0.6, 1.4);
+        std::uniform_real_distribution<double> expiry(1.0 / 365.0, 2.0);
+        std::uniform_real_distribution<double> vol(0.05, 1.5);
+        std::uniform_real_distribution<double> rate(-0.01, 0.08);
+
+        // Odd count exercises the scalar tail after the vector blocks
+        const size_t n = 203;
+        spot_.assign(n, 150.0);
+        for (size_t i = 0; i < n; ++i) {
+            strike_.push_back(150.0 * moneyness(rng));
+            expiry_.push_back(expiry(rng));
+            vol_.push_back(vol(rng));
+            rate_.push_back(rate(rng));
+            is_call_.push_back(static_cast<uint8_t>(i % 2));
+        }
+        // Degenerate contracts must fall back to intrinsic value
+        expiry_[5] = 0.0;
+        vol_[10] = 0.0;
+    }
+
+    ChainPricingInput input() const {
+        return {spot_.data(), strike_.data(), expiry_.data(), rate_.data(),
+                vol_.data(), is_call_.data(), spot_.size()};
+    }
+
+    struct Columns {
+        std::vector<double> price, delta, gamma, theta, vega, rho;
+        explicit Columns(size_t n) : price(n), delta(n), gamma(n), theta(n), vega(n), rho(n) {}
+        ChainPricingOutput view() {
+            return {price.data(), delta.data(), gamma.data(), theta.data(), vega.data(), rho.data()};
+        }
+    };
+
+    std::vector<double> spot_, strike_, expiry_, vol_, rate_;
+    std::vector<uint8_t> is_call_;
+};
+
+TEST_F(OptionsCalculatorTest, PutCallParity) {
+    double S = 150.0, K = 155.0, T = 0.25, r = 0.03, sigma = 0.3;
+    double call = OptionsCalculator::black_scholes_call(S, K, T, r, sigma);
+    double put = OptionsCalculator::black_scholes_put(S, K, T, r, sigma);
+    EXPECT_NEAR(call - put, S - K * std::exp(-r * T), 1e-10);
+}
+
+TEST_F(OptionsCalculatorTest, ImpliedVolatilityRoundTrip) {
+    double price = OptionsCalculator::black_scholes_call(150.0, 150.0, 0.25, 0.02, 0.35);
+    double iv = OptionsCalculator::calculate_implied_volatility(price, 150.0, 150.0, 0.25, 0.02, true);
+    EXPECT_NEAR(iv, 0.35, 1e-6);
+}
+
+TEST_F(OptionsCalculatorTest, BatchScalarMatchesSingleContract) {
+    Columns out(spot_.size());
+    OptionsCalculator::price_chain(input(), out.view(), SimdLevel::SCALAR);
+
+    for (size_t i = 0; i < spot_.size(); ++i) {
+        const bool call = is_call_[i] != 0;
+        const double S = spot_[i], K = strike_[i], T = expiry_[i], r = rate_[i], v = vol_[i];
+        const double price = call ? OptionsCalculator::black_scholes_call(S, K, T, r, v)
+                                  : OptionsCalculator::black_scholes_put(S, K, T, r, v);
+        EXPECT_NEAR(out.price[i], price, 1e-9) << i;
+        EXPECT_NEAR(out.delta[i], OptionsCalculator::calculate_delta(S, K, T, r, v, call), 1e-12) << i;
+        EXPECT_NEAR(out.gamma[i], OptionsCalculator::calculate_gamma(S, K, T, r, v), 1e-12) << i;
+        EXPECT_NEAR(out.theta[i], OptionsCalculator::calculate_theta(S, K, T, r, v, call), 1e-9) << i;
+        EXPECT_NEAR(out.vega[i], OptionsCalculator::calculate_vega(S, K, T, r, v), 1e-9) << i;
+        EXPECT_NEAR(out.rho[i], OptionsCalculator::calculate_rho(S, K, T, r, v, call), 1e-9) << i;
+    }
+}
+
+TEST_F(OptionsCalculatorTest, SimdKernelsMatchScalar) {
+    Columns reference(spot_.size());
+    OptionsCalculator::price_chain(input(), reference.view(), SimdLevel::SCALAR);
+
+    for (SimdLevel level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level > OptionsCalculator::detect_simd_level()) continue;
+
+        Columns out(spot_.size());
+        OptionsCalculator::price_chain(input(), out.view(), level);
+        for (size_t i = 0; i < spot_.size(); ++i) {
+            EXPECT_NEAR(out.price[i], reference.price[i], 1e-9) << i;
+            EXPECT_NEAR(out.delta[i], reference.delta[i], 1e-11) << i;
+            EXPECT_NEAR(out.gamma[i], reference.gamma[i], 1e-11) << i;
+            EXPECT_NEAR(out.theta[i], reference.theta[i], 1e-8) << i;
+            EXPECT_NEAR(out.vega[i], reference.vega[i], 1e-8) << i;
+            EXPECT_NEAR(out.rho[i], reference.rho[i], 1e-8) << i;
+        }
+    }
+}
+
+TEST_F(OptionsCalculatorTest, DegenerateContractsPricedAtIntrinsic) {
+    Columns out(spot_.size());
+    OptionsCalculator::price_chain(input(), out.view());
+
+    const double intrinsic = is_call_[5] ? std::max(spot_[5] - strike_[5], 0.0)
+                                         : std::max(strike_[5] - spot_[5], 0.0);
+    EXPECT_NEAR(out.price[5], intrinsic, 1e-12);
+    EXPECT_EQ(out.gamma[5], 0.0);
+    EXPECT_EQ(out.vega[10], 0.0);
+}
+
+TEST_F(OptionsCalculatorTest, NanInputsDegenerateOnEveryPath) {
+    vol_[20] = std::nan("");
+    expiry_[33] = std::nan("");
+    Columns reference(spot_.size());
+    OptionsCalculator::price_chain(input(), reference.view(), SimdLevel::SCALAR);
+    EXPECT_EQ(reference.vega[20], 0.0);
+    EXPECT_EQ(reference.gamma[33], 0.0);
+    const auto same = [](double a, double b) { return a == b || (std::isnan(a) && std::isnan(b)); };
+
+    for (SimdLevel level : {SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level > OptionsCalculator::detect_simd_level()) continue;
+
+        Columns out(spot_.size());
+        OptionsCalculator::price_chain(input(), out.view(), level);
+        for (size_t i : {size_t(20), size_t(33)}) {
+            EXPECT_TRUE(same(out.price[i], reference.price[i])) << i;
+            EXPECT_TRUE(same(out.delta[i], reference.delta[i])) << i;
+            EXPECT_EQ(out.gamma[i], 0.0) << i;
+            EXPECT_EQ(out.vega[i], 0.0) << i;
+        }
+    }
+}
+
+TEST_F(OptionsCalculatorTest, ChainImpliedVolatilityRecoversInputs) {
+    Columns priced(spot_.size());
+    OptionsCalculator::price_chain(input(), priced.view(), SimdLevel::SCALAR);
+
+    ChainImpliedVolInput iv_input{priced.price.data(), spot_.data(), strike_.data(), expiry_.data(),
+                                  rate_.data(), is_call_.data(), nullptr, spot_.size()};
+    ImpliedVolSolverConfig config;
+    config.max_iterations = 32;
+    std::vector<double> iv(spot_.size());
+    OptionsCalculator::solve_implied_volatility_chain(iv_input, iv.data(), config);
+
+    for (size_t i = 0; i < spot_.size(); ++i) {
+        if (expiry_[i] <= 0.0 || vol_[i] <= 0.0) {
+            EXPECT_EQ(iv[i], 0.0) << i;
+            continue;
+        }
+        // Vega-weighted check: deep OTM contracts carry little IV information
+        EXPECT_NEAR((iv[i] - vol_[i]) * priced.vega[i], 0.0, 1e-6) << i;
+    }
+}
+
+TEST_F(OptionsCalculatorTest, ChainImpliedVolatilityWarmStartConvergesFast) {
+    Columns priced(spot_.size());
+    OptionsCalculator::price_chain(input(), priced.view(), SimdLevel::SCALAR);
+
+    // Previous IVs a couple of points off, as after a modest underlying move
+    std::vector<double> warm(vol_);
+    for (double& v : warm) v *= 1.02;
+
+    ChainImpliedVolInput iv_input{priced.price.data(), spot_.data(), strike_.data(), expiry_.data(),
+                                  rate_.data(), is_call_.data(), warm.data(), spot_.size()};
+    ImpliedVolSolverConfig config;
+    config.max_iterations = 4;
+    config.price_tolerance = 1e-6;
+    std::vector<double> iv(spot_.size());
+    size_t converged = OptionsCalculator::solve_implied_volatility_chain(iv_input, iv.data(), config);
+
+    // Everything except the degenerate contracts and the far wings within 4 steps
+    EXPECT_GT(converged, spot_.size() * 9 / 10);
+}
+
+TEST_F(OptionsCalculatorTest, ChainImpliedVolatilityRejectsArbitrageablePrices) {
+    double market[2] = {0.5, 200.0};    // Below intrinsic, above spot
+    double S[2] = {150.0, 150.0}, K[2] = {140.0, 150.0}, T[2] = {0.25, 0.25}, r[2] = {0.0, 0.0};
+    uint8_t call[2] = {1, 1};
+    double iv[2] = {-1.0, -1.0};
+
+    ChainImpliedVolInput iv_input{market, S, K, T, r, call, nullptr, 2};
+    EXPECT_EQ(OptionsCalculator::solve_implied_volatility_chain(iv_input, iv), 0u);
+    EXPECT_EQ(iv[0], 0.0);
+    EXPECT_EQ(iv[1], 0.0);
+}
+
+TEST_F(OptionsCalculatorTest, UpdateChainImpliedVolatilityFromQuotes) {
+    std::vector<hft::data::OptionTick> chain(2);
+    for (size_t i = 0; i < chain.size(); ++i) {
+        auto& tick = chain[i];
+        tick.strike = hft::data::Price(150.0);
+        tick.days_to_expiry = 30;
+        tick.option_type = static_cast<uint8_t>(i);
+        tick.implied_volatility = 0.20;  // Stale IV from the previous quote
+        double fair = i == 0 ? OptionsCalculator::black_scholes_call(150.0, 150.0, 30.0 / 365.0, 0.02, 0.30)
+                             : OptionsCalculator::black_scholes_put(150.0, 150.0, 30.0 / 365.0, 0.02, 0.30);
+        tick.bid = hft::data::Price(fair - 0.05);
+        tick.ask = hft::data::Price(fair + 0.05);
+    }
+
+    size_t converged = OptionsCalculator::update_chain_implied_volatility(chain, hft::data::Price(150.0), 0.02);
+    EXPECT_EQ(converged, 2u);
+    EXPECT_NEAR(chain[0].implied_volatility, 0.30, 1e-3);
+    EXPECT_NEAR(chain[1].implied_volatility, 0.30, 1e-3);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "../include/options_chain.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace hft::data;
+
+namespace {
+
+OptionTick quote(int strike, uint8_t type, int64_t bid, uint32_t expiry = 20220201, uint16_t days = 30) {
+    OptionTick tick{};
+    tick.underlying_id = 5;
+    tick.strike = Price::from_units(strike);
+    tick.option_type = type;
+    tick.bid.value = bid;
+    tick.ask.value = bid + 100;
+    tick.expiration_date = expiry;
+    tick.days_to_expiry = days;
+    return tick;
+}
+
+} // namespace
+
+TEST(OptionsChainTest, BranchlessLowerBoundMatchesStd) {
+    std::mt19937_64 rng(7);
+    for (size_t n = 0; n < 70; ++n) {
+        std::vector<int64_t> strikes(n);
+        for (auto& s : strikes) s = static_cast<int64_t>(rng() % 200) * 5000;
+        std::sort(strikes.begin(), strikes.end());
+        for (int64_t key = -5000; key <= 1005000; key += 2500) {
+            const size_t expected = std::lower_bound(strikes.begin(), strikes.end(), key) - strikes.begin();
+            ASSERT_EQ(OptionsChain::lower_bound(strikes.data(), n, key), expected) << n << ' ' << key;
+        }
+    }
+}
+
+TEST(OptionsChainTest, UpdatesInPlace) {
+    OptionsChain chain(5);
+    EXPECT_FALSE(chain.update([] { OptionTick t = quote(100, 0, 500); t.underlying_id = 6; return t; }()));
+
+    for (int strike : {105, 95, 100}) {
+        ASSERT_TRUE(chain.update(quote(strike, OptionsChain::CALL, 500)));
+        ASSERT_TRUE(chain.update(quote(strike, OptionsChain::PUT, 400)));
+    }
+    ASSERT_EQ(chain.expiry_count(), 1u);
+    ASSERT_EQ(chain.strike_count(0), 3u);
+    EXPECT_EQ(chain.strike(0, 0).value, Price::from_units(95).value);
+    EXPECT_EQ(chain.contract_count(), 6u);
+
+    ASSERT_TRUE(chain.update(quote(100, OptionsChain::CALL, 777, 20220201, 29)));
+    EXPECT_EQ(chain.contract_count(), 6u);
+    const OptionTick* call = chain.find(20220201, Price::from_units(100), OptionsChain::CALL);
+    ASSERT_NE(call, nullptr);
+    EXPECT_EQ(call->bid.value, 777);
+    EXPECT_EQ(chain.days_to_expiry(0), 29);
+    EXPECT_EQ(chain.find(20220201, Price::from_units(101), OptionsChain::CALL), nullptr);
+    EXPECT_EQ(chain.find(20220301, Price::from_units(100), OptionsChain::CALL), nullptr);
+}
+
+TEST(OptionsChainTest, NearestAndOtmStrikes) {
+    OptionsChain chain(5);
+    chain.update(quote(90, OptionsChain::PUT, 100));
+    chain.update(quote(96, OptionsChain::CALL, 100));    // Call only
+    chain.update(quote(100, OptionsChain::CALL, 100));
+    chain.update(quote(104, OptionsChain::PUT, 100));    // Put only
+    chain.update(quote(110, OptionsChain::CALL, 100));
+
+    EXPECT_EQ(chain.nearest_strike(0, Price::from_units(50)), 0u);
+    EXPECT_EQ(chain.nearest_strike(0, Price::from_units(200)), 4u);
+    EXPECT_EQ(chain.atm_strike(0, Price::from_double(101.9, Rounding::NEAREST)), 2u);
+    EXPECT_EQ(chain.atm_strike(0, Price::from_units(102)), 2u);   // Tie to the lower strike
+    EXPECT_EQ(chain.atm_strike(0, Price::from_double(102.1, Rounding::NEAREST)), 3u);
+
+    const OptionTick* call = chain.call_at_or_above(0, Price::from_units(101));
+    ASSERT_NE(call, nullptr);
+    EXPECT_EQ(call->strike.value, Price::from_units(110).value);
+    const OptionTick* put = chain.put_at_or_below(0, Price::from_units(99));
+    ASSERT_NE(put, nullptr);
+    EXPECT_EQ(put->strike.value, Price::from_units(90).value);
+    EXPECT_EQ(chain.put_at_or_below(0, Price::from_units(104))->strike.value, Price::from_units(104).value);
+    EXPECT_EQ(chain.call_at_or_above(0, Price::from_units(111)), nullptr);
+}
+
+TEST(OptionsChainTest, ExpiriesOrderedAndBounded) {
+    OptionsChain chain(5);
+    chain.update(quote(100, 0, 100, 20220301, 58));
+    chain.update(quote(100, 0, 100, 20220201, 30));
+    chain.update(quote(100, 0, 100, 20220401, 86));
+    EXPECT_EQ(chain.expiration_date(0), 20220201u);
+    EXPECT_EQ(chain.nearest_expiry(31, 90), chain.find_expiry(20220301));
+    EXPECT_EQ(chain.nearest_expiry(100, 200), OptionsChain::NONE);
+
+    for (uint32_t i = 0; chain.expiry_count() < OptionsChain::MAX_EXPIRIES; ++i) {
+        ASSERT_TRUE(chain.update(quote(100, 0, 100, 20230101 + i, static_cast<uint16_t>(400 + i))));
+    }
+    EXPECT_FALSE(chain.update(quote(100, 0, 100, 20220101, 1)));
+    EXPECT_TRUE(chain.update(quote(100, 0, 100, 20240101, 700)));
+    EXPECT_EQ(chain.find_expiry(20220201), OptionsChain::NONE);
+    EXPECT_EQ(chain.contract_count(), OptionsChain::MAX_EXPIRIES);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "../include/order_router.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace hft::data;
+using namespace hft::execution;
+
+namespace {
+
+struct Capture {
+    std::mutex mutex;
+    std::vector<std::vector<uint8_t>> writes;
+
+    OrderRouter::WireWriter writer() {
+        return [this](const uint8_t* data, size_t length) {
+            std::lock_guard<std::mutex> lock(mutex);
+            writes.emplace_back(data, data + length);
+            return true;
+        };
+    }
+};
+
+wire::EnterOrder decode(const std::vector<uint8_t>& bytes, size_t message = 0) {
+    wire::EnterOrder order{};
+    EXPECT_TRUE(wire::decode_enter_order(bytes.data() + message * wire::ENTER_ORDER_SIZE,
+                                         bytes.size() - message * wire::ENTER_ORDER_SIZE, order));
+    return order;
+}
+
+} // namespace
+
+TEST(OrderRouterTest, EncodesSingleOrderFromTemplate) {
+    Capture capture;
+    OrderRouter::Config config;
+    config.firm_id = 0xABCD1234;
+    config.time_in_force = wire::TIF_IOC;
+    OrderRouter router(capture.writer(), config);
+
+    Order* order = router.allocate();
+    ASSERT_NE(order, nullptr);
+    order->side = Side::SELL;
+    order->instrument_id = 77;
+    order->quantity = 5;
+    order->price = Price::from_basis_points(-12345);   // Negative survives the round trip
+    ASSERT_TRUE(router.submit(order));
+    EXPECT_EQ(router.poll(), 1u);
+
+    ASSERT_EQ(capture.writes.size(), 1u);
+    ASSERT_EQ(capture.writes[0].size(), wire::ENTER_ORDER_SIZE);
+    EXPECT_EQ(capture.writes[0][wire::TYPE_OFFSET], wire::ENTER_ORDER_TYPE);
+    const wire::EnterOrder decoded = decode(capture.writes[0]);
+    EXPECT_EQ(decoded.side, Side::SELL);
+    EXPECT_EQ(decoded.time_in_force, wire::TIF_IOC);
+    EXPECT_EQ(decoded.capacity, wire::CAPACITY_PRINCIPAL);
+    EXPECT_EQ(decoded.instrument_id, 77u);
+    EXPECT_EQ(decoded.order_id, 1u);
+    EXPECT_EQ(decoded.pair_id, 0u);
+    EXPECT_EQ(decoded.quantity, 5u);
+    EXPECT_EQ(decoded.firm_id, 0xABCD1234u);
+    EXPECT_EQ(decoded.price.value, -12345);
+    EXPECT_GT(decoded.send_time.nanoseconds_since_epoch, 0u);
+
+    // Big-endian on the wire
+    EXPECT_EQ(capture.writes[0][wire::INSTRUMENT_OFFSET + 3], 77);
+    EXPECT_EQ(router.orders_sent(), 1u);
+}
+
+TEST(OrderRouterTest, StraddleLegsShareOneWrite) {
+    Capture capture;
+    OrderRouter router(capture.writer());
+    const uint64_t pair = router.submit_straddle(Side::BUY, 10, Price::from_basis_points(20000),
+                                                 11, Price::from_basis_points(19000), 3);
+    ASSERT_NE(pair, 0u);
+    router.poll();
+
+    ASSERT_EQ(capture.writes.size(), 1u);
+    ASSERT_EQ(capture.writes[0].size(), 2 * wire::ENTER_ORDER_SIZE);
+    const wire::EnterOrder call = decode(capture.writes[0], 0);
+    const wire::EnterOrder put = decode(capture.writes[0], 1);
+    EXPECT_EQ(call.instrument_id, 10u);
+    EXPECT_EQ(put.instrument_id, 11u);
+    EXPECT_EQ(call.price.value, 20000);
+    EXPECT_EQ(put.price.value, 19000);
+    EXPECT_EQ(call.pair_id, pair);
+    EXPECT_EQ(put.pair_id, pair);
+    EXPECT_NE(call.order_id, put.order_id);
+    EXPECT_EQ(call.send_time.nanoseconds_since_epoch, put.send_time.nanoseconds_since_epoch);
+}
+
+TEST(OrderRouterTest, PoolRecyclesSentOrders) {
+    Capture capture;
+    OrderRouter router(capture.writer());
+    const size_t pairs = OrderRouter::MAX_ORDERS / 2;
+    for (size_t i = 0; i < pairs; ++i) {
+        ASSERT_NE(router.submit_straddle(Side::BUY, 1, Price(1.0), 2, Price(1.0), 1), 0u);
+    }
+    EXPECT_EQ(router.orders_available(), 0u);
+    EXPECT_EQ(router.submit_straddle(Side::BUY, 1, Price(1.0), 2, Price(1.0), 1), 0u);   // All in flight
+
+    while (router.poll() != 0) {
+    }
+    EXPECT_EQ(router.orders_sent(), 2 * pairs);
+    EXPECT_NE(router.submit_straddle(Side::BUY, 1, Price(1.0), 2, Price(1.0), 1), 0u);   // Reclaimed
+
+    Order* order = router.allocate();
+    ASSERT_NE(order, nullptr);
+    const size_t available = router.orders_available();
+    router.release(order);
+    EXPECT_EQ(router.orders_available(), available + 1);
+}
+
+TEST(OrderRouterTest, CountsWriteFailuresAndStillRecycles) {
+    OrderRouter router([](const uint8_t*, size_t) { return false; });
+    ASSERT_NE(router.submit_straddle(Side::SELL, 1, Price(1.0), 2, Price(1.0), 1), 0u);
+    router.poll();
+    EXPECT_EQ(router.orders_sent(), 0u);
+    EXPECT_EQ(router.write_failures(), 1u);
+
+    size_t allocated = 0;
+    while (Order* order = router.allocate()) {
+        order->quantity = 1;
+        ++allocated;
+    }
+    EXPECT_EQ(allocated, OrderRouter::MAX_ORDERS);
+}
+
+TEST(OrderRouterTest, ReportsEachSubmissionOnce) {
+    bool accept = true;
+    std::atomic<bool> halt{false};
+    OrderRouter router([&accept](const uint8_t*, size_t) { return accept; });
+    router.set_kill_switch(&halt);
+
+    const uint64_t sent = router.submit_straddle(Side::BUY, 1, Price(1.0), 2, Price(1.0), 1);
+    router.poll();
+    accept = false;
+    const uint64_t failed = router.submit_straddle(Side::SELL, 1, Price(1.0), 2, Price(1.0), 1);
+    router.poll();
+    Order* single = router.allocate();
+    ASSERT_NE(single, nullptr);
+    single->quantity = 1;
+    ASSERT_TRUE(router.submit(single));
+    halt = true;   // Queued before the halt, dropped at the wire
+    router.poll();
+
+    SendReport reports[8];
+    ASSERT_EQ(router.take_reports(reports, 8), 3u);
+    EXPECT_EQ(reports[0].submission_id, sent);
+    EXPECT_EQ(reports[0].result, SendResult::SENT);
+    EXPECT_EQ(reports[1].submission_id, failed);
+    EXPECT_EQ(reports[1].result, SendResult::WRITE_FAILED);
+    EXPECT_EQ(reports[2].submission_id, single->order_id);
+    EXPECT_EQ(reports[2].result, SendResult::BLOCKED);
+    EXPECT_EQ(router.take_reports(reports, 8), 0u);
+    EXPECT_EQ(router.reports_dropped(), 0u);
+}
+
+TEST(OrderRouterTest, SendThreadDeliversEverySubmission) {
+    Capture capture;
+    OrderRouter::Config config;
+    config.send_cpu = 0;
+    OrderRouter router(capture.writer(), config);
+    ASSERT_TRUE(router.start());
+    EXPECT_FALSE(router.start());
+    EXPECT_EQ(router.poll(), 0u);   // The send thread owns the queue
+
+    constexpr size_t PAIRS = 20000;
+    for (size_t i = 0; i < PAIRS; ++i) {
+        while (router.submit_straddle(Side::BUY, static_cast<uint32_t>(i), Price(1.0),
+                                      static_cast<uint32_t>(i + 1), Price(1.0), 1) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    router.stop();
+    EXPECT_FALSE(router.is_running());
+
+    ASSERT_EQ(capture.writes.size(), PAIRS);
+    EXPECT_EQ(router.orders_sent(), 2 * PAIRS);
+    std::set<uint64_t> ids;
+    for (size_t i = 0; i < PAIRS; ++i) {
+        const wire::EnterOrder call = decode(capture.writes[i], 0);
+        const wire::EnterOrder put = decode(capture.writes[i], 1);
+        EXPECT_EQ(call.instrument_id, i);   // Submission order is preserved
+        EXPECT_EQ(put.pair_id, call.order_id);
+        ids.insert(call.order_id);
+        ids.insert(put.order_id);
+    }
+    EXPECT_EQ(ids.size(), 2 * PAIRS);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "../include/parameter_sweep.h"
+#include <algorithm>
+#include <sstream>
+
+using namespace hft::data;
+using namespace hft::analytics;
+using hft::strategy::StraddleStrategy;
+
+namespace {
+
+constexpr uint64_t TEN_MINUTES = 600ull * 1000000000ull;
+constexpr uint64_t START = 1640995200000000000ull;  // 2022-01-01
+
+// Two underlyings that turn calm, with a chain each and a later call rally
+SweepData make_data() {
+    SweepData data;
+    std::vector<OptionTick> options;
+    for (uint32_t symbol = 0; symbol < 2; ++symbol) {
+        std::vector<MarketTick> ticks;
+        for (int i = 0; i < 300; ++i) {
+            const int64_t mid = i < 100 ? (i % 2 ? 1010000 : 990000) : (i % 2 ? 1000100 : 1000000);
+            MarketTick tick{};
+            tick.timestamp = Timestamp(START + i * TEN_MINUTES + symbol);
+            tick.symbol_id = symbol;
+            tick.bid.value = mid - 100;
+            tick.ask.value = mid + 100;
+            ticks.push_back(tick);
+        }
+        data.add_market_data(std::move(ticks));
+
+        for (int strike = 95; strike <= 105; ++strike) {
+            for (uint8_t type = 0; type < 2; ++type) {
+                OptionTick option{};
+                option.timestamp = Timestamp(START);
+                option.underlying_id = symbol;
+                option.strike.value = strike * 10000;
+                option.bid.value = 19000 - std::abs(strike - 100) * 1000;
+                option.ask.value = option.bid.value + 1000;
+                option.expiration_date = 20220201;
+                option.days_to_expiry = 30;
+                option.option_type = type;
+                option.implied_volatility = 0.30;
+                options.push_back(option);
+            }
+        }
+        for (int step = 0; step < 5; ++step) {
+            OptionTick rally = options.back();
+            rally.timestamp = Timestamp(START + (150 + step * 30) * TEN_MINUTES);
+            rally.option_type = 0;
+            rally.strike.value = (102 + step % 3) * 10000;
+            rally.bid.value = 30000 + step * 5000;
+            rally.ask.value = rally.bid.value + 1000;
+            options.push_back(rally);
+        }
+    }
+    data.add_options_data(std::move(options));
+    return data;
+}
+
+} // namespace
+
+TEST(ParameterSweepTest, GridExpandsCartesianProduct) {
+    SweepGrid grid;
+    grid.otm_offset_pct = {0.01, 0.02, 0.03};
+    grid.profit_target_pct = {0.10, 0.20};
+    grid.implied_vol_band = {{0.1, 0.5}, {0.2, 0.9}};
+
+    const auto configs = grid.expand();
+    ASSERT_EQ(grid.size(), 12u);
+    ASSERT_EQ(configs.size(), 12u);
+    EXPECT_DOUBLE_EQ(configs[0].otm_offset_pct, 0.01);
+    EXPECT_DOUBLE_EQ(configs[1].min_implied_vol, 0.2);
+    EXPECT_DOUBLE_EQ(configs[2].profit_target_pct, 0.20);
+    EXPECT_DOUBLE_EQ(configs[11].otm_offset_pct, 0.03);
+    EXPECT_DOUBLE_EQ(configs[11].stop_loss_pct, grid.base.stop_loss_pct);  // Empty axis keeps base
+}
+
+TEST(ParameterSweepTest, ParallelMatchesDirectRuns) {
+    const SweepData data = make_data();
+    SweepGrid grid;
+    grid.otm_offset_pct = {0.01, 0.02, 0.04};
+    grid.profit_target_pct = {0.05, 0.15, 0.50};
+    grid.stop_loss_pct = {0.10, 0.25};
+    const auto configs = grid.expand();
+
+    ParameterSweep::Config config;
+    config.num_threads = 4;
+    ParameterSweep sweep(data, config);
+    const auto results = sweep.run(configs);
+    ASSERT_EQ(results.size(), configs.size());
+
+    BacktestEngine engine;
+    ASSERT_TRUE(data.load(engine));
+    bool any_trades = false;
+    for (size_t i = 0; i < configs.size(); ++i) {
+        StraddleStrategy strategy(configs[i]);
+        engine.run(strategy);
+        EXPECT_DOUBLE_EQ(results[i].config.otm_offset_pct, configs[i].otm_offset_pct) << i;
+        EXPECT_EQ(results[i].trades, strategy.get_total_trades_count()) << i;
+        EXPECT_DOUBLE_EQ(results[i].total_pnl, strategy.get_total_pnl()) << i;
+        EXPECT_DOUBLE_EQ(results[i].win_rate, strategy.get_win_rate()) << i;
+        EXPECT_DOUBLE_EQ(results[i].max_drawdown, strategy.get_max_drawdown()) << i;
+        EXPECT_EQ(results[i].stats.market_ticks, data.market_ticks()) << i;
+        any_trades |= results[i].trades > 0;
+    }
+    EXPECT_TRUE(any_trades);
+
+    std::ostringstream csv;
+    ParameterSweep::write_csv(csv, results);
+    const std::string table = csv.str();
+    EXPECT_EQ(std::count(table.begin(), table.end(), '\n'), static_cast<long>(configs.size() + 1));
+}
+
+TEST(ParameterSweepTest, MoreThreadsThanJobs) {
+    const SweepData data = make_data();
+    ParameterSweep::Config config;
+    config.num_threads = 8;
+    ParameterSweep sweep(data, config);
+
+    SweepGrid grid;
+    grid.max_hold_days = {5, 10};
+    const auto results = sweep.run(grid);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].config.max_hold_days, 5);
+    EXPECT_EQ(results[1].config.max_hold_days, 10);
+    EXPECT_TRUE(sweep.run(std::vector<StraddleStrategy::Config>{}).empty());
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "../include/pnl_counter.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+
+TEST(PnlCounterTest, FixedPointConversion) {
+    EXPECT_EQ(PnlCounter::to_fixed(12.3457), 123457);
+    EXPECT_EQ(PnlCounter::to_fixed(-1.2345), -12345);
+    EXPECT_DOUBLE_EQ(PnlCounter::to_double(-123450), -12.345);
+
+    PnlCounter counter;
+    counter.add(0.1);
+    counter.add(0.2);
+    EXPECT_EQ(counter.value(), 3000);  // Exact, unlike 0.1 + 0.2 in double
+    counter.reset();
+    EXPECT_EQ(counter.value(), 0);
+}
+
+TEST(PnlCounterTest, ConcurrentAddsAreExact) {
+    constexpr int THREADS = 8;
+    constexpr int ADDS = 100000;
+    PnlCounter counter;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&counter, t] {
+            for (int i = 0; i < ADDS; ++i) {
+                counter.add(static_cast<int64_t>(i % 7 == 0 ? -t : t + 1));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    int64_t expected = 0;
+    for (int t = 0; t < THREADS; ++t) {
+        for (int i = 0; i < ADDS; ++i) {
+            expected += i % 7 == 0 ? -t : t + 1;
+        }
+    }
+    EXPECT_EQ(counter.value(), expected);
+}
+
+TEST(PnlCounterTest, ReadsAreSnapshotsAcrossShards) {
+    // Two threads pass one unit back and forth: on even rounds A adds and
+    // then B takes it away, on odd rounds the other way round. The true
+    // total is always 0 or 1; a read summing one shard before a hand-off
+    // and the other after it would see -1 or 2.
+    constexpr int ROUNDS = 5000;
+    PnlCounter counter;
+    std::atomic<int> turn{0};        // Next move; two moves per round
+    std::atomic<bool> done{false};
+
+    auto player = [&](int self) {   // 0 = A, 1 = B
+        for (int move = 0; move < 2 * ROUNDS; ++move) {
+            const bool gives = move % 2 == 0;
+            const int mover = (move / 2) % 2 == (gives ? 0 : 1) ? 0 : 1;
+            if (mover != self) {
+                continue;
+            }
+            while (turn.load(std::memory_order_acquire) != move) {
+                std::this_thread::yield();
+            }
+            counter.add(static_cast<int64_t>(gives ? 1 : -1));
+            turn.store(move + 1, std::memory_order_release);
+        }
+    };
+
+    int64_t low = 0, high = 0;
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const int64_t total = counter.value();
+            low = std::min(low, total);
+            high = std::max(high, total);
+            std::this_thread::yield();
+        }
+    });
+    std::thread a(player, 0);
+    std::thread b(player, 1);
+    a.join();
+    b.join();
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_GE(low, 0);
+    EXPECT_LE(high, 1);
+    EXPECT_EQ(counter.value(), 0);
+}
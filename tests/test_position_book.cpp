@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "../include/position_book.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+using namespace hft::strategy;
+
+namespace {
+
+StraddlePosition make_position(uint32_t id, uint32_t symbol_id) {
+    StraddlePosition position{};
+    position.position_id = id;
+    position.symbol_id = symbol_id;
+    position.call_strike.value = 1020000;
+    position.put_strike.value = 980000;
+    position.current_call_price.value = 20000;
+    position.current_put_price.value = 20000;
+    position.total_premium_paid.value = 40000;
+    return position;
+}
+
+} // namespace
+
+TEST(PositionBookTest, OpenUntilFull) {
+    PositionBook book(3, 8);
+    EXPECT_EQ(book.size(), 0u);
+    for (uint32_t i = 0; i < 3; ++i) {
+        StraddlePosition* position = book.open(make_position(i, i));
+        ASSERT_NE(position, nullptr);
+        EXPECT_EQ(position->status, PositionStatus::ACTIVE);
+    }
+    EXPECT_TRUE(book.full());
+    EXPECT_EQ(book.open(make_position(3, 3)), nullptr);
+    EXPECT_TRUE(book.has_position(1));
+    EXPECT_FALSE(book.has_position(3));
+}
+
+TEST(PositionBookTest, CloseFreesSlotAndJournals) {
+    PositionBook book(2, 8);
+    StraddlePosition* first = book.open(make_position(7, 1));
+    ASSERT_NE(book.open(make_position(8, 2)), nullptr);
+
+    book.modify(*first, [](StraddlePosition& p) { p.realized_pnl.value = 1234; });
+    book.close(*first);
+    EXPECT_EQ(book.size(), 1u);
+    EXPECT_FALSE(book.has_position(1));
+    ASSERT_EQ(book.closed_count(), 1u);
+
+    StraddlePosition closed{};
+    ASSERT_EQ(book.read_closed(0, &closed, 1), 1u);
+    EXPECT_EQ(closed.position_id, 7u);
+    EXPECT_EQ(closed.status, PositionStatus::CLOSED);
+    EXPECT_EQ(closed.realized_pnl.value, 1234);
+
+    // The freed slot is reused
+    StraddlePosition* reopened = book.open(make_position(9, 3));
+    ASSERT_NE(reopened, nullptr);
+    EXPECT_EQ(reopened, first);
+
+    std::vector<uint32_t> seen;
+    book.for_each_active([&](StraddlePosition& p) { seen.push_back(p.position_id); });
+    EXPECT_EQ(seen.size(), 2u);
+}
+
+TEST(PositionBookTest, JournalKeepsMostRecentCloses) {
+    PositionBook book(1, 4);
+    for (uint32_t i = 0; i < 10; ++i) {
+        book.close(*book.open(make_position(i, 0)));
+    }
+    ASSERT_EQ(book.closed_count(), 10u);
+
+    StraddlePosition out[4];
+    EXPECT_EQ(book.read_closed(0, out, 4), 0u);  // Long overwritten
+    ASSERT_EQ(book.read_closed(6, out, 4), 4u);
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(out[i].position_id, 6 + i);
+    }
+    EXPECT_EQ(book.read_closed(8, out, 4), 2u);  // Stops at the last published entry
+}
+
+TEST(PositionBookTest, ConcurrentSnapshotsAreConsistent) {
+    constexpr size_t CAPACITY = 8;
+    PositionBook book(CAPACITY, 64);
+    std::vector<StraddlePosition*> open;
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        open.push_back(book.open(make_position(i, i)));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> snapshots{0};
+    std::thread reader([&] {
+        StraddlePosition out[CAPACITY];
+        while (!done.load(std::memory_order_acquire)) {
+            const size_t n = book.snapshot_active(out, CAPACITY);
+            for (size_t i = 0; i < n; ++i) {
+                // The writer always moves both legs together
+                torn += out[i].current_call_price.value != out[i].current_put_price.value;
+            }
+            snapshots.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (int64_t round = 1; round <= 20000 || snapshots.load(std::memory_order_relaxed) < 100; ++round) {
+        StraddlePosition& position = *open[round % CAPACITY];
+        book.modify(position, [&](StraddlePosition& p) {
+            p.current_call_price.value = round;
+            p.current_put_price.value = round;
+        });
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_GE(snapshots.load(), 100u);
+}
+
+TEST(PositionBookTest, ExposureFollowsIncrementalUpdates) {
+    PositionBook book(16, 16);
+    std::vector<StraddlePosition*> open;
+    for (uint32_t i = 0; i < 12; ++i) {
+        open.push_back(book.open(make_position(i, i % 3)));
+    }
+
+    uint64_t seed = 42;
+    for (int round = 0; round < 5000; ++round) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        StraddlePosition& position = *open[(seed >> 33) % open.size()];
+        const double x = static_cast<double>((seed >> 40) % 1000) / 1000.0;
+        book.modify(position, [&](StraddlePosition& p) {
+            p.current_call_price.value = 10000 + static_cast<int64_t>(x * 20000);
+            p.unrealized_pnl = p.calculate_pnl();
+            p.delta = x - 0.5;
+            p.gamma = x * 0.1;
+            p.theta = -x;
+            p.vega = 2.0 * x;
+        });
+    }
+    book.close(*open[0]);
+    book.close(*open[3]);
+
+    StraddlePosition out[16];
+    const size_t n = book.snapshot_active(out, 16);
+    PortfolioExposure expected;
+    PortfolioExposure expected_symbol0;
+    for (size_t i = 0; i < n; ++i) {
+        expected.add(out[i], 1.0);
+        if (out[i].symbol_id == 0) {
+            expected_symbol0.add(out[i], 1.0);
+        }
+    }
+
+    const PortfolioExposure total = book.portfolio_exposure();
+    EXPECT_EQ(total.positions, 10u);
+    EXPECT_NEAR(total.delta, expected.delta, 1e-9);
+    EXPECT_NEAR(total.vega, expected.vega, 1e-9);
+    EXPECT_NEAR(total.unrealized_pnl, expected.unrealized_pnl, 1e-6);
+    EXPECT_NEAR(total.market_value, expected.market_value, 1e-6);
+
+    const PortfolioExposure symbol0 = book.symbol_exposure(0);
+    EXPECT_EQ(symbol0.positions, 2u);
+    EXPECT_NEAR(symbol0.theta, expected_symbol0.theta, 1e-9);
+
+    // Closing the last position on a symbol resets its totals exactly
+    book.close(*open[6]);
+    book.close(*open[9]);
+    EXPECT_EQ(book.symbol_exposure(0).positions, 0u);
+    EXPECT_EQ(book.symbol_exposure(0).delta, 0.0);
+}
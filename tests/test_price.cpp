@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "../include/market_data.h"
+#include <vector>
+
+using namespace hft::data;
+using namespace hft::data::literals;
+
+namespace {
+
+constexpr Price parsed(const char* text) {
+    Price price;
+    Price::parse(std::string_view(text), price);
+    return price;
+}
+
+static_assert((101.25_px).value == 1012500, "literal is built at compile time");
+static_assert((0.00015_px).value == 2, "fifth decimal rounds half-up");
+static_assert(parsed("-3.5").value == -35000, "constexpr parse");
+static_assert((1.0001_px + 2.0002_px).value == 30003, "integral add");
+static_assert(Price::midpoint(1.0000_px, 1.0001_px).value == 10001, "midpoint rounds half away");
+static_assert(Price::from_units(7).value == 70000, "whole units");
+
+} // namespace
+
+TEST(PriceTest, ParseRejectsMalformedText) {
+    Price price = Price::from_basis_points(42);
+    EXPECT_FALSE(Price::parse(std::string_view(""), price));
+    EXPECT_FALSE(Price::parse(std::string_view("1.2.3"), price));
+    EXPECT_FALSE(Price::parse(std::string_view("-"), price));
+    EXPECT_FALSE(Price::parse(std::string_view("12a"), price));
+    EXPECT_EQ(price.value, 42);
+    EXPECT_TRUE(Price::parse(std::string_view(".5"), price));
+    EXPECT_EQ(price.value, 5000);
+}
+
+TEST(PriceTest, DivideRoundsAsRequested) {
+    struct Case { int64_t num; int64_t den; int64_t zero, nearest, down, up; };
+    const Case cases[] = {
+        {7, 2, 3, 4, 3, 4},
+        {-7, 2, -3, -4, -4, -3},
+        {5, 3, 1, 2, 1, 2},
+        {-5, 3, -1, -2, -2, -1},
+        {4, 3, 1, 1, 1, 2},
+        {7, -2, -3, -4, -4, -3},
+        {6, 3, 2, 2, 2, 2},
+    };
+    for (const Case& c : cases) {
+        EXPECT_EQ(Price::divide(c.num, c.den, Rounding::TOWARD_ZERO), c.zero) << c.num << '/' << c.den;
+        EXPECT_EQ(Price::divide(c.num, c.den, Rounding::NEAREST), c.nearest) << c.num << '/' << c.den;
+        EXPECT_EQ(Price::divide(c.num, c.den, Rounding::DOWN), c.down) << c.num << '/' << c.den;
+        EXPECT_EQ(Price::divide(c.num, c.den, Rounding::UP), c.up) << c.num << '/' << c.den;
+    }
+}
+
+TEST(PriceTest, ScalingStaysIntegral) {
+    const Price premium = 4.0010_px;
+    EXPECT_EQ(premium.scaled(115, 100).value, 46012);                   // 46011.5 -> nearest
+    EXPECT_EQ(premium.scaled(115, 100, Rounding::DOWN).value, 46011);
+    EXPECT_EQ((premium * 3).value, 120030);
+
+    // Large notionals: the product exceeds int64 but the result does not
+    const Price notional = Price::from_units(500000000000);
+    EXPECT_EQ(notional.scaled(3, 4).value, Price::from_units(375000000000).value);
+
+    // Sums of many small prices do not drift
+    Price total;
+    for (int i = 0; i < 100000; ++i) total += 0.0001_px;
+    EXPECT_EQ(total.value, 100000);
+    EXPECT_EQ(Price::from_double(0.0299, Rounding::NEAREST).value, 299);
+}
+
+TEST(PriceTest, BatchMatchesPerTick) {
+    std::vector<MarketTick> ticks(37);
+    std::vector<int64_t> bid(ticks.size());
+    std::vector<int64_t> ask(ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        ticks[i].bid.value = 1000000 + static_cast<int64_t>(i * 37);
+        ticks[i].ask.value = ticks[i].bid.value + 1 + static_cast<int64_t>(i % 5);
+        bid[i] = ticks[i].bid.value;
+        ask[i] = ticks[i].ask.value;
+    }
+
+    std::vector<int64_t> mids(ticks.size());
+    std::vector<int64_t> spreads(ticks.size());
+    std::vector<int64_t> column_mids(ticks.size());
+    std::vector<int64_t> column_spreads(ticks.size());
+    compute_midpoints(ticks.data(), ticks.size(), mids.data());
+    compute_spreads(ticks.data(), ticks.size(), spreads.data());
+    compute_midpoints(bid.data(), ask.data(), ticks.size(), column_mids.data());
+    compute_spreads(bid.data(), ask.data(), ticks.size(), column_spreads.data());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        EXPECT_EQ(mids[i], ticks[i].midpoint().value) << i;
+        EXPECT_EQ(spreads[i], ticks[i].spread_price().value) << i;
+        EXPECT_EQ(column_mids[i], mids[i]) << i;
+        EXPECT_EQ(column_spreads[i], spreads[i]) << i;
+    }
+}
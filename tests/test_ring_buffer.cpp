@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "../include/ring_buffer.h"
+#include "../include/data_ingestion.h"
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+
+class RingBufferTest : public ::testing::Test {
+protected:
+    static constexpr uint64_t ITEMS_PER_PRODUCER = 50000;
+};
+
+TEST_F(RingBufferTest, SPSCIndicesOnSeparateCacheLines) {
+    EXPECT_GE(sizeof(SPSCRingBuffer<uint64_t, 16>), 3 * CACHE_LINE_SIZE);
+    EXPECT_EQ(alignof(SPSCRingBuffer<uint64_t, 16>), CACHE_LINE_SIZE);
+}
+
+TEST_F(RingBufferTest, SPSCFillDrainAndWrap) {
+    SPSCRingBuffer<uint64_t, 8> ring;
+    EXPECT_TRUE(ring.empty());
+
+    for (uint64_t lap = 0; lap < 3; ++lap) {
+        for (uint64_t i = 0; i < 8; ++i) {
+            EXPECT_TRUE(ring.push(lap * 8 + i));
+        }
+        EXPECT_TRUE(ring.full());
+        EXPECT_FALSE(ring.push(999));
+
+        for (uint64_t i = 0; i < 8; ++i) {
+            uint64_t value = 0;
+            EXPECT_TRUE(ring.pop(value));
+            EXPECT_EQ(value, lap * 8 + i);
+        }
+        uint64_t value = 0;
+        EXPECT_FALSE(ring.pop(value));
+    }
+}
+
+TEST_F(RingBufferTest, SPSCBatchPartialAcceptance) {
+    SPSCRingBuffer<uint64_t, 8> ring;
+    std::vector<uint64_t> items(12);
+    std::iota(items.begin(), items.end(), 0);
+
+    EXPECT_EQ(ring.push_n(items.data(), items.size()), 8u);
+    std::vector<uint64_t> out(12, 0);
+    EXPECT_EQ(ring.pop_n(out.data(), 5), 5u);
+    EXPECT_EQ(ring.push_n(items.data() + 8, 4), 4u);
+    EXPECT_EQ(ring.pop_n(out.data() + 5, 12), 7u);
+    for (uint64_t i = 0; i < 12; ++i) {
+        EXPECT_EQ(out[i], i);
+    }
+}
+
+TEST_F(RingBufferTest, SPSCConcurrentPreservesOrder) {
+    auto ring = std::make_unique<SPSCRingBuffer<uint64_t, 1024>>();
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < ITEMS_PER_PRODUCER;) {
+            if (ring->push(i)) ++i;
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t buffer[32];
+    while (expected < ITEMS_PER_PRODUCER) {
+        size_t n = ring->pop_n(buffer, 32);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(buffer[i], expected++);
+        }
+    }
+    producer.join();
+}
+
+TEST_F(RingBufferTest, MPMCFullAndEmpty) {
+    MPMCRingBuffer<uint64_t, 4> ring;
+    uint64_t value = 0;
+    EXPECT_FALSE(ring.pop(value));
+    for (uint64_t i = 0; i < 4; ++i) EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(4));
+
+    uint64_t items[3] = {7, 8, 9};
+    EXPECT_EQ(ring.push_n(items, 3), 0u);
+    uint64_t out[8];
+    EXPECT_EQ(ring.pop_n(out, 8), 4u);
+    EXPECT_EQ(ring.push_n(items, 3), 3u);
+    EXPECT_EQ(ring.pop_n(out, 8), 3u);
+    EXPECT_EQ(out[2], 9u);
+}
+
+TEST_F(RingBufferTest, MPMCConcurrentFanInFanOut) {
+    constexpr int PRODUCERS = 4;
+    constexpr int CONSUMERS = 4;
+    auto ring = std::make_unique<MPMCRingBuffer<uint64_t, 4096>>();
+
+    std::atomic<uint64_t> consumed_count{0};
+    std::atomic<uint64_t> consumed_sum{0};
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&, p] {
+            uint64_t batch[16];
+            uint64_t next = 0;
+            while (next < ITEMS_PER_PRODUCER) {
+                // Alternate single and batch pushes to exercise both paths
+                if (next % 2 == 0) {
+                    size_t n = 0;
+                    while (n < 16 && next + n < ITEMS_PER_PRODUCER) {
+                        batch[n] = p * ITEMS_PER_PRODUCER + next + n;
+                        ++n;
+                    }
+                    next += ring->push_n(batch, n);
+                } else if (ring->push(p * ITEMS_PER_PRODUCER + next)) {
+                    ++next;
+                }
+            }
+        });
+    }
+
+    const uint64_t total = PRODUCERS * ITEMS_PER_PRODUCER;
+    for (int c = 0; c < CONSUMERS; ++c) {
+        threads.emplace_back([&] {
+            uint64_t batch[32];
+            while (consumed_count.load() < total) {
+                size_t n = ring->pop_n(batch, 32);
+                uint64_t sum = 0;
+                for (size_t i = 0; i < n; ++i) sum += batch[i];
+                consumed_sum.fetch_add(sum);
+                consumed_count.fetch_add(n);
+            }
+        });
+    }
+
+    for (auto& t : threads) t.join();
+    EXPECT_EQ(consumed_count.load(), total);
+    EXPECT_EQ(consumed_sum.load(), total * (total - 1) / 2);
+}
+
+TEST_F(RingBufferTest, IngestionEngineMultiFeedFanIn) {
+    auto engine = std::make_unique<DataIngestionEngine>();
+    std::atomic<uint64_t> delivered{0};
+    engine->subscribe_to_events([&](const DataEvent&) { delivered.fetch_add(1); });
+    engine->start();
+
+    constexpr int FEEDS = 3;
+    constexpr uint64_t EVENTS_PER_FEED = 20000;
+    std::vector<std::thread> feeds;
+    for (int f = 0; f < FEEDS; ++f) {
+        feeds.emplace_back([&, f] {
+            MarketTick tick;
+            tick.symbol_id = static_cast<uint32_t>(f + 1);
+            for (uint64_t i = 0; i < EVENTS_PER_FEED; ++i) {
+                engine->publish_event(DataEvent(DataEventType::MARKET_TICK, tick));
+            }
+        });
+    }
+    for (auto& t : feeds) t.join();
+    engine->stop();
+
+    EXPECT_EQ(engine->get_events_dropped(), 0u);
+    EXPECT_EQ(engine->get_events_processed(), FEEDS * EVENTS_PER_FEED);
+    EXPECT_EQ(delivered.load(), FEEDS * EVENTS_PER_FEED);
+}
+
+TEST_F(RingBufferTest, MPMCManyLapsOverZeroFilledStorage) {
+    MPMCRingBuffer<uint64_t, 8> ring;
+    uint64_t out[8];
+    for (uint64_t lap = 0; lap < 100; ++lap) {
+        for (uint64_t i = 0; i < 8; ++i) ASSERT_TRUE(ring.push(lap * 8 + i));
+        ASSERT_FALSE(ring.push(0));
+        ASSERT_EQ(ring.pop_n(out, 8), 8u);
+        ASSERT_EQ(out[0], lap * 8);
+        ASSERT_EQ(out[7], lap * 8 + 7);
+    }
+}
+
+TEST_F(RingBufferTest, DataEventIsTaggedUnion) {
+    EXPECT_EQ(sizeof(MarketTick), 64u);
+    EXPECT_EQ(sizeof(DataEvent), 192u);
+    EXPECT_EQ(alignof(DataEvent), 64u);
+
+    MarketTick tick;
+    tick.symbol_id = 7;
+    tick.last = Price(101.25);
+    const DataEvent market(DataEventType::TRADE, tick, Timestamp(42));
+    DataEvent copy;
+    copy = market;
+    EXPECT_EQ(copy.type, DataEventType::TRADE);
+    EXPECT_EQ(copy.symbol_id, 7u);
+    EXPECT_EQ(copy.timestamp.nanoseconds_since_epoch, 42u);
+    EXPECT_EQ(copy.market_tick.last.value, Price(101.25).value);
+
+    OptionTick option;
+    option.symbol_id = 9;
+    option.strike = Price(150.0);
+    option.implied_volatility = 0.31;
+    const DataEvent option_event(DataEventType::OPTION_TICK, option, Timestamp(43));
+    const DataEvent option_copy(option_event);
+    EXPECT_TRUE(option_copy.is_option());
+    EXPECT_EQ(option_copy.option_tick.strike.value, Price(150.0).value);
+    EXPECT_DOUBLE_EQ(option_copy.option_tick.implied_volatility, 0.31);
+}
+
+TEST_F(RingBufferTest, EventTimestampOnlyOnLivePath) {
+    MarketTick tick;
+    tick.symbol_id = 1;
+    EXPECT_EQ(DataEvent().timestamp.nanoseconds_since_epoch, 0u);
+    EXPECT_EQ(DataEvent(DataEventType::MARKET_TICK, tick, Timestamp(5)).timestamp.nanoseconds_since_epoch, 5u);
+    EXPECT_GT(DataEvent(DataEventType::MARKET_TICK, tick).timestamp.nanoseconds_since_epoch, 0u);
+}
+
+TEST_F(RingBufferTest, IngestionEngineRingStorageIsOutOfLine) {
+    // The 1M-slot event ring lives in its own mapping, not inside the engine
+    EXPECT_LT(sizeof(DataIngestionEngine), 1024u * 1024u);
+
+    DataIngestionEngine::Config config;
+    config.enable_hugepages = true;  // Falls back to regular pages when none are reserved
+    DataIngestionEngine engine(config);
+    EXPECT_TRUE(engine.publish_event(DataEvent()));
+    EXPECT_EQ(engine.get_events_dropped(), 0u);
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include "../include/straddle_strategy.h"
+#include "../include/order_router.h"
+
+using namespace hft::data;
+using namespace hft::strategy;
+
+namespace {
+
+StraddlePosition make_position(int64_t premium_bp) {
+    StraddlePosition position{};
+    position.total_premium_paid.value = premium_bp;
+    position.current_call_price.value = premium_bp / 2;
+    position.current_put_price.value = premium_bp / 2;
+    return position;
+}
+
+PortfolioExposure exposure_of(double market_value, uint32_t positions) {
+    PortfolioExposure exposure;
+    exposure.market_value = market_value;
+    exposure.positions = positions;
+    return exposure;
+}
+
+} // namespace
+
+TEST(RiskManagerTest, LimitsUseRunningExposure) {
+    RiskManager::RiskLimits limits;
+    limits.max_portfolio_risk = 0.10;
+    limits.max_position_size = 0.05;
+    limits.max_positions = 3;
+    RiskManager risk(limits);
+
+    const double portfolio_value = 100000.0;
+    const StraddlePosition position = make_position(400000);  // $40 premium = $4000 per straddle
+
+    risk.set_portfolio_value(portfolio_value);
+    PortfolioExposure exposure;
+    EXPECT_TRUE(risk.can_open_position(position, portfolio_value));
+    EXPECT_FALSE(risk.can_open_position(make_position(600000), portfolio_value));  // 6% > 5%
+
+    exposure.add(position, 1.0);
+    exposure.positions = 1;
+    risk.update_symbol_risk(1, exposure);
+    EXPECT_NEAR(risk.get_portfolio_risk(), 0.04, 1e-12);
+    EXPECT_TRUE(risk.can_open_position(position, portfolio_value));
+
+    exposure.add(position, 1.0);
+    exposure.positions = 2;
+    risk.update_symbol_risk(1, exposure);
+    EXPECT_FALSE(risk.can_open_position(position, portfolio_value));  // 8% + 4% > 10%
+    EXPECT_FALSE(risk.should_reduce_exposure());
+
+    exposure.add(position, 1.0);
+    exposure.positions = 3;
+    risk.update_symbol_risk(1, exposure);
+    EXPECT_TRUE(risk.should_reduce_exposure());
+    EXPECT_TRUE(risk.is_risk_limit_breached());
+    EXPECT_FALSE(risk.get_risk_alerts().empty());
+}
+
+TEST(RiskManagerTest, UnsetPortfolioValueRefusesEntries) {
+    RiskManager risk;
+    EXPECT_FALSE(risk.can_open_position(1, 1.0));
+    EXPECT_FALSE(risk.can_open_position(make_position(10000), 0.0));
+    EXPECT_EQ(risk.get_headroom().portfolio, 0.0);
+
+    risk.set_portfolio_value(100000.0);
+    EXPECT_TRUE(risk.can_open_position(1, 1.0));
+}
+
+TEST(RiskManagerTest, LossLimitsStopTrading) {
+    RiskManager risk;
+    const double portfolio_value = 100000.0;
+    risk.set_portfolio_value(portfolio_value);
+    EXPECT_FALSE(risk.should_stop_trading());
+
+    risk.update_daily_pnl(-2500.0);  // 2.5% > 2% daily limit
+    EXPECT_TRUE(risk.should_stop_trading());
+    EXPECT_FALSE(risk.can_open_position(make_position(10000), portfolio_value));
+
+    risk.reset_daily_pnl();
+    EXPECT_FALSE(risk.should_stop_trading());
+    EXPECT_DOUBLE_EQ(risk.get_monthly_pnl(), -2500.0);
+}
+
+TEST(RiskManagerTest, SectorAndCorrelationBucketsCapExposure) {
+    RiskManager::RiskLimits limits;
+    limits.max_portfolio_risk = 1.0;
+    limits.max_position_size = 0.05;
+    limits.max_sector_exposure = 0.08;
+    RiskManager risk(limits);
+    risk.set_portfolio_value(100000.0);
+
+    ASSERT_TRUE(risk.set_sector(1, 3));
+    ASSERT_TRUE(risk.set_sector(2, 3));
+    ASSERT_TRUE(risk.set_correlation_group(2, 5));
+    ASSERT_TRUE(risk.set_correlation_group(4, 5));
+    EXPECT_FALSE(risk.set_sector(hft::constants::MAX_SYMBOLS, 3));
+    EXPECT_FALSE(risk.set_correlation_group(1, RiskManager::MAX_BUCKETS));
+
+    EXPECT_TRUE(risk.can_open_position(1, 4000.0));
+    EXPECT_FALSE(risk.can_open_position(1, 6000.0));     // 6% > 5% position size
+
+    risk.update_symbol_risk(1, exposure_of(50.0, 1));    // $5000 in sector 3
+    EXPECT_TRUE(risk.can_open_position(2, 3000.0));
+    EXPECT_FALSE(risk.can_open_position(2, 3500.0));     // Sector 3 would reach 8.5%
+    EXPECT_TRUE(risk.can_open_position(3, 5000.0));      // Unassigned: only portfolio limits
+
+    risk.update_symbol_risk(4, exposure_of(30.0, 1));    // $3000 in group 5
+    EXPECT_FALSE(risk.can_open_position(2, 2500.0));     // Group 5 is sized as one position
+    EXPECT_TRUE(risk.can_open_position(2, 2000.0));
+
+    // Same checks through the position overload at the stored portfolio value
+    StraddlePosition position = make_position(250000);  // $2500
+    position.symbol_id = 2;
+    EXPECT_FALSE(risk.can_open_position(position, 100000.0));
+    EXPECT_TRUE(risk.can_open_position(position, 200000.0));   // Evaluated from the totals
+
+    risk.update_symbol_risk(2, exposure_of(40.0, 1));    // Over both bucket limits
+    EXPECT_TRUE(risk.is_risk_limit_breached());
+    RiskManager::Alert alerts[RiskManager::MAX_ALERTS];
+    const size_t count = risk.get_risk_alerts(alerts, RiskManager::MAX_ALERTS);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(alerts[0].kind, RiskManager::Alert::Kind::SECTOR_EXPOSURE);
+    EXPECT_EQ(alerts[1].kind, RiskManager::Alert::Kind::CORRELATED_EXPOSURE);
+
+    risk.update_symbol_risk(2, PortfolioExposure{});
+    EXPECT_FALSE(risk.is_risk_limit_breached());
+}
+
+TEST(RiskManagerTest, SymbolUpdatesKeepHeadroomIncremental) {
+    RiskManager::RiskLimits limits;
+    limits.max_positions = 3;
+    RiskManager risk(limits);
+    risk.set_portfolio_value(100000.0);
+    ASSERT_TRUE(risk.set_sector(7, 1));
+    const double sector_limit = limits.max_sector_exposure * 100000.0;
+
+    risk.update_symbol_risk(7, exposure_of(12.34, 1));
+    risk.update_symbol_risk(8, exposure_of(20.0, 2));
+    EXPECT_NEAR(risk.get_portfolio_risk(), 0.03234, 1e-12);
+    EXPECT_EQ(risk.get_headroom().positions, 0u);
+    EXPECT_FALSE(risk.can_open_position(9, 1.0));        // Position count
+
+    // Marks move repeatedly; headroom tracks the latest value only
+    for (int i = 0; i < 1000; ++i) {
+        risk.update_symbol_risk(7, exposure_of(10.0 + 0.01 * i, 1));
+    }
+    EXPECT_NEAR(risk.get_headroom().sector[1], sector_limit - 1999.0, 1e-6);
+
+    risk.update_symbol_risk(8, exposure_of(0.0, 0));
+    EXPECT_EQ(risk.get_headroom().positions, 2u);
+    risk.update_symbol_risk(7, exposure_of(0.0, 0));
+    EXPECT_EQ(risk.get_portfolio_risk(), 0.0);           // Flat book resyncs exactly
+    EXPECT_EQ(risk.get_headroom().sector[1], sector_limit);
+    EXPECT_EQ(risk.get_headroom().portfolio, limits.max_portfolio_risk * 100000.0);
+}
+
+TEST(RiskManagerTest, KillSwitchLatchesAndHaltsRouter) {
+    size_t writes = 0;
+    hft::execution::OrderRouter router([&](const uint8_t*, size_t) { return ++writes, true; });
+    RiskManager risk;
+    risk.set_portfolio_value(100000.0);
+    router.set_kill_switch(risk.kill_switch());
+
+    ASSERT_NE(router.submit_straddle(hft::execution::Side::BUY, 1, Price(2.0), 2, Price(2.0), 1), 0u);
+    risk.engage_kill_switch();                          // After queueing, before the wire
+    EXPECT_EQ(router.submit_straddle(hft::execution::Side::BUY, 1, Price(2.0), 2, Price(2.0), 1), 0u);
+    EXPECT_EQ(router.poll(), 1u);
+    EXPECT_EQ(writes, 0u);
+    EXPECT_EQ(router.orders_blocked(), 4u);
+    EXPECT_FALSE(risk.can_open_position(1, 100.0));
+    EXPECT_TRUE(risk.is_risk_limit_breached());
+
+    risk.release_kill_switch();
+    EXPECT_TRUE(risk.can_open_position(1, 100.0));
+    ASSERT_NE(router.submit_straddle(hft::execution::Side::BUY, 1, Price(2.0), 2, Price(2.0), 1), 0u);
+    router.poll();
+    EXPECT_EQ(writes, 1u);
+
+    // A loss limit engages it on its own and a P&L reset does not clear it
+    risk.update_daily_pnl(-2500.0);
+    EXPECT_TRUE(risk.is_kill_switch_engaged());
+    risk.reset_daily_pnl();
+    EXPECT_FALSE(risk.should_stop_trading());
+    EXPECT_TRUE(risk.is_kill_switch_engaged());
+    EXPECT_FALSE(risk.can_open_position(1, 100.0));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "../include/symbol_mapper.h"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hft::data;
+
+class SymbolMapperTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        mapper_ = std::make_unique<SymbolMapper>();
+    }
+
+    std::unique_ptr<SymbolMapper> mapper_;
+};
+
+TEST_F(SymbolMapperTest, KeyPacksTickersInline) {
+    static_assert(sizeof(SymbolKey) == 8, "SymbolKey must be one word");
+    constexpr SymbolKey aapl = SymbolKey::from("AAPL");
+    EXPECT_TRUE(aapl.valid());
+    EXPECT_EQ(aapl.to_string(), "AAPL");
+    EXPECT_EQ(SymbolKey::from("GOOGLEAB").to_string(), "GOOGLEAB");
+    EXPECT_FALSE(SymbolKey::from("").valid());
+    EXPECT_FALSE(SymbolKey::from("TOOLONGXX").valid());
+    EXPECT_NE(SymbolKey::from("GOOG"), SymbolKey::from("GOOGL"));
+}
+
+TEST_F(SymbolMapperTest, DenseIdsAndReverseLookup) {
+    EXPECT_EQ(mapper_->find_id("AAPL"), 0u);
+    const uint32_t aapl = mapper_->get_id("AAPL");
+    const uint32_t msft = mapper_->get_id("MSFT");
+    EXPECT_EQ(aapl, 1u);
+    EXPECT_EQ(msft, 2u);
+    EXPECT_EQ(mapper_->get_id("AAPL"), aapl);
+    EXPECT_EQ(mapper_->find_id("MSFT"), msft);
+    EXPECT_EQ(mapper_->get_symbol(msft), "MSFT");
+    EXPECT_EQ(mapper_->get_symbol(99), "");
+    EXPECT_EQ(mapper_->get_id("NOT_A_TICKER"), 0u);
+    EXPECT_EQ(mapper_->size(), 2u);
+}
+
+TEST_F(SymbolMapperTest, FrozenUniverseKeepsIds) {
+    const uint32_t nvda = mapper_->get_id("NVDA");
+    const std::vector<std::string> universe = {
+        "AAPL", "MSFT", "GOOGL", "GOOG", "AMZN", "TSLA", "NVDA", "META", "NFLX", "CRM", "ADBE",
+        "ORCL", "NOW", "SNOW", "ZM", "SHOP", "SQ", "PYPL", "ROKU", "TWLO", "OKTA", "DDOG", "CRWD",
+        "AMD", "INTC", "QCOM", "AVGO", "MU"};
+    mapper_->freeze(universe);
+
+    EXPECT_TRUE(mapper_->is_frozen());
+    EXPECT_EQ(mapper_->find_id("NVDA"), nvda);
+    for (const auto& symbol : universe) {
+        const uint32_t id = mapper_->find_id(symbol);
+        ASSERT_NE(id, 0u) << symbol;
+        EXPECT_EQ(mapper_->get_symbol(id), symbol);
+    }
+
+    // Symbols outside the frozen set still register through the slow path
+    const uint32_t ibm = mapper_->get_id("IBM");
+    EXPECT_EQ(ibm, universe.size() + 1);
+    EXPECT_EQ(mapper_->find_id("IBM"), ibm);
+}
+
+TEST_F(SymbolMapperTest, FullUniverseFreezesCompactly) {
+    std::vector<std::string> universe;
+    for (size_t i = 0; i < SymbolMapper::MAX_IDS; ++i) {
+        universe.push_back("U" + std::to_string(i * 7919));
+    }
+    ASSERT_TRUE(mapper_->freeze(universe));
+    EXPECT_LE(mapper_->frozen_slots(), 2 * universe.size() + universe.size() / 4);
+    for (size_t i = 0; i < universe.size(); ++i) {
+        ASSERT_EQ(mapper_->find_id(universe[i]), i + 1) << universe[i];
+    }
+    EXPECT_EQ(mapper_->find_id("U1"), 0u);
+}
+
+TEST_F(SymbolMapperTest, FreezeRejectsUnmappableTickers) {
+    EXPECT_FALSE(mapper_->freeze({"AAPL", "BRK.A.PREF", "", "MSFT"}));
+    EXPECT_TRUE(mapper_->is_frozen());
+    EXPECT_EQ(mapper_->size(), 2u);
+    EXPECT_EQ(mapper_->find_id("MSFT"), 2u);
+    EXPECT_EQ(mapper_->find_id("BRK.A.PREF"), 0u);
+    EXPECT_TRUE(mapper_->freeze({"AAPL"}));
+}
+
+TEST_F(SymbolMapperTest, UniverseCapacityIsBounded) {
+    for (size_t i = 0; i < SymbolMapper::MAX_IDS; ++i) {
+        ASSERT_NE(mapper_->get_id("S" + std::to_string(i)), 0u);
+    }
+    EXPECT_EQ(mapper_->get_id("OVERFLOW"), 0u);
+    EXPECT_EQ(mapper_->find_id("S0"), 1u);
+}
+
+TEST_F(SymbolMapperTest, ConcurrentRegistrationIsConsistent) {
+    constexpr int THREADS = 4;
+    constexpr int SYMBOLS = 200;
+    std::vector<std::vector<uint32_t>> seen(THREADS, std::vector<uint32_t>(SYMBOLS));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            // Every thread registers the same symbols in a different order
+            for (int i = 0; i < SYMBOLS; ++i) {
+                const int s = (i + t * 37) % SYMBOLS;
+                seen[t][s] = mapper_->get_id("T" + std::to_string(s));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    EXPECT_EQ(mapper_->size(), static_cast<size_t>(SYMBOLS));
+    for (int s = 0; s < SYMBOLS; ++s) {
+        ASSERT_NE(seen[0][s], 0u);
+        for (int t = 1; t < THREADS; ++t) {
+            ASSERT_EQ(seen[t][s], seen[0][s]);
+        }
+        EXPECT_EQ(mapper_->get_symbol(seen[0][s]), "T" + std::to_string(s));
+    }
+}
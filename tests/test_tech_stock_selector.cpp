@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "../include/tech_stock_selector.h"
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace hft::data;
+using hft::selection::OptionsChainSnapshot;
+using hft::selection::SelectionScore;
+using hft::selection::StockFundamentals;
+using hft::selection::TechStockSelector;
+
+namespace {
+
+// Passes every default filter; quality scales the liquidity inputs
+StockFundamentals make_fundamentals(const std::string& symbol, double quality) {
+    StockFundamentals f;
+    f.symbol = symbol;
+    f.category = hft::selection::StockCategory::LARGE_CAP;
+    f.market_cap = 60e9 * quality;
+    f.avg_daily_volume_3m = 12e6 * quality;
+    f.avg_daily_dollar_volume = 600e6 * quality;
+    f.shares_outstanding = 1e9;
+    f.free_float = 0.9e9;
+    f.avg_options_volume = 50000 * quality;
+    f.avg_options_open_int = 500000;
+    f.avg_bid_ask_spread_pct = 0.005;
+    f.avg_implied_volatility = 0.30;
+    f.historical_vol_30d = 0.33;
+    f.historical_vol_90d = 0.30;
+    f.vol_of_vol = 0.30;
+    f.beta = 1.3;
+    f.days_to_earnings = 10;
+    f.has_upcoming_events = false;
+    return f;
+}
+
+MarketTick make_tick(uint32_t sequence) {
+    MarketTick t{};
+    t.bid = Price::from_basis_points(1000000);
+    t.ask = Price::from_basis_points(1000200);
+    t.last = Price::from_basis_points(1000100);
+    t.bid_size = 500;
+    t.ask_size = 500;
+    t.timestamp = Timestamp(sequence);
+    t.sequence_number = sequence;
+    return t;
+}
+
+// Universe of n symbols S0..S(n-1) with rising quality
+struct Fixture {
+    TechStockSelector selector;
+    std::map<std::string, MarketTick> ticks;
+
+    Fixture(size_t n, const TechStockSelector::Config& config) : selector(config) {
+        EXPECT_TRUE(selector.initialize());
+        for (size_t i = 0; i < n; ++i) {
+            const std::string symbol = "S" + std::to_string(i);
+            selector.get_universe().update_fundamentals(symbol, make_fundamentals(symbol, 1.0 + 0.05 * i));
+            ticks[symbol] = make_tick(1);
+        }
+        selector.get_universe().refresh_universe();
+        selector.set_market_data_callback([this](const std::string& symbol, MarketTick& tick) {
+            auto it = ticks.find(symbol);
+            if (it == ticks.end()) return false;
+            tick = it->second;
+            return true;
+        });
+    }
+};
+
+TechStockSelector::Config lenient_config() {
+    TechStockSelector::Config config;
+    config.min_total_score = 0.0;
+    config.max_selections = 3;
+    return config;
+}
+
+} // namespace
+
+TEST(TechStockSelectorTest, SelectsTopScoresInOrder) {
+    Fixture fx(10, lenient_config());
+    const std::vector<SelectionScore> selection = fx.selector.select_best_candidates();
+
+    ASSERT_EQ(selection.size(), 3u);
+    EXPECT_EQ(selection[0].symbol, "S9");
+    EXPECT_EQ(selection[1].symbol, "S8");
+    EXPECT_EQ(selection[2].symbol, "S7");
+    for (size_t i = 0; i < selection.size(); ++i) {
+        EXPECT_EQ(selection[i].rank, static_cast<int>(i + 1));
+        EXPECT_TRUE(selection[i].is_tradeable);
+        EXPECT_FALSE(selection[i].selection_reason.empty());
+    }
+    EXPECT_GE(selection[0].total_score, selection[1].total_score);
+    EXPECT_TRUE(fx.selector.is_selection_valid());
+    EXPECT_EQ(fx.selector.get_top_symbols(2), (std::vector<std::string>{"S9", "S8"}));
+}
+
+TEST(TechStockSelectorTest, FiltersUntradeableSymbols) {
+    Fixture fx(4, lenient_config());
+    StockFundamentals rich = make_fundamentals("S3", 2.0);
+    rich.avg_implied_volatility = 0.95;   // Above max_implied_vol
+    fx.selector.get_universe().update_fundamentals("S3", rich);
+    fx.ticks.erase("S2");                 // No market data
+
+    const std::vector<std::string> top = fx.selector.get_top_symbols(5);
+    EXPECT_EQ(top, (std::vector<std::string>{"S1", "S0"}));
+}
+
+TEST(TechStockSelectorTest, RescoresOnlyChangedSymbols) {
+    Fixture fx(50, lenient_config());
+    const size_t universe = fx.selector.get_universe().get_universe_size();
+
+    fx.selector.select_best_candidates();
+    EXPECT_EQ(fx.selector.get_symbols_rescored(), universe);
+
+    fx.selector.select_best_candidates();
+    EXPECT_EQ(fx.selector.get_symbols_rescored(), universe);   // Nothing changed
+
+    fx.ticks["S3"] = make_tick(2);
+    fx.selector.get_universe().update_fundamentals("S4", make_fundamentals("S4", 1.1));
+    fx.selector.select_best_candidates();
+    EXPECT_EQ(fx.selector.get_symbols_rescored(), universe + 2);
+
+    // Weights feed every total
+    TechStockSelector::Config config = lenient_config();
+    config.technical_weight = 0.5;
+    fx.selector.update_config(config);
+    fx.selector.select_best_candidates();
+    EXPECT_EQ(fx.selector.get_symbols_rescored(), 2 * universe + 2);
+}
+
+TEST(TechStockSelectorTest, OptionsChainRevisionMarksSymbolDirty) {
+    Fixture fx(5, lenient_config());
+    OptionsChain chain(1);
+    fx.selector.set_options_chain_provider([&chain](const std::string& symbol, OptionsChainSnapshot& options) {
+        if (symbol != "S0") return false;
+        options = OptionsChainSnapshot::of(chain);
+        return true;
+    });
+    fx.selector.select_best_candidates();
+    const uint64_t baseline = fx.selector.get_symbols_rescored();
+
+    OptionTick quote{};
+    quote.underlying_id = 1;
+    quote.expiration_date = 20260320;
+    quote.days_to_expiry = 30;
+    quote.strike = Price::from_basis_points(1000000);
+    quote.bid = Price::from_basis_points(50000);
+    quote.ask = Price::from_basis_points(50100);
+    ASSERT_TRUE(chain.update(quote));
+    fx.selector.select_best_candidates();
+    EXPECT_EQ(fx.selector.get_symbols_rescored(), baseline + 1);
+}
+
+TEST(TechStockSelectorTest, ParallelScoringMatchesSerial) {
+    TechStockSelector::Config serial = lenient_config();
+    serial.max_selections = 20;
+    serial.num_threads = 1;
+    TechStockSelector::Config parallel = serial;
+    parallel.num_threads = 4;
+    parallel.min_symbols_per_thread = 1;
+
+    Fixture a(600, serial);
+    Fixture b(600, parallel);
+    const std::vector<SelectionScore> expected = a.selector.select_best_candidates();
+    const std::vector<SelectionScore> actual = b.selector.select_best_candidates();
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(expected[i].symbol, actual[i].symbol);
+        EXPECT_DOUBLE_EQ(expected[i].total_score, actual[i].total_score);
+    }
+
+    // Later cycles reuse the pool, including with fewer workers than it holds
+    for (size_t threads : {4, 2, 3}) {
+        serial.technical_weight += 0.05;
+        parallel = serial;
+        parallel.num_threads = threads;
+        parallel.min_symbols_per_thread = 1;
+        a.selector.update_config(serial);
+        b.selector.update_config(parallel);
+        const std::vector<SelectionScore> again = a.selector.select_best_candidates();
+        const std::vector<SelectionScore> pooled = b.selector.select_best_candidates();
+        ASSERT_EQ(again.size(), pooled.size());
+        for (size_t i = 0; i < again.size(); ++i) {
+            EXPECT_EQ(again[i].symbol, pooled[i].symbol);
+            EXPECT_DOUBLE_EQ(again[i].total_score, pooled[i].total_score);
+        }
+    }
+    EXPECT_EQ(b.selector.get_symbols_rescored(), a.selector.get_symbols_rescored());
+}
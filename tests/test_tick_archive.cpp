@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "../include/data_ingestion.h"
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <unistd.h>
+
+using namespace hft::data;
+namespace fs = std::filesystem;
+
+class TickArchiveTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() / ("hft_archive_" + std::to_string(::getpid()));
+        fs::create_directories(dir_);
+
+        std::mt19937_64 rng(11);
+        std::uniform_int_distribution<int> step(-3, 3);
+        std::uniform_int_distribution<uint64_t> gap(0, 2000000);
+        uint64_t ts = 1640995200000000000ull;  // 2022-01-01
+        int64_t mid = 1500000;                 // 150.0000
+        for (size_t i = 0; i < NUM_TICKS; ++i) {
+            ts += gap(rng);
+            mid += step(rng);
+            MarketTick tick{};
+            tick.timestamp = Timestamp(ts);
+            tick.bid.value = mid - 5;
+            tick.ask.value = mid + 5;
+            tick.last.value = mid;
+            tick.bid_size = 100 + i % 7;
+            tick.ask_size = 200 + i % 5;
+            tick.volume = static_cast<uint32_t>(i * 13 % 10000);
+            tick.sequence_number = static_cast<uint32_t>(i + 1);
+            tick.exchange_id = i % 3;
+            ticks_.push_back(tick);
+        }
+    }
+
+    void TearDown() override {
+        fs::remove_all(dir_);
+    }
+
+    void write_csv(const fs::path& path) const {
+        std::ofstream out(path);
+        out.precision(12);
+        out << "timestamp_ns,bid,ask,last,bid_size,ask_size,volume,sequence,exchange_id\n";
+        for (const auto& t : ticks_) {
+            out << t.timestamp.nanoseconds_since_epoch << ',' << t.bid.to_double() << ',' << t.ask.to_double()
+                << ',' << t.last.to_double() << ',' << t.bid_size << ',' << t.ask_size << ',' << t.volume
+                << ',' << t.sequence_number << ',' << t.exchange_id << '\n';
+        }
+    }
+
+    static void expect_same(const MarketTick& a, const MarketTick& b) {
+        EXPECT_EQ(a.timestamp.nanoseconds_since_epoch, b.timestamp.nanoseconds_since_epoch);
+        EXPECT_EQ(a.bid.value, b.bid.value);
+        EXPECT_EQ(a.ask.value, b.ask.value);
+        EXPECT_EQ(a.last.value, b.last.value);
+        EXPECT_EQ(a.bid_size, b.bid_size);
+        EXPECT_EQ(a.ask_size, b.ask_size);
+        EXPECT_EQ(a.volume, b.volume);
+        EXPECT_EQ(a.sequence_number, b.sequence_number);
+        EXPECT_EQ(a.exchange_id, b.exchange_id);
+    }
+
+    static constexpr size_t NUM_TICKS = archive_format::BLOCK_TICKS * 5 + 17;
+    fs::path dir_;
+    std::vector<MarketTick> ticks_;
+};
+
+TEST_F(TickArchiveTest, RoundTripIsLosslessAndCompact) {
+    const std::string path = (dir_ / "aapl.htick").string();
+    ASSERT_TRUE(TickArchive::write(path, {ArchiveSeries{"AAPL", ticks_.data(), ticks_.size()}}));
+    EXPECT_LT(fs::file_size(path), NUM_TICKS * sizeof(MarketTick) / 3);
+
+    HistoricalDataLoader loader(dir_.string());
+    ASSERT_TRUE(loader.load_binary_data("aapl.htick"));
+    EXPECT_EQ(loader.get_data_points("AAPL"), NUM_TICKS);
+    EXPECT_EQ(loader.get_earliest_timestamp("AAPL").nanoseconds_since_epoch,
+              ticks_.front().timestamp.nanoseconds_since_epoch);
+    EXPECT_EQ(loader.get_latest_timestamp("AAPL").nanoseconds_since_epoch,
+              ticks_.back().timestamp.nanoseconds_since_epoch);
+
+    const auto all = loader.get_historical_data("AAPL", Timestamp(0), Timestamp(UINT64_MAX));
+    EXPECT_EQ(all.data(), nullptr);  // Decoded from the mapping, not an in-memory copy
+    EXPECT_EQ(all.size(), NUM_TICKS);
+    size_t i = 0;
+    const uint32_t id = all.begin()->symbol_id;
+    for (const auto& tick : all) {
+        ASSERT_LT(i, NUM_TICKS);
+        expect_same(tick, ticks_[i++]);
+        EXPECT_EQ(tick.symbol_id, id);
+    }
+    EXPECT_EQ(i, NUM_TICKS);
+}
+
+TEST_F(TickArchiveTest, TimeRangeUsesIndexAndClipsEdges) {
+    const std::string path = (dir_ / "ticks.htick").string();
+    ASSERT_TRUE(TickArchive::write(path, {ArchiveSeries{"AAPL", ticks_.data(), ticks_.size()}}));
+    HistoricalDataLoader loader(dir_.string());
+    ASSERT_TRUE(loader.load_binary_data(path));
+
+    // Range spanning partial first/last blocks, bounds inclusive
+    const size_t lo = 1000, hi = 3500;
+    const auto range = loader.get_historical_data("AAPL", ticks_[lo].timestamp, ticks_[hi].timestamp);
+    size_t expected_first = lo;
+    while (expected_first > 0 && ticks_[expected_first - 1].timestamp.nanoseconds_since_epoch ==
+                                 ticks_[lo].timestamp.nanoseconds_since_epoch) --expected_first;
+    size_t expected_last = hi;
+    while (expected_last + 1 < NUM_TICKS && ticks_[expected_last + 1].timestamp.nanoseconds_since_epoch ==
+                                            ticks_[hi].timestamp.nanoseconds_since_epoch) ++expected_last;
+
+    const auto copy = range.to_vector();
+    ASSERT_EQ(copy.size(), expected_last - expected_first + 1);
+    EXPECT_EQ(range.size(), copy.size());
+    expect_same(copy.front(), ticks_[expected_first]);
+    expect_same(copy.back(), ticks_[expected_last]);
+
+    EXPECT_TRUE(loader.get_historical_data("AAPL", Timestamp(1), Timestamp(2)).empty());
+    EXPECT_TRUE(loader.get_historical_data("MSFT", Timestamp(0), Timestamp(UINT64_MAX)).empty());
+}
+
+TEST_F(TickArchiveTest, IteratorsDecodeIndependently) {
+    const std::string path = (dir_ / "ticks.htick").string();
+    ASSERT_TRUE(TickArchive::write(path, {ArchiveSeries{"AAPL", ticks_.data(), ticks_.size()}}));
+    HistoricalDataLoader loader(dir_.string());
+    ASSERT_TRUE(loader.load_binary_data(path));
+
+    TickRange range = loader.get_historical_data("AAPL", Timestamp(0), Timestamp(UINT64_MAX));
+    auto outer = range.begin();
+    for (size_t i = 0; i < archive_format::BLOCK_TICKS + 3; ++i) ++outer;
+
+    // A second pass, empty() and size() leave the first one where it was
+    size_t inner_count = 0;
+    for (const auto& tick : range) {
+        expect_same(tick, ticks_[inner_count++]);
+    }
+    EXPECT_EQ(inner_count, NUM_TICKS);
+    EXPECT_FALSE(range.empty());
+    EXPECT_EQ(range.size(), NUM_TICKS);
+    expect_same(*outer, ticks_[archive_format::BLOCK_TICKS + 3]);
+
+    // Copies own their block; iterators outlive a move of the range
+    auto copy = outer;
+    ++outer;
+    expect_same(*copy, ticks_[archive_format::BLOCK_TICKS + 3]);
+    TickRange moved = std::move(range);
+    size_t position = archive_format::BLOCK_TICKS + 4;
+    for (; outer != moved.end(); ++outer) {
+        expect_same(*outer, ticks_[position++]);
+    }
+    EXPECT_EQ(position, NUM_TICKS);
+}
+
+TEST_F(TickArchiveTest, CsvConvertsOnceThenLoadsBinary) {
+    write_csv(dir_ / "AAPL.csv");
+
+    {
+        HistoricalDataLoader loader(dir_.string());
+        ASSERT_TRUE(loader.load_symbol("AAPL"));
+        const auto range = loader.get_historical_data("AAPL", Timestamp(0), Timestamp(UINT64_MAX));
+        EXPECT_NE(range.data(), nullptr);  // Parsed CSV lives in memory
+        EXPECT_EQ(range.size(), NUM_TICKS);
+    }
+    ASSERT_TRUE(fs::exists(dir_ / "AAPL.htick"));
+
+    fs::remove(dir_ / "AAPL.csv");
+    HistoricalDataLoader loader(dir_.string());
+    ASSERT_TRUE(loader.load_symbol("AAPL"));
+    const auto range = loader.get_historical_data("AAPL", Timestamp(0), Timestamp(UINT64_MAX));
+    EXPECT_EQ(range.data(), nullptr);
+    size_t i = 0;
+    for (const auto& tick : range) {
+        expect_same(tick, ticks_[i++]);
+    }
+    EXPECT_EQ(i, NUM_TICKS);
+}
+
+TEST_F(TickArchiveTest, MultiSymbolSaveAndRejectCorruptFiles) {
+    write_csv(dir_ / "a.csv");
+    HistoricalDataLoader writer(dir_.string());
+    ASSERT_TRUE(writer.load_csv_data("a.csv", "AAPL"));
+    ASSERT_TRUE(writer.load_csv_data("a.csv", "MSFT"));
+    ASSERT_TRUE(writer.save_binary_data("both.htick"));
+
+    HistoricalDataLoader reader(dir_.string());
+    ASSERT_TRUE(reader.load_binary_data("both.htick"));
+    EXPECT_EQ(reader.get_data_points("AAPL"), NUM_TICKS);
+    EXPECT_EQ(reader.get_data_points("MSFT"), NUM_TICKS);
+
+    std::ofstream(dir_ / "bad.htick") << "not an archive at all, just some bytes";
+    EXPECT_FALSE(reader.load_binary_data("bad.htick"));
+    EXPECT_FALSE(reader.load_binary_data("missing.htick"));
+
+    // Truncation is caught when the archive is opened
+    const auto size = fs::file_size(dir_ / "both.htick");
+    fs::copy_file(dir_ / "both.htick", dir_ / "cut.htick");
+    fs::resize_file(dir_ / "cut.htick", size - 40);
+    EXPECT_EQ(TickArchive::open((dir_ / "cut.htick").string()), nullptr);
+}
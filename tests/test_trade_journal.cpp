@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "../include/trade_journal.h"
+#include "../include/backtest_engine.h"
+#include "strategy_scenario.h"
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+using namespace hft::data;
+using hft::strategy::StraddleStrategy;
+using namespace hft::scenario;
+namespace fs = std::filesystem;
+
+namespace {
+
+JournalRecord make_record(uint32_t id, JournalEvent event) {
+    JournalRecord record{};
+    record.timestamp_ns = START + id;
+    record.position_id = id;
+    record.symbol_id = id % 7;
+    record.event = event;
+    record.call_strike.value = 1020000;
+    record.put_strike.value = 980000;
+    record.premium.value = 40000;
+    record.value.value = 49000;
+    record.pnl.value = 900000;
+    return record;
+}
+
+} // namespace
+
+class TradeJournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::temp_directory_path() / ("hft_journal_" + std::to_string(::getpid()));
+        fs::create_directories(dir_);
+        config_.path = (dir_ / "trades.journal").string();
+    }
+
+    void TearDown() override {
+        fs::remove_all(dir_);
+    }
+
+    fs::path dir_;
+    TradeJournal::Config config_;
+};
+
+TEST_F(TradeJournalTest, WriterThreadPersistsEveryRecord) {
+    constexpr uint32_t COUNT = 5000;
+    {
+        TradeJournal journal(config_);
+        ASSERT_TRUE(journal.start());
+        for (uint32_t i = 1; i <= COUNT; ++i) {
+            while (!journal.record(make_record(i, JournalEvent::POSITION_CLOSE))) {
+                std::this_thread::yield();   // Only if the writer falls a full ring behind
+            }
+        }
+        journal.stop();
+        EXPECT_EQ(journal.records_written(), COUNT);
+        EXPECT_EQ(journal.write_failures(), 0u);
+    }
+
+    std::vector<JournalRecord> records;
+    ASSERT_TRUE(decode_journal(config_.path, records));
+    ASSERT_EQ(records.size(), COUNT);
+    for (uint32_t i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(records[i].position_id, i + 1);
+        EXPECT_EQ(records[i].timestamp_ns, START + i + 1);
+    }
+    EXPECT_EQ(fs::file_size(config_.path), sizeof(JournalHeader) + COUNT * sizeof(JournalRecord));
+}
+
+TEST_F(TradeJournalTest, FullQueueDropsInsteadOfBlocking) {
+    TradeJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+    for (size_t i = 0; i < TradeJournal::QUEUE_CAPACITY; ++i) {
+        ASSERT_TRUE(journal.record(make_record(1, JournalEvent::POSITION_OPEN)));
+    }
+    EXPECT_FALSE(journal.record(make_record(2, JournalEvent::POSITION_OPEN)));
+    EXPECT_EQ(journal.records_dropped(), 1u);
+
+    EXPECT_EQ(journal.flush(), TradeJournal::QUEUE_CAPACITY);
+    EXPECT_TRUE(journal.record(make_record(3, JournalEvent::POSITION_OPEN)));
+}
+
+TEST_F(TradeJournalTest, DecodesToText) {
+    char line[256];
+    const size_t length = format_record(make_record(12, JournalEvent::POSITION_CLOSE), line, sizeof(line));
+    EXPECT_EQ(std::string(line, length),
+              "[TRADE] CLOSE id=12 symbol=5 t=1640995200000000012 call=102.0000 put=98.0000 "
+              "premium=4.0000 value=4.9000 pnl=90.00");
+    EXPECT_EQ(format_record(make_record(12, JournalEvent::POSITION_CLOSE), line, 8), 7u);
+    EXPECT_STREQ(line, "[TRADE]");
+
+    std::vector<JournalRecord> records;
+    EXPECT_FALSE(decode_journal((dir_ / "missing.journal").string(), records));
+    {
+        std::ofstream(dir_ / "ticks.csv") << "timestamp,symbol,bid,ask\n";
+    }
+    EXPECT_FALSE(decode_journal((dir_ / "ticks.csv").string(), records));
+    EXPECT_TRUE(records.empty());
+}
+
+TEST_F(TradeJournalTest, StrategyJournalsOpenAndClose) {
+    const StrategyScenario scenario;
+    hft::analytics::BacktestEngine engine;
+    ASSERT_TRUE(scenario.load(engine));
+
+    TradeJournal journal(config_);
+    ASSERT_TRUE(journal.open());
+    StraddleStrategy strategy;
+    strategy.set_trade_journal(&journal);
+    engine.run(strategy);
+    journal.flush();
+
+    std::vector<JournalRecord> records;
+    ASSERT_TRUE(decode_journal(config_.path, records));
+    ASSERT_EQ(records.size(), 2u + strategy.get_active_positions_count());
+    EXPECT_EQ(records[0].event, JournalEvent::POSITION_OPEN);
+    EXPECT_EQ(records[1].event, JournalEvent::POSITION_CLOSE);
+    EXPECT_EQ(records[0].position_id, records[1].position_id);
+    EXPECT_EQ(records[1].call_strike.value, 1020000);
+    EXPECT_EQ(records[1].put_strike.value, 980000);
+    EXPECT_EQ(records[1].timestamp_ns, StrategyScenario::rally_time(START));
+    EXPECT_DOUBLE_EQ(records[1].pnl.to_double(), strategy.get_total_pnl());
+}
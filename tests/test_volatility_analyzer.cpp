@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "../include/straddle_strategy.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace hft::data;
+using hft::strategy::VolatilityAnalyzer;
+
+namespace {
+
+// Direct recomputation over the full windows, as reference
+struct Reference {
+    std::vector<double> prices;
+    std::vector<double> history;
+
+    void add(double price) {
+        prices.push_back(price);
+        if (prices.size() > VolatilityAnalyzer::VOLATILITY_WINDOW + 1) prices.erase(prices.begin());
+        if (prices.size() <= VolatilityAnalyzer::VOLATILITY_WINDOW) return;
+        double sum = 0.0, sum_sq = 0.0;
+        const size_t n = prices.size() - 1;
+        for (size_t i = 1; i < prices.size(); ++i) {
+            const double r = std::log(prices[i] / prices[i - 1]);
+            sum += r;
+            sum_sq += r * r;
+        }
+        const double mean = sum / n;
+        history.push_back(std::sqrt(std::max(0.0, (sum_sq - n * mean * mean) / (n - 1)) * 252.0));
+        if (history.size() > VolatilityAnalyzer::MAX_HISTORY) history.erase(history.begin());
+    }
+
+    double percentile() const {
+        const double current = history.back();
+        size_t below = 0, equal = 0;
+        for (double v : history) {
+            below += v < current;
+            equal += v == current;
+        }
+        return (below + 0.5 * equal) / history.size();
+    }
+};
+
+} // namespace
+
+TEST(VolatilityAnalyzerTest, MatchesFullRecomputation) {
+    VolatilityAnalyzer analyzer;
+    Reference reference;
+    std::mt19937_64 rng(11);
+    std::normal_distribution<double> noise(0.0, 1.0);
+
+    double price = 100.0;
+    for (int i = 0; i < 6000; ++i) {
+        // Volatility regimes that drift over time
+        const double sigma = 0.002 * (1.0 + 0.8 * std::sin(i / 300.0));
+        price *= std::exp(sigma * noise(rng));
+        const Price p = Price::from_double(price, Rounding::NEAREST);
+        analyzer.add_price(7, p, Timestamp(i));
+        reference.add(p.to_double());
+
+        if (reference.history.empty()) {
+            EXPECT_EQ(analyzer.get_current_volatility(7), 0.0);
+            continue;
+        }
+        ASSERT_NEAR(analyzer.get_current_volatility(7), reference.history.back(), 1e-9) << i;
+        if (i % 97 == 0) {
+            ASSERT_NEAR(analyzer.get_volatility_percentile(7), reference.percentile(), 1.5 / reference.history.size())
+                << i;
+        }
+    }
+    EXPECT_EQ(reference.history.size(), VolatilityAnalyzer::MAX_HISTORY);
+    EXPECT_GT(analyzer.predict_volatility(7, 5), 0.0);
+}
+
+TEST(VolatilityAnalyzerTest, LowRegimeAfterCalmPeriod) {
+    VolatilityAnalyzer analyzer;
+    EXPECT_FALSE(analyzer.is_low_volatility_regime(3));
+    EXPECT_DOUBLE_EQ(analyzer.get_volatility_percentile(3), 0.5);
+
+    for (int i = 0; i < 200; ++i) {
+        analyzer.add_price(3, Price::from_units(i % 2 ? 101 : 99), Timestamp(i));
+    }
+    EXPECT_FALSE(analyzer.is_low_volatility_regime(3));   // Flat history sits at the median
+    for (int i = 0; i < 40; ++i) {
+        analyzer.add_price(3, Price::from_basis_points(i % 2 ? 1000100 : 1000000), Timestamp(200 + i));
+    }
+    EXPECT_TRUE(analyzer.is_low_volatility_regime(3));
+    EXPECT_LT(analyzer.get_volatility_percentile(3), 0.30);
+
+    // Out-of-range symbols are ignored
+    analyzer.add_price(static_cast<uint32_t>(hft::constants::MAX_SYMBOLS), Price::from_units(1), Timestamp(0));
+    EXPECT_EQ(analyzer.get_current_volatility(static_cast<uint32_t>(hft::constants::MAX_SYMBOLS)), 0.0);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "../include/tech_stock_selector.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using hft::selection::VolatilityRanker;
+
+namespace {
+
+constexpr size_t WINDOW = VolatilityRanker::HISTORY_WINDOW;
+constexpr size_t TREND = VolatilityRanker::TREND_WINDOW;
+
+// Direct recomputation over the full windows, as reference
+struct Reference {
+    std::vector<double> iv;
+
+    void add(double v) {
+        iv.push_back(v);
+        if (iv.size() > WINDOW) iv.erase(iv.begin());
+    }
+
+    double percentile() const {
+        size_t below = 0, equal = 0;
+        for (double v : iv) {
+            below += v < iv.back();
+            equal += v == iv.back();
+        }
+        return 100.0 * (below + 0.5 * equal) / iv.size();
+    }
+
+    double rank() const {
+        const auto [lo, hi] = std::minmax_element(iv.begin(), iv.end());
+        return *hi > *lo ? 100.0 * (iv.back() - *lo) / (*hi - *lo) : 50.0;
+    }
+
+    double trend() const {
+        const size_t n = std::min(iv.size(), TREND);
+        if (n < 2) return 0.0;
+        double sx = 0, sy = 0, sxx = 0, sxy = 0;
+        for (size_t x = 0; x < n; ++x) {
+            const double y = iv[iv.size() - n + x];
+            sx += x;
+            sy += y;
+            sxx += double(x) * x;
+            sxy += x * y;
+        }
+        return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    }
+};
+
+} // namespace
+
+TEST(VolatilityRankerTest, UnknownSymbolHasNoMetrics) {
+    VolatilityRanker ranker;
+    VolatilityRanker::VolatilityMetrics m;
+    EXPECT_FALSE(ranker.get_volatility_metrics("AAPL", m));
+    EXPECT_FALSE(ranker.is_good_straddle_entry("AAPL"));
+    EXPECT_EQ(ranker.calculate_vol_expansion_probability("AAPL"), 0.0);
+
+    ranker.update_volatility_data("AAPL", 0.0, 0.2);   // Ignored
+    EXPECT_FALSE(ranker.get_volatility_metrics("AAPL", m));
+}
+
+TEST(VolatilityRankerTest, MatchesFullRecomputeOverLongRun) {
+    VolatilityRanker ranker;
+    Reference ref;
+    std::mt19937 rng(19);
+    std::uniform_real_distribution<double> step(-0.01, 0.01);
+
+    double iv = 0.30;
+    // Long enough to wrap both the history window and the trend resync
+    for (int i = 0; i < 5000; ++i) {
+        iv = std::clamp(iv + step(rng), 0.05, 1.0);
+        ranker.update_volatility_data("NVDA", iv, 0.28);
+        ref.add(iv);
+
+        if (i % 97 == 0 || i > 4990) {
+            VolatilityRanker::VolatilityMetrics m;
+            ASSERT_TRUE(ranker.get_volatility_metrics("NVDA", m));
+            EXPECT_EQ(m.symbol, "NVDA");
+            EXPECT_DOUBLE_EQ(m.current_iv, iv);
+            EXPECT_NEAR(m.iv_percentile, ref.percentile(), 1e-9) << i;
+            EXPECT_NEAR(m.iv_rank, ref.rank(), 1e-9) << i;
+            EXPECT_NEAR(m.volatility_trend, ref.trend(), 1e-9) << i;
+            EXPECT_NEAR(m.iv_hv_ratio, iv / 0.28, 1e-12);
+        }
+    }
+}
+
+TEST(VolatilityRankerTest, TrendFollowsDirection) {
+    VolatilityRanker ranker;
+    for (size_t i = 0; i < 3 * TREND; ++i) {
+        ranker.update_volatility_data("UP", 0.20 + 0.01 * i, 0.20);
+        ranker.update_volatility_data("DOWN", 0.60 - 0.01 * i, 0.20);
+    }
+    VolatilityRanker::VolatilityMetrics up, down;
+    ASSERT_TRUE(ranker.get_volatility_metrics("UP", up));
+    ASSERT_TRUE(ranker.get_volatility_metrics("DOWN", down));
+    EXPECT_NEAR(up.volatility_trend, 0.01, 1e-9);
+    EXPECT_NEAR(down.volatility_trend, -0.01, 1e-9);
+    EXPECT_DOUBLE_EQ(up.iv_rank, 100.0);
+    EXPECT_DOUBLE_EQ(down.iv_rank, 0.0);
+}
+
+TEST(VolatilityRankerTest, RanksAndFiltersUniverse) {
+    VolatilityRanker ranker;
+    // CHEAP ends at the bottom of a range and turning up, realized above implied
+    // RICH ends at the top; FLAT never moves
+    for (size_t i = 0; i < 40; ++i) {
+        ranker.update_volatility_data("RICH", 0.20 + 0.005 * i, 0.25);
+        ranker.update_volatility_data("FLAT", 0.30, 0.30);
+        ranker.update_volatility_data("CHEAP", 0.60 - 0.01 * i, 0.25);
+    }
+    for (size_t i = 0; i < TREND; ++i) {
+        ranker.update_volatility_data("CHEAP", 0.20 + 0.0001 * i, 0.25);
+    }
+
+    const std::vector<std::string> universe = {"RICH", "FLAT", "CHEAP", "MISSING"};
+    EXPECT_EQ(ranker.rank_by_low_volatility(universe),
+              (std::vector<std::string>{"CHEAP", "FLAT", "RICH"}));
+    EXPECT_EQ(ranker.rank_by_vol_expansion_potential(universe),
+              (std::vector<std::string>{"CHEAP", "FLAT", "RICH"}));
+
+    EXPECT_TRUE(ranker.is_good_straddle_entry("CHEAP"));
+    EXPECT_FALSE(ranker.is_good_straddle_entry("FLAT"));    // Mid percentile
+    EXPECT_FALSE(ranker.is_good_straddle_entry("RICH"));
+    EXPECT_EQ(ranker.get_optimal_straddle_candidates(universe), std::vector<std::string>{"CHEAP"});
+
+    EXPECT_GT(ranker.calculate_vol_expansion_probability("CHEAP"),
+              ranker.calculate_vol_expansion_probability("RICH"));
+}
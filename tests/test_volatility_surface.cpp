@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "../include/volatility_surface.h"
+#include <cmath>
+
+using namespace hft::data;
+
+namespace {
+
+OptionTick quote(int strike, uint8_t type, double iv, uint32_t expiry = 20220201, uint16_t days = 30) {
+    OptionTick tick{};
+    tick.underlying_id = 3;
+    tick.strike = Price::from_units(strike);
+    tick.option_type = type;
+    tick.implied_volatility = iv;
+    tick.expiration_date = expiry;
+    tick.days_to_expiry = days;
+    return tick;
+}
+
+// Smile in log-moneyness around 100
+double smile(double strike) {
+    const double k = std::log(strike / 100.0);
+    return 0.25 + 1.5 * k * k - 0.1 * k;
+}
+
+} // namespace
+
+TEST(VolatilitySurfaceTest, SplineFollowsSmile) {
+    VolatilitySurface surface(3);
+    for (int strike = 80; strike <= 120; strike += 5) {
+        ASSERT_TRUE(surface.update(quote(strike, 0, smile(strike))));
+        ASSERT_TRUE(surface.update(quote(strike, 1, smile(strike))));
+    }
+    EXPECT_FALSE(surface.update([] { OptionTick t = quote(100, 0, 0.2); t.underlying_id = 4; return t; }()));
+
+    for (double strike = 80.0; strike <= 120.0; strike += 1.25) {
+        EXPECT_NEAR(surface.implied_volatility(Price::from_double(strike, Rounding::NEAREST), 20220201u),
+                    smile(strike), 2e-3) << strike;
+    }
+    // Flat beyond the outermost strikes, nothing for unknown expiries
+    EXPECT_NEAR(surface.implied_volatility(Price::from_units(60), 20220201u), smile(80), 2e-3);
+    EXPECT_EQ(surface.implied_volatility(Price::from_units(100), 20220301u), 0.0);
+}
+
+TEST(VolatilitySurfaceTest, RefitsOnlyChangedSlices) {
+    VolatilitySurface surface(3);
+    for (int strike = 90; strike <= 110; strike += 5) {
+        surface.update(quote(strike, 0, 0.30, 20220201, 30));
+        surface.update(quote(strike, 0, 0.40, 20220301, 58));
+    }
+    ASSERT_EQ(surface.slice_count(), 2u);
+    EXPECT_DOUBLE_EQ(surface.implied_volatility(Price::from_units(100), 20220201u), 0.30f);
+    EXPECT_DOUBLE_EQ(surface.implied_volatility(Price::from_units(100), 20220301u), 0.40f);
+    EXPECT_EQ(surface.refit_count(), 2u);
+
+    // Repeated lookups and unchanged quotes do not refit
+    surface.update(quote(95, 0, 0.30, 20220201, 30));
+    surface.implied_volatility(Price::from_units(97), 20220201u);
+    surface.implied_volatility(Price::from_units(97), 20220301u);
+    EXPECT_EQ(surface.refit_count(), 2u);
+
+    surface.update(quote(95, 0, 0.35, 20220301, 58));
+    surface.update(quote(105, 0, 0.36, 20220301, 58));
+    surface.implied_volatility(Price::from_units(97), 20220201u);
+    surface.implied_volatility(Price::from_units(97), 20220301u);
+    EXPECT_EQ(surface.refit_count(), 3u);
+}
+
+TEST(VolatilitySurfaceTest, TotalVarianceLinearInTime) {
+    VolatilitySurface surface(3);
+    surface.update(quote(100, 0, 0.20, 20220201, 20));
+    surface.update(quote(100, 0, 0.40, 20220401, 80));
+
+    const double w20 = 0.20f * 0.20f * 20;
+    const double w80 = 0.40f * 0.40f * 80;
+    const double expected = std::sqrt((w20 + (w80 - w20) * (50.0 - 20.0) / 60.0) / 50.0);
+    EXPECT_NEAR(surface.implied_volatility(Price::from_units(100), 50.0), expected, 1e-6);
+    EXPECT_NEAR(surface.implied_volatility(Price::from_units(100), 5.0), 0.20, 1e-6);
+    EXPECT_NEAR(surface.implied_volatility(Price::from_units(100), 200.0), 0.40, 1e-6);
+}
+
+TEST(VolatilitySurfaceTest, ExpiryEviction) {
+    VolatilitySurface surface(3);
+    ASSERT_TRUE(surface.update(quote(100, 0, 0.3)));
+
+    // A full surface drops its earliest expiry for a later one, never the reverse
+    for (uint32_t i = 1; i < VolatilitySurface::MAX_EXPIRIES; ++i) {
+        ASSERT_TRUE(surface.update(quote(100, 0, 0.3, 20220201 + i, static_cast<uint16_t>(30 + i))));
+    }
+    EXPECT_FALSE(surface.update(quote(100, 0, 0.3, 20220101, 1)));
+    EXPECT_TRUE(surface.update(quote(100, 0, 0.3, 20230101, 365)));
+    EXPECT_EQ(surface.slice_count(), VolatilitySurface::MAX_EXPIRIES);
+    EXPECT_EQ(surface.find_expiry(20220201), VolatilitySurface::NO_SLICE);
+}
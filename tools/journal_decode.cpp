@@ -0,0 +1,40 @@
+/*
+ * ===================================================================
+ *                    TRADE JOURNAL DECODER
+ * ===================================================================
+ *
+ * Renders a binary trade journal as text, one line per record
+ *
+ * USAGE:
+ *   hft_journal_decode logs/trades.journal [more.journal ...]
+ *
+ * ===================================================================
+ */
+
+#include "../include/trade_journal.h"
+#include <cstdio>
+#include <vector>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <journal> [journal ...]\n", argv[0]);
+        return 2;
+    }
+
+    int status = 0;
+    std::vector<hft::data::JournalRecord> records;
+    for (int i = 1; i < argc; ++i) {
+        records.clear();
+        if (!hft::data::decode_journal(argv[i], records)) {
+            std::fprintf(stderr, "%s: not a trade journal (or unreadable)\n", argv[i]);
+            status = 1;
+            continue;
+        }
+        char line[256];
+        for (const auto& record : records) {
+            hft::data::format_record(record, line, sizeof(line));
+            std::puts(line);
+        }
+    }
+    return status;
+}